@@ -26,6 +26,8 @@ option(BUILD_TESTS "Turns on/off building the tests" OFF)
 option(ENABLE_CLANG_FORMAT "Turns on/off support for clang format" OFF)
 option(ENABLE_DOXYGEN "Turns on/off support for doxygen" OFF)
 option(ENABLE_COLOR "Turns on/off support for color" ON)
+option(ENABLE_THREAD_ID "Turns on/off printing the CPU and thread ID in debug statements" OFF)
+option(ENABLE_TIMESTAMP "Turns on/off printing a timestamp in debug statements" OFF)
 option(ENABLE_BRANCH "Turns on/off support for branch coverage with grcov" ON)
 
 bf_add_config(
@@ -36,6 +38,14 @@ bf_add_config(
     OPTIONS "bsl::CRITICAL_ONLY" "bsl::V" "bsl::VV" "bsl::VVV"
 )
 
+bf_add_config(
+    CONFIG_NAME BSL_LOG_MAX_LEVEL
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "bsl::VVV"
+    DESCRIPTION "Defines the most verbose level a log category can output"
+    OPTIONS "bsl::CRITICAL_ONLY" "bsl::V" "bsl::VV" "bsl::VVV"
+)
+
 bf_add_config(
     CONFIG_NAME BSL_PAGE_SIZE
     CONFIG_TYPE STRING
@@ -43,3 +53,19 @@ bf_add_config(
     DESCRIPTION "Defines the size of a page"
     OPTIONS 0x1000
 )
+
+bf_add_config(
+    CONFIG_NAME BSL_OUT_BUFFER_SIZE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "0"
+    DESCRIPTION "Defines the size of the per-thread output buffers (0 disables buffering)"
+    OPTIONS "0" "256" "1024" "4096"
+)
+
+bf_add_config(
+    CONFIG_NAME BSL_OUT_RING_SIZE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "0"
+    DESCRIPTION "Defines the size of the per-thread output rings drained by a background thread (0 disables them)"
+    OPTIONS "0" "4096" "16384" "65536"
+)
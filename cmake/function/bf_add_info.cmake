@@ -104,9 +104,36 @@ macro(bf_add_info NAME)
         )
     endif()
 
+    if(ENABLE_THREAD_ID)
+        add_custom_command(TARGET info
+            COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   ENABLE_THREAD_ID               ${BF_COLOR_GRN}enabled${BF_COLOR_RST}"
+            VERBATIM
+        )
+    else()
+        add_custom_command(TARGET info
+            COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   ENABLE_THREAD_ID               ${BF_COLOR_RED}disabled${BF_COLOR_RST}"
+            VERBATIM
+        )
+    endif()
+
+    if(ENABLE_TIMESTAMP)
+        add_custom_command(TARGET info
+            COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   ENABLE_TIMESTAMP               ${BF_COLOR_GRN}enabled${BF_COLOR_RST}"
+            VERBATIM
+        )
+    else()
+        add_custom_command(TARGET info
+            COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   ENABLE_TIMESTAMP               ${BF_COLOR_RED}disabled${BF_COLOR_RST}"
+            VERBATIM
+        )
+    endif()
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   BSL_DEBUG_LEVEL                ${BF_COLOR_CYN}${BSL_DEBUG_LEVEL}${BF_COLOR_RST}"
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   BSL_LOG_MAX_LEVEL              ${BF_COLOR_CYN}${BSL_LOG_MAX_LEVEL}${BF_COLOR_RST}"
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   BSL_PAGE_SIZE                  ${BF_COLOR_CYN}${BSL_PAGE_SIZE}${BF_COLOR_RST}"
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   BSL_OUT_BUFFER_SIZE            ${BF_COLOR_CYN}${BSL_OUT_BUFFER_SIZE}${BF_COLOR_RST}"
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   BSL_OUT_RING_SIZE              ${BF_COLOR_CYN}${BSL_OUT_RING_SIZE}${BF_COLOR_RST}"
         VERBATIM
     )
 
@@ -29,9 +29,18 @@ target_compile_options(bsl_internal INTERFACE
 
 target_compile_definitions(bsl_internal INTERFACE
     BSL_DEBUG_LEVEL=${BSL_DEBUG_LEVEL}
+    BSL_LOG_MAX_LEVEL=${BSL_LOG_MAX_LEVEL}
     BSL_PAGE_SIZE=${BSL_PAGE_SIZE}_umax
+    BSL_OUT_BUFFER_SIZE=${BSL_OUT_BUFFER_SIZE}
+    BSL_OUT_RING_SIZE=${BSL_OUT_RING_SIZE}
 )
 
+if(NOT BSL_OUT_RING_SIZE STREQUAL "0" AND CMAKE_SYSTEM_NAME STREQUAL "Linux")
+    target_link_libraries(bsl_internal INTERFACE
+        pthread
+    )
+endif()
+
 if(CMAKE_BUILD_TYPE STREQUAL RELEASE OR CMAKE_BUILD_TYPE STREQUAL MINSIZEREL)
     target_compile_definitions(bsl_internal INTERFACE
         BSL_RELEASE_MODE=true
@@ -52,6 +61,26 @@ else()
     )
 endif()
 
+if(ENABLE_THREAD_ID)
+    target_compile_definitions(bsl_internal INTERFACE
+        ENABLE_THREAD_ID=true
+    )
+else()
+    target_compile_definitions(bsl_internal INTERFACE
+        ENABLE_THREAD_ID=false
+    )
+endif()
+
+if(ENABLE_TIMESTAMP)
+    target_compile_definitions(bsl_internal INTERFACE
+        ENABLE_TIMESTAMP=true
+    )
+else()
+    target_compile_definitions(bsl_internal INTERFACE
+        ENABLE_TIMESTAMP=false
+    )
+endif()
+
 target_include_directories(bsl_internal INTERFACE
     ${CMAKE_CURRENT_LIST_DIR}/../../include
     $<$<PLATFORM_ID:Linux>:${CMAKE_CURRENT_LIST_DIR}/../../include/bsl/platform>
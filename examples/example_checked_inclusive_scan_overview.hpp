@@ -0,0 +1,55 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/checked_inclusive_scan.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_checked_inclusive_scan_overview() noexcept
+    {
+        bsl::array<bsl::safe_uint8, static_cast<bsl::uintmax>(4)> const vals{
+            1_u8, 2_u8, 3_u8, bsl::safe_uint8::max()};
+        bsl::array<bsl::safe_uint8, static_cast<bsl::uintmax>(4)> mut_res{};
+
+        auto const total{bsl::checked_inclusive_scan(bsl::span{vals}, bsl::span{mut_res})};
+        if (!total) {
+            bsl::print() << "prefix sums: "                      // --
+                         << *mut_res.at_if(0_umax) << ", "       // --
+                         << *mut_res.at_if(1_umax) << ", "       // --
+                         << *mut_res.at_if(2_umax) << bsl::endl;
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/log_category.hpp>
+
+namespace bsl
+{
+    /// @brief defines the category used by this example
+    constexpr bsl::log_category EXAMPLE_CAT_VMEXIT{static_cast<bsl::uintmax>(0), "vmexit"};
+    /// @brief defines the category used by this example
+    constexpr bsl::log_category EXAMPLE_CAT_MMIO{static_cast<bsl::uintmax>(1), "mmio"};
+
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_log_category_overview() noexcept
+    {
+        constexpr auto cats{bsl::make_log_categories(EXAMPLE_CAT_VMEXIT, EXAMPLE_CAT_MMIO)};
+
+        if (bsl::set_log_level(cats, "vmexit", bsl::to_umax(bsl::V))) {
+            bsl::print() << "success\n";
+        }
+        else {
+            bsl::error() << "failure\n";
+        }
+
+        if (auto const o{bsl::debug<bsl::VV>(EXAMPLE_CAT_VMEXIT)}) {
+            o << "not outputted as vmexit is only at V" << bsl::endl;
+        }
+
+        bsl::debug<bsl::VV>(EXAMPLE_CAT_VMEXIT) << []() noexcept {
+            return "not called as vmexit is only at V";
+        } << bsl::endl;
+
+        bsl::set_log_level(EXAMPLE_CAT_VMEXIT, bsl::to_umax(bsl::CRITICAL_ONLY));
+    }
+}
@@ -0,0 +1,56 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/trace.hpp>
+#include <bsl/trace_buffer.hpp>
+#include <bsl/trace_decode.hpp>
+#include <bsl/trace_fmt.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Provides the example's main function
+    ///
+    inline void
+    example_trace_overview() noexcept
+    {
+        constexpr bsl::uintmax size{static_cast<bsl::uintmax>(64)};
+        constexpr bsl::trace_fmt f{"vmexit: {} reason: {#x} name: {}"};
+        constexpr bsl::array<bsl::trace_fmt, static_cast<bsl::uintmax>(1)> catalog{f};
+
+        bsl::trace_buffer<size> mut_buf{};
+        bsl::trace(mut_buf, f, 1_u16, 0x1E_u32, bsl::string_view{"io"});
+
+        if (mut_buf.dropped().is_pos()) {
+            bsl::error() << "failure\n";
+            return;
+        }
+
+        bsl::trace_decode(bsl::print(), mut_buf.data(), mut_buf.size(), catalog);
+    }
+}
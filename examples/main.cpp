@@ -132,6 +132,8 @@
 // #include "debug/example_debug_alert.hpp"
 #include "debug/example_debug_debug.hpp"
 // #include "debug/example_debug_error.hpp"
+#include "debug/example_debug_lazy.hpp"
+#include "debug/example_debug_limited.hpp"
 #include "debug/example_debug_print.hpp"
 #include "example_add_const_overview.hpp"
 #include "example_add_lvalue_reference_overview.hpp"
@@ -143,20 +145,28 @@
 #include "example_arguments_overview.hpp"
 #include "example_array_overview.hpp"
 #include "example_as_const_overview.hpp"
+#include "example_atomic_overview.hpp"
 #include "example_basic_errc_type_overview.hpp"
 #include "example_basic_string_view_overview.hpp"
+#include "example_bit_overview.hpp"
 #include "example_bool_constant_overview.hpp"
+#include "example_bounded_integral_overview.hpp"
 #include "example_char_traits_overview.hpp"
 #include "example_char_type_overview.hpp"
+#include "example_checked_dot_overview.hpp"
+#include "example_checked_inclusive_scan_overview.hpp"
+#include "example_checked_sum_overview.hpp"
 #include "example_color_overview.hpp"
 #include "example_common_type_overview.hpp"
 #include "example_conditional_overview.hpp"
 #include "example_conjunction_overview.hpp"
 #include "example_construct_at_overview.hpp"
 #include "example_contiguous_iterator_overview.hpp"
+#include "example_convert_all_overview.hpp"
 #include "example_convert_overview.hpp"
 #include "example_cstr_type_overview.hpp"
 #include "example_cstring_overview.hpp"
+#include "example_ctype_overview.hpp"
 #include "example_decay_overview.hpp"
 #include "example_declval_overview.hpp"
 #include "example_destroy_at_overview.hpp"
@@ -173,13 +183,17 @@
 #include "example_extent_overview.hpp"
 #include "example_false_type_for_overview.hpp"
 #include "example_false_type_overview.hpp"
+#include "example_fast_divisor_overview.hpp"
 #include "example_finally_assert_overview.hpp"
 #include "example_finally_overview.hpp"
 #include "example_fmt_overview.hpp"
+#include "example_format_to_overview.hpp"
 #include "example_forward_overview.hpp"
 #include "example_from_chars_overview.hpp"
+#include "example_fused_integral_overview.hpp"
 #include "example_has_unique_object_representations_overview.hpp"
 #include "example_has_virtual_destructor_overview.hpp"
+#include "example_hexdump_overview.hpp"
 #include "example_index_sequence_for_overview.hpp"
 #include "example_index_sequence_overview.hpp"
 #include "example_integer_sequence_overview.hpp"
@@ -270,7 +284,9 @@
 #include "example_is_unsigned_overview.hpp"
 #include "example_is_void_overview.hpp"
 #include "example_is_volatile_overview.hpp"
+#include "example_json_overview.hpp"
 #include "example_likely_overview.hpp"
+#include "example_log_category_overview.hpp"
 #include "example_make_index_sequence_overview.hpp"
 #include "example_make_integer_sequence_overview.hpp"
 #include "example_make_signed_overview.hpp"
@@ -278,11 +294,14 @@
 #include "example_max_align_t_overview.hpp"
 #include "example_move_if_noexcept_overview.hpp"
 #include "example_move_overview.hpp"
+#include "example_mul_div_overview.hpp"
+#include "example_mul_hi_overview.hpp"
 #include "example_negation_overview.hpp"
 #include "example_nonesuch_overview.hpp"
 #include "example_npos_overview.hpp"
 #include "example_nullptr_t_overview.hpp"
 #include "example_numeric_limits_overview.hpp"
+#include "example_parse_list_overview.hpp"
 #include "example_rank_overview.hpp"
 #include "example_reference_wrapper_overview.hpp"
 #include "example_remove_all_extents_overview.hpp"
@@ -295,13 +314,17 @@
 #include "example_remove_reference_overview.hpp"
 #include "example_remove_volatile_overview.hpp"
 #include "example_reverse_iterator_overview.hpp"
+#include "example_safe_array_overview.hpp"
+#include "example_safe_atomic_overview.hpp"
 #include "example_safe_integral_overview.hpp"
+#include "example_saturating_integral_overview.hpp"
 #include "example_sort_overview.hpp"
 #include "example_source_location_overview.hpp"
 #include "example_span_overview.hpp"
 #include "example_string_view_overview.hpp"
 #include "example_swap_overview.hpp"
 #include "example_touch_overview.hpp"
+#include "example_trace_overview.hpp"
 #include "example_true_type_for_overview.hpp"
 #include "example_true_type_overview.hpp"
 #include "example_type_identity_overview.hpp"
@@ -309,6 +332,7 @@
 #include "example_unlikely_assert_overview.hpp"
 #include "example_unlikely_overview.hpp"
 #include "example_void_t_overview.hpp"
+#include "example_wrapping_integral_overview.hpp"
 #include "fmt/example_fmt_align.hpp"
 #include "fmt/example_fmt_alt_form.hpp"
 #include "fmt/example_fmt_bool.hpp"
@@ -317,6 +341,7 @@
 #include "fmt/example_fmt_constructor_f_val_width.hpp"
 #include "fmt/example_fmt_cstr_type.hpp"
 #include "fmt/example_fmt_integral.hpp"
+#include "fmt/example_fmt_literal.hpp"
 #include "fmt/example_fmt_sign.hpp"
 #include "fmt/example_fmt_sign_aware.hpp"
 #include "fmt/example_fmt_width.hpp"
@@ -489,6 +514,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_array_size_bytes, "example_array_size_bytes");
     example(&bsl::example_array_size, "example_array_size");
     example(&bsl::example_as_const_overview, "example_as_const_overview");
+    example(&bsl::example_atomic_overview, "example_atomic_overview");
     example(&bsl::example_basic_errc_type_overview, "example_basic_errc_type_overview");
     example(&bsl::example_basic_errc_type_constructor_t_safe_int, "example_basic_errc_type_constructor_t_safe_int");
     example(&bsl::example_basic_errc_type_constructor_t, "example_basic_errc_type_constructor_t");
@@ -500,6 +526,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_basic_errc_type_operator_bool, "example_basic_errc_type_operator_bool");
     example(&bsl::example_basic_errc_type_success, "example_basic_errc_type_success");
     example(&bsl::example_basic_string_view_overview, "example_basic_string_view_overview");
+    example(&bsl::example_bit_overview, "example_bit_overview");
     example(&bsl::example_basic_string_view_at_if, "example_basic_string_view_at_if");
     example(&bsl::example_basic_string_view_back_if, "example_basic_string_view_back_if");
     example(&bsl::example_basic_string_view_begin, "example_basic_string_view_begin");
@@ -531,6 +558,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_basic_string_view_starts_with, "example_basic_string_view_starts_with");
     example(&bsl::example_basic_string_view_substr, "example_basic_string_view_substr");
     example(&bsl::example_bool_constant_overview, "example_bool_constant_overview");
+    example(&bsl::example_bounded_integral_overview, "example_bounded_integral_overview");
     example(&bsl::example_char_traits_overview, "example_char_traits_overview");
     example(&bsl::example_char_traits_compare, "example_char_traits_compare");
     example(&bsl::example_char_traits_eof, "example_char_traits_eof");
@@ -542,12 +570,16 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_char_traits_to_char_type, "example_char_traits_to_char_type");
     example(&bsl::example_char_traits_to_int_type, "example_char_traits_to_int_type");
     example(&bsl::example_char_type_overview, "example_char_type_overview");
+    example(&bsl::example_checked_dot_overview, "example_checked_dot_overview");
+    example(&bsl::example_checked_inclusive_scan_overview, "example_checked_inclusive_scan_overview");
+    example(&bsl::example_checked_sum_overview, "example_checked_sum_overview");
     example(&bsl::example_color_overview, "example_color_overview");
     example(&bsl::example_common_type_overview, "example_common_type_overview");
     example(&bsl::example_conditional_overview, "example_conditional_overview");
     example(&bsl::example_conjunction_overview, "example_conjunction_overview");
     example(&bsl::example_construct_at_overview, "example_construct_at_overview");
     example(&bsl::example_contiguous_iterator_overview, "example_contiguous_iterator_overview");
+    example(&bsl::example_convert_all_overview, "example_convert_all_overview");
     example(&bsl::example_contiguous_iterator_data, "example_contiguous_iterator_data");
     example(&bsl::example_contiguous_iterator_decrement, "example_contiguous_iterator_decrement");
     example(&bsl::example_contiguous_iterator_empty, "example_contiguous_iterator_empty");
@@ -565,6 +597,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_convert_overview, "example_convert_overview");
     example(&bsl::example_cstr_type_overview, "example_cstr_type_overview");
     example(&bsl::example_cstring_overview, "example_cstring_overview");
+    example(&bsl::example_ctype_overview, "example_ctype_overview");
     example(&bsl::example_convert_to_i8, "example_convert_to_i8");
     example(&bsl::example_convert_to_i16, "example_convert_to_i16");
     example(&bsl::example_convert_to_i32, "example_convert_to_i32");
@@ -584,6 +617,8 @@ main() noexcept -> bsl::exit_code
     // example(&bsl::example_debug_alert, "example_debug_alert");
     example(&bsl::example_debug_debug, "example_debug_debug");
     // example(&bsl::example_debug_error, "example_debug_error");
+    example(&bsl::example_debug_lazy, "example_debug_lazy");
+    example(&bsl::example_debug_limited, "example_debug_limited");
     example(&bsl::example_debug_print, "example_debug_print");
     example(&bsl::example_decay_overview, "example_decay_overview");
     example(&bsl::example_declval_overview, "example_declval_overview");
@@ -601,6 +636,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_extent_overview, "example_extent_overview");
     example(&bsl::example_false_type_overview, "example_false_type_overview");
     example(&bsl::example_false_type_for_overview, "example_false_type_for_overview");
+    example(&bsl::example_fast_divisor_overview, "example_fast_divisor_overview");
     example(&bsl::example_finally_assert_overview, "example_finally_assert_overview");
     example(&bsl::example_finally_overview, "example_finally_overview");
     example(&bsl::example_fmt_overview, "example_fmt_overview");
@@ -612,13 +648,17 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_fmt_constructor_f_val, "example_fmt_constructor_f_val");
     example(&bsl::example_fmt_cstr_type, "example_fmt_cstr_type");
     example(&bsl::example_fmt_integral, "example_fmt_integral");
+    example(&bsl::example_fmt_literal, "example_fmt_literal");
     example(&bsl::example_fmt_sign_aware, "example_fmt_sign_aware");
     example(&bsl::example_fmt_sign, "example_fmt_sign");
     example(&bsl::example_fmt_width, "example_fmt_width");
+    example(&bsl::example_format_to_overview, "example_format_to_overview");
     example(&bsl::example_forward_overview, "example_forward_overview");
     example(&bsl::example_from_chars_overview, "example_from_chars_overview");
+    example(&bsl::example_fused_integral_overview, "example_fused_integral_overview");
     example(&bsl::example_has_unique_object_representations_overview, "example_has_unique_object_representations_overview");
     example(&bsl::example_has_virtual_destructor_overview, "example_has_virtual_destructor_overview");
+    example(&bsl::example_hexdump_overview, "example_hexdump_overview");
     example(&bsl::example_index_sequence_for_overview, "example_index_sequence_for_overview");
     example(&bsl::example_index_sequence_overview, "example_index_sequence_overview");
     example(&bsl::example_integer_sequence_overview, "example_integer_sequence_overview");
@@ -712,7 +752,9 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_is_union_overview, "example_is_union_overview");
     example(&bsl::example_is_void_overview, "example_is_void_overview");
     example(&bsl::example_is_volatile_overview, "example_is_volatile_overview");
+    example(&bsl::example_json_overview, "example_json_overview");
     example(&bsl::example_likely_overview, "example_likely_overview");
+    example(&bsl::example_log_category_overview, "example_log_category_overview");
     example(&bsl::example_make_index_sequence_overview, "example_make_index_sequence_overview");
     example(&bsl::example_make_integer_sequence_overview, "example_make_integer_sequence_overview");
     example(&bsl::example_make_signed_overview, "example_make_signed_overview");
@@ -720,11 +762,14 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_max_align_t_overview, "example_max_align_t_overview");
     example(&bsl::example_move_if_noexcept_overview, "example_move_if_noexcept_overview");
     example(&bsl::example_move_overview, "example_move_overview");
+    example(&bsl::example_mul_div_overview, "example_mul_div_overview");
+    example(&bsl::example_mul_hi_overview, "example_mul_hi_overview");
     example(&bsl::example_negation_overview, "example_negation_overview");
     example(&bsl::example_nonesuch_overview, "example_nonesuch_overview");
     example(&bsl::example_npos_overview, "example_npos_overview");
     example(&bsl::example_nullptr_t_overview, "example_nullptr_t_overview");
     example(&bsl::example_numeric_limits_overview, "example_numeric_limits_overview");
+    example(&bsl::example_parse_list_overview, "example_parse_list_overview");
     example(&bsl::example_rank_overview, "example_rank_overview");
     example(&bsl::example_reference_wrapper_overview, "example_reference_wrapper_overview");
     example(&bsl::example_reference_wrapper_constructor, "example_reference_wrapper_constructor");
@@ -741,6 +786,8 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_remove_reference_overview, "example_remove_reference_overview");
     example(&bsl::example_remove_volatile_overview, "example_remove_volatile_overview");
     example(&bsl::example_reverse_iterator_overview, "example_reverse_iterator_overview");
+    example(&bsl::example_safe_array_overview, "example_safe_array_overview");
+    example(&bsl::example_safe_atomic_overview, "example_safe_atomic_overview");
     example(&bsl::example_reverse_iterator_data, "example_reverse_iterator_data");
     example(&bsl::example_reverse_iterator_decrement, "example_reverse_iterator_decrement");
     example(&bsl::example_reverse_iterator_empty, "example_reverse_iterator_empty");
@@ -796,6 +843,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_safe_integral_sub, "example_safe_integral_sub");
     example(&bsl::example_safe_integral_unary, "example_safe_integral_unary");
     example(&bsl::example_safe_integral_xor, "example_safe_integral_xor");
+    example(&bsl::example_saturating_integral_overview, "example_saturating_integral_overview");
     example(&bsl::example_sort_overview, "example_sort_overview");
     example(&bsl::example_source_location_overview, "example_source_location_overview");
     example(&bsl::example_source_location_current, "example_source_location_current");
@@ -833,6 +881,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_string_view_overview, "example_string_view_overview");
     example(&bsl::example_swap_overview, "example_swap_overview");
     example(&bsl::example_touch_overview, "example_touch_overview");
+    example(&bsl::example_trace_overview, "example_trace_overview");
     example(&bsl::example_true_type_for_overview, "example_true_type_for_overview");
     example(&bsl::example_true_type_overview, "example_true_type_overview");
     example(&bsl::example_type_identity_overview, "example_type_identity_overview");
@@ -840,6 +889,7 @@ main() noexcept -> bsl::exit_code
     example(&bsl::example_unlikely_assert_overview, "example_unlikely_assert_overview");
     example(&bsl::example_unlikely_overview, "example_unlikely_overview");
     example(&bsl::example_void_t_overview, "example_void_t_overview");
+    example(&bsl::example_wrapping_integral_overview, "example_wrapping_integral_overview");
 
     return bsl::exit_success;
 }
@@ -0,0 +1,406 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file atomic.hpp
+///
+
+#ifndef BSL_ATOMIC_HPP
+#define BSL_ATOMIC_HPP
+
+#include "cstdint.hpp"
+#include "enable_if.hpp"
+#include "is_integral.hpp"
+#include "is_same.hpp"
+#include "memory_order.hpp"
+#include "touch.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the provided bsl::memory_order as the
+        ///     __ATOMIC_XXX constant the compiler's builtins expect.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order to convert
+        ///   @return Returns the provided bsl::memory_order as the
+        ///     __ATOMIC_XXX constant the compiler's builtins expect.
+        ///
+        [[nodiscard]] constexpr auto
+        atomic_order(memory_order const order) noexcept -> bsl::int32
+        {
+            return static_cast<bsl::int32>(order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the memory order to use when a compare and
+        ///     exchange fails, given the memory order used when it
+        ///     succeeds. A failed compare and exchange is only a load, so
+        ///     it cannot have release semantics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order used on success
+        ///   @return Returns the memory order to use on failure
+        ///
+        [[nodiscard]] constexpr auto
+        atomic_failure_order(memory_order const order) noexcept -> memory_order
+        {
+            if (memory_order::acq_rel == order) {
+                return memory_order::acquire;
+            }
+
+            bsl::touch();
+            if (memory_order::release == order) {
+                return memory_order::relaxed;
+            }
+
+            bsl::touch();
+            return order;
+        }
+    }
+
+    /// @class bsl::atomic
+    ///
+    /// <!-- description -->
+    ///   @brief Provides a simplified version of std::atomic for integral
+    ///     types, built on the compiler's __atomic_xxx builtins. Every
+    ///     operation takes an explicit bsl::memory_order, which defaults
+    ///     to bsl::memory_order::seq_cst. Like std::atomic, the fetch_xxx
+    ///     operations wrap on overflow. Use bsl::safe_atomic to have
+    ///     overflow reported instead.
+    ///   @include example_atomic_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of integral to store
+    ///
+    template<typename T>
+    class atomic final
+    {
+        static_assert(is_integral<T>::value, "only integral types are supported");
+
+        /// @brief stores the value being accessed atomically
+        T m_val;
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::atomic that stores 0
+        ///
+        constexpr atomic() noexcept    // --
+            : m_val{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::atomic given a BSL fixed width type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param val the value to store
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        explicit constexpr atomic(U const val) noexcept    // --
+            : m_val{val}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::atomic
+        ///
+        constexpr ~atomic() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr atomic(atomic const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr atomic(atomic &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(atomic const &o) &noexcept -> atomic & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(atomic &&mut_o) &noexcept -> atomic & = delete;
+
+        /// <!-- description -->
+        ///   @brief Atomically returns the stored value.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order to use. Cannot be release or
+        ///     acq_rel.
+        ///   @return Returns the stored value
+        ///
+        [[nodiscard]] auto
+        load(memory_order const order = memory_order::seq_cst) const noexcept -> value_type
+        {
+            return __atomic_load_n(&m_val, details::atomic_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically replaces the stored value with val.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to store
+        ///   @param order the memory order to use. Cannot be consume,
+        ///     acquire or acq_rel.
+        ///
+        void
+        store(value_type const val, memory_order const order = memory_order::seq_cst) noexcept
+        {
+            __atomic_store_n(&m_val, val, details::atomic_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically replaces the stored value with val and
+        ///     returns the value that was previously stored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to store
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        exchange(value_type const val, memory_order const order = memory_order::seq_cst) noexcept
+            -> value_type
+        {
+            return __atomic_exchange_n(&m_val, val, details::atomic_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief If the stored value is equal to mut_expected, it is
+        ///     replaced with desired and true is returned. Otherwise,
+        ///     mut_expected is set to the stored value and false is
+        ///     returned. Unlike compare_exchange_strong, this is allowed
+        ///     to fail spuriously, which is faster on some targets when
+        ///     used in a loop.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_expected the value expected to be stored
+        ///   @param desired the value to store if mut_expected matches
+        ///   @param success the memory order to use if the exchange occurs
+        ///   @param failure the memory order to use if it does not. Cannot
+        ///     be release or acq_rel, or stronger than success.
+        ///   @return Returns true if the exchange occurred
+        ///
+        [[nodiscard]] auto
+        compare_exchange_weak(
+            value_type &mut_expected,
+            value_type const desired,
+            memory_order const success,
+            memory_order const failure) noexcept -> bool
+        {
+            return __atomic_compare_exchange_n(
+                &m_val,
+                &mut_expected,
+                desired,
+                true,
+                details::atomic_order(success),
+                details::atomic_order(failure));
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as compare_exchange_weak, but the memory order
+        ///     used on failure is derived from the provided memory order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_expected the value expected to be stored
+        ///   @param desired the value to store if mut_expected matches
+        ///   @param order the memory order to use
+        ///   @return Returns true if the exchange occurred
+        ///
+        [[nodiscard]] auto
+        compare_exchange_weak(
+            value_type &mut_expected,
+            value_type const desired,
+            memory_order const order = memory_order::seq_cst) noexcept -> bool
+        {
+            return this->compare_exchange_weak(
+                mut_expected, desired, order, details::atomic_failure_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief If the stored value is equal to mut_expected, it is
+        ///     replaced with desired and true is returned. Otherwise,
+        ///     mut_expected is set to the stored value and false is
+        ///     returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_expected the value expected to be stored
+        ///   @param desired the value to store if mut_expected matches
+        ///   @param success the memory order to use if the exchange occurs
+        ///   @param failure the memory order to use if it does not. Cannot
+        ///     be release or acq_rel, or stronger than success.
+        ///   @return Returns true if the exchange occurred
+        ///
+        [[nodiscard]] auto
+        compare_exchange_strong(
+            value_type &mut_expected,
+            value_type const desired,
+            memory_order const success,
+            memory_order const failure) noexcept -> bool
+        {
+            return __atomic_compare_exchange_n(
+                &m_val,
+                &mut_expected,
+                desired,
+                false,
+                details::atomic_order(success),
+                details::atomic_order(failure));
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as compare_exchange_strong, but the memory order
+        ///     used on failure is derived from the provided memory order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_expected the value expected to be stored
+        ///   @param desired the value to store if mut_expected matches
+        ///   @param order the memory order to use
+        ///   @return Returns true if the exchange occurred
+        ///
+        [[nodiscard]] auto
+        compare_exchange_strong(
+            value_type &mut_expected,
+            value_type const desired,
+            memory_order const order = memory_order::seq_cst) noexcept -> bool
+        {
+            return this->compare_exchange_strong(
+                mut_expected, desired, order, details::atomic_failure_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically adds val to the stored value and returns the
+        ///     value that was previously stored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to add to the stored value
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        fetch_add(value_type const val, memory_order const order = memory_order::seq_cst) noexcept
+            -> value_type
+        {
+            static_assert(!is_same<value_type, bool>::value, "bool is not supported");
+            return __atomic_fetch_add(&m_val, val, details::atomic_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically subtracts val from the stored value and
+        ///     returns the value that was previously stored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to subtract from the stored value
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        fetch_sub(value_type const val, memory_order const order = memory_order::seq_cst) noexcept
+            -> value_type
+        {
+            static_assert(!is_same<value_type, bool>::value, "bool is not supported");
+            return __atomic_fetch_sub(&m_val, val, details::atomic_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically replaces the stored value with the stored
+        ///     value & val and returns the value that was previously
+        ///     stored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to and the stored value with
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        fetch_and(value_type const val, memory_order const order = memory_order::seq_cst) noexcept
+            -> value_type
+        {
+            static_assert(!is_same<value_type, bool>::value, "bool is not supported");
+            return __atomic_fetch_and(&m_val, val, details::atomic_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically replaces the stored value with the stored
+        ///     value | val and returns the value that was previously
+        ///     stored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to or the stored value with
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        fetch_or(value_type const val, memory_order const order = memory_order::seq_cst) noexcept
+            -> value_type
+        {
+            static_assert(!is_same<value_type, bool>::value, "bool is not supported");
+            return __atomic_fetch_or(&m_val, val, details::atomic_order(order));
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically replaces the stored value with the stored
+        ///     value ^ val and returns the value that was previously
+        ///     stored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to xor the stored value with
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        fetch_xor(value_type const val, memory_order const order = memory_order::seq_cst) noexcept
+            -> value_type
+        {
+            static_assert(!is_same<value_type, bool>::value, "bool is not supported");
+            return __atomic_fetch_xor(&m_val, val, details::atomic_order(order));
+        }
+    };
+}
+
+#endif
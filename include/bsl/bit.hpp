@@ -0,0 +1,569 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bit.hpp
+///
+
+#ifndef BSL_BIT_HPP
+#define BSL_BIT_HPP
+
+#include "climits.hpp"
+#include "cstdint.hpp"
+#include "enable_if.hpp"
+#include "is_constant_evaluated.hpp"
+#include "is_unsigned.hpp"
+#include "safe_integral.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the total number of bits in a T.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to query
+        ///   @return Returns the total number of bits in a T.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        bit_digits() noexcept -> T
+        {
+            static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+            static_assert(sizeof(T) <= sizeof(bsl::uint64), "128bit integrals are not supported");
+
+            return static_cast<T>(sizeof(T) * CHAR_BIT);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of 1 bits in val. If val is 0, this
+    ///     returns 0. At runtime this maps to the compiler's popcount
+    ///     builtin (i.e., a single instruction when the target has one).
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of 1 bits in val
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    popcount(T const val) noexcept -> T
+    {
+        static_assert(sizeof(T) <= sizeof(bsl::uint64), "128bit integrals are not supported");
+        constexpr T one{static_cast<T>(1)};
+        if (is_constant_evaluated()) {
+            T mut_cnt{};
+            for (T mut_val{val}; T{} != mut_val; mut_val &= static_cast<T>(mut_val - one)) {
+                mut_cnt = static_cast<T>(mut_cnt + one);
+            }
+
+            return mut_cnt;
+        }
+
+        return static_cast<T>(__builtin_popcountll(static_cast<bsl::uint64>(val)));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of consecutive 0 bits in val, starting
+    ///     from the most significant bit. If val is 0, this returns the
+    ///     total number of bits in a T.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of leading 0 bits in val
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    countl_zero(T const val) noexcept -> T
+    {
+        constexpr T one{static_cast<T>(1)};
+        constexpr T digits{details::bit_digits<T>()};
+        constexpr T pad{static_cast<T>(details::bit_digits<bsl::uint64>() - digits)};
+
+        if (T{} == val) {
+            return digits;
+        }
+
+        bsl::touch();
+        if (is_constant_evaluated()) {
+            T mut_cnt{digits};
+            for (T mut_val{val}; T{} != mut_val; mut_val >>= one) {
+                mut_cnt = static_cast<T>(mut_cnt - one);
+            }
+
+            return mut_cnt;
+        }
+
+        return static_cast<T>(
+            static_cast<T>(__builtin_clzll(static_cast<bsl::uint64>(val))) - pad);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of consecutive 0 bits in val, starting
+    ///     from the least significant bit. If val is 0, this returns the
+    ///     total number of bits in a T.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of trailing 0 bits in val
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    countr_zero(T const val) noexcept -> T
+    {
+        constexpr T one{static_cast<T>(1)};
+        constexpr T digits{details::bit_digits<T>()};
+
+        if (T{} == val) {
+            return digits;
+        }
+
+        bsl::touch();
+        if (is_constant_evaluated()) {
+            T mut_cnt{};
+            for (T mut_val{val}; T{} == static_cast<T>(mut_val & one); mut_val >>= one) {
+                mut_cnt = static_cast<T>(mut_cnt + one);
+            }
+
+            return mut_cnt;
+        }
+
+        return static_cast<T>(__builtin_ctzll(static_cast<bsl::uint64>(val)));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns val rotated left by shift bits. The shift is
+    ///     taken modulo the total number of bits in a T, so any shift is
+    ///     defined. The compiler reduces this to a single rotate
+    ///     instruction on targets that have one.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to rotate
+    ///   @param val the value to rotate
+    ///   @param shift the number of bits to rotate val by
+    ///   @return Returns val rotated left by shift bits
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    rotl(T const val, T const shift) noexcept -> T
+    {
+        constexpr T digits{details::bit_digits<T>()};
+        T const cnt{static_cast<T>(shift % digits)};
+
+        if (T{} == cnt) {
+            return val;
+        }
+
+        bsl::touch();
+        return static_cast<T>(
+            static_cast<T>(val << cnt) | static_cast<T>(val >> static_cast<T>(digits - cnt)));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns val rotated right by shift bits. The shift is
+    ///     taken modulo the total number of bits in a T, so any shift is
+    ///     defined. The compiler reduces this to a single rotate
+    ///     instruction on targets that have one.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to rotate
+    ///   @param val the value to rotate
+    ///   @param shift the number of bits to rotate val by
+    ///   @return Returns val rotated right by shift bits
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    rotr(T const val, T const shift) noexcept -> T
+    {
+        constexpr T digits{details::bit_digits<T>()};
+        T const cnt{static_cast<T>(shift % digits)};
+
+        if (T{} == cnt) {
+            return val;
+        }
+
+        bsl::touch();
+        return static_cast<T>(
+            static_cast<T>(val >> cnt) | static_cast<T>(val << static_cast<T>(digits - cnt)));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of bits needed to store val (i.e.,
+    ///     1 + floor(log2(val))). If val is 0, this returns 0.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of bits needed to store val
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    bit_width(T const val) noexcept -> T
+    {
+        constexpr T digits{details::bit_digits<T>()};
+        return static_cast<T>(digits - countl_zero(val));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the largest power of 2 that is not greater than
+    ///     val. If val is 0, this returns 0.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the largest power of 2 that is not greater than val
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    bit_floor(T const val) noexcept -> T
+    {
+        constexpr T one{static_cast<T>(1)};
+
+        if (T{} == val) {
+            return T{};
+        }
+
+        bsl::touch();
+        return static_cast<T>(one << static_cast<T>(bit_width(val) - one));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the smallest power of 2 that is not less than
+    ///     val. If val is 0, this returns 1. If the result cannot be
+    ///     represented by a T, this returns 0. Use the
+    ///     bsl::safe_integral version to have this reported as an
+    ///     overflow instead.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the smallest power of 2 that is not less than val,
+    ///     or 0 if the result cannot be represented by a T.
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    bit_ceil(T const val) noexcept -> T
+    {
+        constexpr T one{static_cast<T>(1)};
+        constexpr T digits{details::bit_digits<T>()};
+
+        if (val <= one) {
+            return one;
+        }
+
+        bsl::touch();
+        T const width{bit_width(static_cast<T>(val - one))};
+        if (unlikely(digits == width)) {
+            return T{};
+        }
+
+        return static_cast<T>(one << width);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if val is a power of 2 (i.e., exactly one
+    ///     bit is set). If val is 0, this returns false.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns true if val is a power of 2
+    ///
+    template<typename T, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    has_single_bit(T const val) noexcept -> bool
+    {
+        constexpr T one{static_cast<T>(1)};
+
+        if (T{} == val) {
+            return false;
+        }
+
+        bsl::touch();
+        return T{} == static_cast<T>(val & static_cast<T>(val - one));
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::popcount, but for a bsl::safe_integral. If val
+    ///     is invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of 1 bits in val
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    popcount(safe_integral<T> const &val) noexcept -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{popcount(val.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::countl_zero, but for a bsl::safe_integral. If val
+    ///     is invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of leading 0 bits in val
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    countl_zero(safe_integral<T> const &val) noexcept -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{countl_zero(val.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::countr_zero, but for a bsl::safe_integral. If val
+    ///     is invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of trailing 0 bits in val
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    countr_zero(safe_integral<T> const &val) noexcept -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{countr_zero(val.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::rotl, but for a bsl::safe_integral. If val
+    ///     or shift are invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to rotate
+    ///   @param val the value to rotate
+    ///   @param shift the number of bits to rotate val by
+    ///   @return Returns val rotated left by shift bits
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    rotl(safe_integral<T> const &val, safe_integral<T> const &shift) noexcept
+        -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        if (unlikely(shift.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{rotl(val.get(), shift.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::rotr, but for a bsl::safe_integral. If val
+    ///     or shift are invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to rotate
+    ///   @param val the value to rotate
+    ///   @param shift the number of bits to rotate val by
+    ///   @return Returns val rotated right by shift bits
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    rotr(safe_integral<T> const &val, safe_integral<T> const &shift) noexcept
+        -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        if (unlikely(shift.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{rotr(val.get(), shift.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::bit_width, but for a bsl::safe_integral. If val
+    ///     is invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the number of bits needed to store val
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bit_width(safe_integral<T> const &val) noexcept -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{bit_width(val.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::bit_floor, but for a bsl::safe_integral. If val
+    ///     is invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the largest power of 2 that is not greater than val
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bit_floor(safe_integral<T> const &val) noexcept -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{bit_floor(val.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::bit_ceil, but for a bsl::safe_integral. If val
+    ///     is invalid, this is reported as an illegal use, and if the
+    ///     result cannot be represented by a T, this is reported as an
+    ///     overflow. In both cases, bsl::safe_integral<T>::failure() is
+    ///     returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns the smallest power of 2 that is not less than val
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bit_ceil(safe_integral<T> const &val) noexcept -> safe_integral<T>
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        T const res{bit_ceil(val.get())};
+        if (unlikely(T{} == res)) {
+            integral_overflow_underflow_wrap_error();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{res};
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::has_single_bit, but for a bsl::safe_integral.
+    ///     If val is invalid, this is reported as an illegal use, and false
+    ///     is returned.
+    ///   @include example_bit_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to query
+    ///   @param val the value to query
+    ///   @return Returns true if val is a power of 2
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    has_single_bit(safe_integral<T> const &val) noexcept -> bool
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integrals are supported");
+
+        if (unlikely(val.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return false;
+        }
+
+        return has_single_bit(val.get());
+    }
+}
+
+#endif
@@ -0,0 +1,856 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bounded_integral.hpp
+///
+
+#ifndef BSL_BOUNDED_INTEGRAL_HPP
+#define BSL_BOUNDED_INTEGRAL_HPP
+
+#include "always_false.hpp"
+#include "conditional.hpp"
+#include "cstdint.hpp"
+#include "details/bounded_range.hpp"
+#include "details/wrapping_policy.hpp"
+#include "discard.hpp"
+#include "enable_if.hpp"
+#include "is_integral.hpp"
+#include "is_same.hpp"
+#include "is_signed.hpp"
+#include "numeric_limits.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::bounded_integral
+    ///
+    /// <!-- description -->
+    ///   @brief Provides an integral type whose value is known at
+    ///     compile-time to be within [MIN, MAX] (e.g., a vector number,
+    ///     a page offset or a CPU id). When two bsl::bounded_integrals are
+    ///     combined, the range of the result is computed at compile-time.
+    ///     If that range can be represented by the underlying type, the
+    ///     result is another bsl::bounded_integral and no overflow check
+    ///     is emitted at all. Otherwise, the result is a bsl::safe_integral
+    ///     and the operation is checked at run-time as usual.
+    ///   @include example_bounded_integral_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam MIN the smallest value the bsl::bounded_integral can store.
+    ///     The type of MIN is the underlying integral type.
+    ///   @tparam MAX the largest value the bsl::bounded_integral can store.
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    class bounded_integral final
+    {
+        static_assert(bsl::is_integral<decltype(MIN)>::value, "only integral types are supported");
+        static_assert(!(MAX < MIN), "MIN must not be larger than MAX");
+
+        /// @brief stores the value of the integral
+        decltype(MIN) m_val;
+
+    public:
+        /// @brief alias for: decltype(MIN)
+        using value_type = decltype(MIN);
+
+        /// <!-- description -->
+        ///   @brief Default constructor that creates a bsl::bounded_integral
+        ///     with get() == MIN.
+        ///
+        constexpr bounded_integral() noexcept    // --
+            : m_val{MIN}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::bounded_integral given a BSL fixed width
+        ///     type. If val is not within [MIN, MAX], this is reported as an
+        ///     invalid argument and the value is clamped to [MIN, MAX]. If
+        ///     [MIN, MAX] covers every value of the underlying type, no
+        ///     check is performed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     value_type, effectively preventing implicit conversions from
+        ///     being allowed.
+        ///   @param val the value to set the bsl::bounded_integral to
+        ///
+        template<typename U, enable_if_t<is_same<value_type, U>::value, bool> = true>
+        explicit constexpr bounded_integral(U const val) noexcept    // --
+            : m_val{details::bounded_clamp<MIN, MAX>(val)}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::bounded_integral given a bsl::safe_integral
+        ///     of the same type. If val is invalid, or is not within
+        ///     [MIN, MAX], this is reported and the value is clamped to
+        ///     [MIN, MAX].
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the bsl::bounded_integral to
+        ///
+        explicit constexpr bounded_integral(safe_integral<value_type> const &val) noexcept    // --
+            : m_val{details::bounded_clamp<MIN, MAX>(val.get())}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::bounded_integral given a value that has
+        ///     already been proven to be within [MIN, MAX]. This is used by
+        ///     the bsl::bounded_integral operators, and should not be used
+        ///     directly.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tag ignored
+        ///   @param val the value to set the bsl::bounded_integral to
+        ///
+        constexpr bounded_integral(
+            details::bounded_unchecked_t const &tag, value_type const val) noexcept    // --
+            : m_val{val}
+        {
+            bsl::discard(tag);
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::bounded_integral
+        ///
+        constexpr ~bounded_integral() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr bounded_integral(bounded_integral const &o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr bounded_integral(bounded_integral &&mut_o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(bounded_integral const &o) &noexcept
+            -> bounded_integral & = default;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(bounded_integral &&mut_o) &noexcept
+            -> bounded_integral & = default;
+
+        /// <!-- description -->
+        ///   @brief Returns the value stored by the bsl::bounded_integral,
+        ///     which is always within [MIN, MAX].
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value stored by the bsl::bounded_integral
+        ///
+        [[nodiscard]] constexpr auto
+        get() const noexcept -> value_type
+        {
+            return m_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value stored by the bsl::bounded_integral
+        ///     as a bsl::safe_integral. Since a bsl::bounded_integral is
+        ///     always valid, this conversion does not perform any checks.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value stored by the bsl::bounded_integral
+        ///     as a bsl::safe_integral.
+        ///
+        [[nodiscard]] constexpr auto
+        to_safe() const noexcept -> safe_integral<value_type>
+        {
+            return safe_integral<value_type>{m_val};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns MIN
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns MIN
+        ///
+        [[nodiscard]] static constexpr auto
+        min() noexcept -> value_type
+        {
+            return MIN;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns MAX
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns MAX
+        ///
+        [[nodiscard]] static constexpr auto
+        max() noexcept -> value_type
+        {
+            return MAX;
+        }
+    };
+
+    namespace details
+    {
+        /// @brief the result of an operation whose range is R. If R fits,
+        ///   this is a bsl::bounded_integral, otherwise it is a
+        ///   bsl::safe_integral.
+        template<auto R>
+        using bounded_result_t = conditional_t<
+            R.fits,
+            bounded_integral<R.lo, R.hi>,
+            safe_integral<decltype(R.lo)>>;
+    }
+
+    // -------------------------------------------------------------------------
+    // bounded_integral rational operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs.get()
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator==(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> bool
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of lhs
+    ///   @tparam MAX the largest value of lhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator==(bounded_integral<MIN, MAX> const &lhs, decltype(MIN) const rhs) noexcept -> bool
+    {
+        return lhs.get() == rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs == rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of rhs
+    ///   @tparam MAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs == rhs.get()
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator==(decltype(MIN) const lhs, bounded_integral<MIN, MAX> const &rhs) noexcept -> bool
+    {
+        return lhs == rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() != rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() != rhs.get()
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator!=(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> bool
+    {
+        return lhs.get() != rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() != rhs
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of lhs
+    ///   @tparam MAX the largest value of lhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() != rhs
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator!=(bounded_integral<MIN, MAX> const &lhs, decltype(MIN) const rhs) noexcept -> bool
+    {
+        return lhs.get() != rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs != rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of rhs
+    ///   @tparam MAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs != rhs.get()
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator!=(decltype(MIN) const lhs, bounded_integral<MIN, MAX> const &rhs) noexcept -> bool
+    {
+        return lhs != rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() < rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() < rhs.get()
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator<(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> bool
+    {
+        return lhs.get() < rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() < rhs
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of lhs
+    ///   @tparam MAX the largest value of lhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() < rhs
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator<(bounded_integral<MIN, MAX> const &lhs, decltype(MIN) const rhs) noexcept -> bool
+    {
+        return lhs.get() < rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs < rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of rhs
+    ///   @tparam MAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs < rhs.get()
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator<(decltype(MIN) const lhs, bounded_integral<MIN, MAX> const &rhs) noexcept -> bool
+    {
+        return lhs < rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() > rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() > rhs.get()
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator>(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> bool
+    {
+        return lhs.get() > rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() > rhs
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of lhs
+    ///   @tparam MAX the largest value of lhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() > rhs
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator>(bounded_integral<MIN, MAX> const &lhs, decltype(MIN) const rhs) noexcept -> bool
+    {
+        return lhs.get() > rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs > rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of rhs
+    ///   @tparam MAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs > rhs.get()
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator>(decltype(MIN) const lhs, bounded_integral<MIN, MAX> const &rhs) noexcept -> bool
+    {
+        return lhs > rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() <= rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() <= rhs.get()
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator<=(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> bool
+    {
+        return lhs.get() <= rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() <= rhs
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of lhs
+    ///   @tparam MAX the largest value of lhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() <= rhs
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator<=(bounded_integral<MIN, MAX> const &lhs, decltype(MIN) const rhs) noexcept -> bool
+    {
+        return lhs.get() <= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs <= rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of rhs
+    ///   @tparam MAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs <= rhs.get()
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator<=(decltype(MIN) const lhs, bounded_integral<MIN, MAX> const &rhs) noexcept -> bool
+    {
+        return lhs <= rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() >= rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() >= rhs.get()
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator>=(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> bool
+    {
+        return lhs.get() >= rhs.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() >= rhs
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of lhs
+    ///   @tparam MAX the largest value of lhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() >= rhs
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator>=(bounded_integral<MIN, MAX> const &lhs, decltype(MIN) const rhs) noexcept -> bool
+    {
+        return lhs.get() >= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs >= rhs.get()
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value of rhs
+    ///   @tparam MAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs >= rhs.get()
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    operator>=(decltype(MIN) const lhs, bounded_integral<MIN, MAX> const &rhs) noexcept -> bool
+    {
+        return lhs >= rhs.get();
+    }
+
+    // -------------------------------------------------------------------------
+    // arithmetic operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns lhs + rhs. If the range of the sum can be
+    ///     represented by the underlying type, the result is a
+    ///     bsl::bounded_integral of that range and no check is performed.
+    ///     Otherwise, the result is lhs.to_safe() + rhs.to_safe().
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs + rhs
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator+(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> details::bounded_result_t<details::bounded_add_range(LMIN, LMAX, RMIN, RMAX)>
+    {
+        constexpr auto range{details::bounded_add_range(LMIN, LMAX, RMIN, RMAX)};
+
+        if constexpr (range.fits) {
+            return bounded_integral<range.lo, range.hi>{
+                details::bounded_unchecked, details::wrapping_policy::add(lhs.get(), rhs.get())};
+        }
+        else {
+            return lhs.to_safe() + rhs.to_safe();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs - rhs. If the range of the difference can be
+    ///     represented by the underlying type, the result is a
+    ///     bsl::bounded_integral of that range and no check is performed.
+    ///     Otherwise, the result is lhs.to_safe() - rhs.to_safe().
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs - rhs
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator-(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> details::bounded_result_t<details::bounded_sub_range(LMIN, LMAX, RMIN, RMAX)>
+    {
+        constexpr auto range{details::bounded_sub_range(LMIN, LMAX, RMIN, RMAX)};
+
+        if constexpr (range.fits) {
+            return bounded_integral<range.lo, range.hi>{
+                details::bounded_unchecked, details::wrapping_policy::sub(lhs.get(), rhs.get())};
+        }
+        else {
+            return lhs.to_safe() - rhs.to_safe();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs * rhs. If the range of the product can be
+    ///     represented by the underlying type, the result is a
+    ///     bsl::bounded_integral of that range and no check is performed.
+    ///     Otherwise, the result is lhs.to_safe() * rhs.to_safe().
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs * rhs
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator*(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> details::bounded_result_t<details::bounded_mul_range(LMIN, LMAX, RMIN, RMAX)>
+    {
+        constexpr auto range{details::bounded_mul_range(LMIN, LMAX, RMIN, RMAX)};
+
+        if constexpr (range.fits) {
+            return bounded_integral<range.lo, range.hi>{
+                details::bounded_unchecked, details::wrapping_policy::mul(lhs.get(), rhs.get())};
+        }
+        else {
+            return lhs.to_safe() * rhs.to_safe();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs / rhs. If the range of the quotient can be
+    ///     represented by the underlying type, the result is a
+    ///     bsl::bounded_integral of that range and no check is performed.
+    ///     Otherwise, the result is lhs.to_safe() / rhs.to_safe().
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs / rhs
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator/(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> details::bounded_result_t<details::bounded_div_range(LMIN, LMAX, RMIN, RMAX)>
+    {
+        constexpr auto range{details::bounded_div_range(LMIN, LMAX, RMIN, RMAX)};
+
+        if constexpr (range.fits) {
+            return bounded_integral<range.lo, range.hi>{
+                details::bounded_unchecked, details::wrapping_policy::div(lhs.get(), rhs.get())};
+        }
+        else {
+            return lhs.to_safe() / rhs.to_safe();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs % rhs. If the range of the remainder can be
+    ///     represented by the underlying type, the result is a
+    ///     bsl::bounded_integral of that range and no check is performed.
+    ///     Otherwise, the result is lhs.to_safe() % rhs.to_safe().
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs % rhs
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator%(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> details::bounded_result_t<details::bounded_mod_range(LMIN, LMAX, RMIN, RMAX)>
+    {
+        constexpr auto range{details::bounded_mod_range(LMIN, LMAX, RMIN, RMAX)};
+
+        if constexpr (range.fits) {
+            return bounded_integral<range.lo, range.hi>{
+                details::bounded_unchecked, details::wrapping_policy::mod(lhs.get(), rhs.get())};
+        }
+        else {
+            return lhs.to_safe() % rhs.to_safe();
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // bitwise operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns lhs & rhs. The result of a bitwise and can never
+    ///     be larger than either side, so the result is always a
+    ///     bsl::bounded_integral in [0, min(LMAX, RMAX)]. This is useful
+    ///     for masking (e.g., getting the offset into a page).
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LMIN the smallest value of lhs
+    ///   @tparam LMAX the largest value of lhs
+    ///   @tparam RMIN the smallest value of rhs
+    ///   @tparam RMAX the largest value of rhs
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs & rhs
+    ///
+    template<auto LMIN, decltype(LMIN) LMAX, decltype(LMIN) RMIN, decltype(LMIN) RMAX>
+    [[nodiscard]] constexpr auto
+    operator&(
+        bounded_integral<LMIN, LMAX> const &lhs, bounded_integral<RMIN, RMAX> const &rhs) noexcept
+        -> details::bounded_result_t<details::bounded_and_range(LMIN, LMAX, RMIN, RMAX)>
+    {
+        using value_type = decltype(LMIN);
+        constexpr auto range{details::bounded_and_range(LMIN, LMAX, RMIN, RMAX)};
+
+        if constexpr (is_signed<value_type>::value) {
+            static_assert(always_false<value_type>(), "signed and not supported");
+        }
+        else {
+            return bounded_integral<range.lo, range.hi>{
+                details::bounded_unchecked, static_cast<value_type>(lhs.get() & rhs.get())};
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // helpers
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns a bsl::bounded_integral<V, V> that stores V. This
+    ///     is how constants are mixed with bsl::bounded_integrals, as it
+    ///     tells the compiler the exact range of the constant.
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam V the value of the constant
+    ///   @return Returns a bsl::bounded_integral<V, V> that stores V.
+    ///
+    template<auto V>
+    [[nodiscard]] constexpr auto
+    bounded_constant() noexcept -> bounded_integral<V, V>
+    {
+        return bounded_integral<V, V>{};
+    }
+
+    // -------------------------------------------------------------------------
+    // supported bounded_integral types
+    // -------------------------------------------------------------------------
+
+    /// @brief provides the bsl::bounded_integral version of bsl::int8
+    template<bsl::int8 MIN, bsl::int8 MAX>
+    using bounded_int8 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::int16
+    template<bsl::int16 MIN, bsl::int16 MAX>
+    using bounded_int16 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::int32
+    template<bsl::int32 MIN, bsl::int32 MAX>
+    using bounded_int32 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::int64
+    template<bsl::int64 MIN, bsl::int64 MAX>
+    using bounded_int64 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::intmax
+    template<bsl::intmax MIN, bsl::intmax MAX>
+    using bounded_intmax = bounded_integral<MIN, MAX>;
+
+    /// @brief provides the bsl::bounded_integral version of bsl::uint8
+    template<bsl::uint8 MIN, bsl::uint8 MAX>
+    using bounded_uint8 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::uint16
+    template<bsl::uint16 MIN, bsl::uint16 MAX>
+    using bounded_uint16 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::uint32
+    template<bsl::uint32 MIN, bsl::uint32 MAX>
+    using bounded_uint32 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::uint64
+    template<bsl::uint64 MIN, bsl::uint64 MAX>
+    using bounded_uint64 = bounded_integral<MIN, MAX>;
+    /// @brief provides the bsl::bounded_integral version of bsl::uintmax
+    template<bsl::uintmax MIN, bsl::uintmax MAX>
+    using bounded_uintmax = bounded_integral<MIN, MAX>;
+}
+
+#endif
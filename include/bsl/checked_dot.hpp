@@ -0,0 +1,179 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file checked_dot.hpp
+///
+
+#ifndef BSL_CHECKED_DOT_HPP
+#define BSL_CHECKED_DOT_HPP
+
+#include "cstdint.hpp"
+#include "details/checked_state.hpp"
+#include "numeric_limits.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Adds the products of the block of elements that starts
+        ///     at "pos" to the state of a checked dot product.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral being multiplied
+        ///   @param mut_state the state of the checked dot product
+        ///   @param lhs the left hand side elements
+        ///   @param rhs the right hand side elements
+        ///   @param pos the index of the first element in the block
+        ///
+        template<typename T>
+        constexpr void
+        checked_dot_block(
+            checked_state<T> &mut_state,
+            span<safe_integral<T> const> const &lhs,
+            span<safe_integral<T> const> const &rhs,
+            safe_uintmax const &pos) noexcept
+        {
+            constexpr bsl::uintmax factors{static_cast<bsl::uintmax>(2)};
+
+            // The block is bounds checked once, and then its elements are
+            // read directly so that the loop does not branch.
+            auto const *const lblk{lhs.at_if(pos)};
+            auto const *const rblk{rhs.at_if(pos)};
+            bsl::uintmax const len{checked_block_size(pos, lhs.size()).get()};
+
+            if constexpr (checked_use_blocked<T, factors>()) {
+                constexpr bsl::uintmax max{static_cast<bsl::uintmax>(numeric_limits<T>::max())};
+
+                bsl::uintmax mut_sum{};
+                bsl::uintmax mut_carries{};
+                bsl::uintmax mut_ovf{};
+                for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    T const l{checked_raw(mut_state, lblk[mut_i])};
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    T const r{checked_raw(mut_state, rblk[mut_i])};
+
+                    bsl::uintmax const prod{static_cast<bsl::uintmax>(l) * r};
+                    mut_ovf |= static_cast<bsl::uintmax>(prod > max);
+                    checked_add_carry(mut_sum, mut_carries, prod);
+                }
+
+                mut_state.overflow |= mut_ovf;
+                checked_add_block(mut_state, mut_sum, mut_carries);
+            }
+            else {
+                for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    T const l{checked_raw(mut_state, lblk[mut_i])};
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    T const r{checked_raw(mut_state, rblk[mut_i])};
+
+                    T mut_prod{};
+                    // This is how Clang presents the builtins, which we are
+                    // required top use.
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+                    bool const ovf{__builtin_mul_overflow(l, r, &mut_prod)};
+                    mut_state.overflow |= static_cast<bsl::uintmax>(ovf);
+                    checked_add(mut_state, mut_prod);
+                }
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the dot product of the provided elements (i.e.,
+    ///     the sum of lhs[i] * rhs[i]). The result is exactly the same as
+    ///     adding each product to a bsl::safe_integral<T>, including being
+    ///     invalid if any of the elements are invalid, or if any of the
+    ///     multiplies or adds would overflow. Instead of checking each
+    ///     multiply and add, the products are accumulated in blocks (using
+    ///     a bsl::uintmax and a carry count for unsigned types whose
+    ///     products fit in a bsl::uintmax), and are only checked once per
+    ///     block, which allows the compiler to vectorize the
+    ///     loop. If lhs and rhs are not the same size,
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_checked_dot_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being multiplied
+    ///   @param lhs the left hand side elements
+    ///   @param rhs the right hand side elements
+    ///   @return Returns the dot product of the provided elements, or
+    ///     bsl::safe_integral<T>::failure() on error.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_dot(
+        span<safe_integral<T> const> const &lhs, span<safe_integral<T> const> const &rhs) noexcept
+        -> safe_integral<T>
+    {
+        if (unlikely(lhs.size() != rhs.size())) {
+            unlikely_invalid_argument_failure();
+            return safe_integral<T>::failure();
+        }
+
+        details::checked_state<T> mut_state{};
+        for (safe_uintmax mut_i{}; mut_i < lhs.size(); mut_i += details::CHECKED_BLOCK_SIZE) {
+            details::checked_dot_block(mut_state, lhs, rhs, mut_i);
+            if (unlikely(details::checked_failed(mut_state))) {
+                break;
+            }
+
+            bsl::touch();
+        }
+
+        return details::checked_result(mut_state);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the dot product of the provided elements (i.e.,
+    ///     the sum of lhs[i] * rhs[i]). The result is exactly the same as
+    ///     adding each product to a bsl::safe_integral<T>. If lhs and rhs
+    ///     are not the same size, bsl::safe_integral<T>::failure() is
+    ///     returned.
+    ///   @include example_checked_dot_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being multiplied
+    ///   @param lhs the left hand side elements
+    ///   @param rhs the right hand side elements
+    ///   @return Returns the dot product of the provided elements, or
+    ///     bsl::safe_integral<T>::failure() on error.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_dot(span<safe_integral<T>> const &lhs, span<safe_integral<T>> const &rhs) noexcept
+        -> safe_integral<T>
+    {
+        return checked_dot(
+            span<safe_integral<T> const>{lhs.data(), lhs.size()},
+            span<safe_integral<T> const>{rhs.data(), rhs.size()});
+    }
+}
+
+#endif
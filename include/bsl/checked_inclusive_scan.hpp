@@ -0,0 +1,156 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file checked_inclusive_scan.hpp
+///
+
+#ifndef BSL_CHECKED_INCLUSIVE_SCAN_HPP
+#define BSL_CHECKED_INCLUSIVE_SCAN_HPP
+
+#include "cstdint.hpp"
+#include "details/checked_state.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Stores the prefix sums of the block of elements that
+        ///     starts at "pos". The block is bounds checked once, and then
+        ///     its elements are read and written directly, and the
+        ///     validity of each prefix sum comes from the state's sticky
+        ///     flags, so the loop does not branch. Each element is read
+        ///     before its prefix sum is written, so vals and res can be
+        ///     the same elements. Once the scan has failed, the rest of
+        ///     the prefix sums are invalid, and the elements are no longer
+        ///     read.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral being summed
+        ///   @param mut_state the state of the checked scan
+        ///   @param vals the elements to sum
+        ///   @param mut_res where to store the prefix sums
+        ///   @param pos the index of the first element in the block
+        ///
+        template<typename T>
+        constexpr void
+        checked_inclusive_scan_block(
+            checked_state<T> &mut_state,
+            span<safe_integral<T> const> const &vals,
+            span<safe_integral<T>> &mut_res,
+            safe_uintmax const &pos) noexcept
+        {
+            auto const *const src{vals.at_if(pos)};
+            auto *const pmut_dst{mut_res.at_if(pos)};
+            bsl::uintmax const len{checked_block_size(pos, vals.size()).get()};
+
+            if (checked_failed(mut_state)) {
+                for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    pmut_dst[mut_i] = safe_integral<T>::failure();
+                }
+
+                return;
+            }
+
+            for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                checked_add(mut_state, checked_raw(mut_state, src[mut_i]));
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                pmut_dst[mut_i] = safe_integral<T>{mut_state.sum, checked_failed(mut_state)};
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the inclusive prefix sums of "vals" in "res"
+    ///     (i.e., res[i] is the sum of vals[0] through vals[i]) and
+    ///     returns the total sum. The results are exactly the same as
+    ///     adding each element to a bsl::safe_integral<T> and storing the
+    ///     bsl::safe_integral<T> after each add, meaning that once an
+    ///     element is invalid or an add overflows, that prefix sum and all
+    ///     of the prefix sums that follow it are invalid. Instead of
+    ///     checking each add, the elements are processed in blocks, and
+    ///     the validity of each prefix sum comes from sticky flags, so
+    ///     the loop does not branch. If res is smaller than vals, nothing
+    ///     is stored and bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_checked_inclusive_scan_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being summed
+    ///   @param vals the elements to sum
+    ///   @param res where to store the prefix sums
+    ///   @return Returns the sum of the provided elements, or
+    ///     bsl::safe_integral<T>::failure() on error.
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr auto
+    checked_inclusive_scan(
+        span<safe_integral<T> const> const &vals, span<safe_integral<T>> const &res) noexcept
+        -> safe_integral<T>
+    {
+        if (unlikely(res.size() < vals.size())) {
+            unlikely_invalid_argument_failure();
+            return safe_integral<T>::failure();
+        }
+
+        span<safe_integral<T>> mut_res{res};
+        details::checked_state<T> mut_state{};
+        for (safe_uintmax mut_i{}; mut_i < vals.size(); mut_i += details::CHECKED_BLOCK_SIZE) {
+            details::checked_inclusive_scan_block(mut_state, vals, mut_res, mut_i);
+        }
+
+        return details::checked_result(mut_state);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the inclusive prefix sums of "vals" in "res"
+    ///     (i.e., res[i] is the sum of vals[0] through vals[i]) and
+    ///     returns the total sum. The results are exactly the same as
+    ///     adding each element to a bsl::safe_integral<T> and storing the
+    ///     bsl::safe_integral<T> after each add.
+    ///   @include example_checked_inclusive_scan_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being summed
+    ///   @param vals the elements to sum
+    ///   @param res where to store the prefix sums
+    ///   @return Returns the sum of the provided elements, or
+    ///     bsl::safe_integral<T>::failure() on error.
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr auto
+    checked_inclusive_scan(
+        span<safe_integral<T>> const &vals, span<safe_integral<T>> const &res) noexcept
+        -> safe_integral<T>
+    {
+        return checked_inclusive_scan(
+            span<safe_integral<T> const>{vals.data(), vals.size()}, res);
+    }
+}
+
+#endif
@@ -0,0 +1,140 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file checked_sum.hpp
+///
+
+#ifndef BSL_CHECKED_SUM_HPP
+#define BSL_CHECKED_SUM_HPP
+
+#include "cstdint.hpp"
+#include "details/checked_state.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Adds the block of elements that starts at "pos" to the
+        ///     state of a checked sum.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral being summed
+        ///   @param mut_state the state of the checked sum
+        ///   @param vals the elements being summed
+        ///   @param pos the index of the first element in the block
+        ///
+        template<typename T>
+        constexpr void
+        checked_sum_block(
+            checked_state<T> &mut_state,
+            span<safe_integral<T> const> const &vals,
+            safe_uintmax const &pos) noexcept
+        {
+            constexpr bsl::uintmax factors{static_cast<bsl::uintmax>(1)};
+
+            // The block is bounds checked once, and then its elements are
+            // read directly so that the loop does not branch.
+            auto const *const blk{vals.at_if(pos)};
+            bsl::uintmax const len{checked_block_size(pos, vals.size()).get()};
+
+            if constexpr (checked_use_blocked<T, factors>()) {
+                bsl::uintmax mut_sum{};
+                bsl::uintmax mut_carries{};
+                for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    T const val{checked_raw(mut_state, blk[mut_i])};
+                    checked_add_carry(mut_sum, mut_carries, static_cast<bsl::uintmax>(val));
+                }
+
+                checked_add_block(mut_state, mut_sum, mut_carries);
+            }
+            else {
+                for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    checked_add(mut_state, checked_raw(mut_state, blk[mut_i]));
+                }
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the sum of the provided elements. The result is
+    ///     exactly the same as adding each element to a
+    ///     bsl::safe_integral<T>, including being invalid if any of the
+    ///     elements are invalid, or if any of the adds would overflow.
+    ///     Instead of checking each add, the sum is accumulated in blocks
+    ///     (using a bsl::uintmax and a carry count for unsigned types),
+    ///     and is only checked once per block, which allows the compiler
+    ///     to vectorize the loop.
+    ///   @include example_checked_sum_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being summed
+    ///   @param vals the elements to sum
+    ///   @return Returns the sum of the provided elements, or
+    ///     bsl::safe_integral<T>::failure() on error.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_sum(span<safe_integral<T> const> const &vals) noexcept -> safe_integral<T>
+    {
+        details::checked_state<T> mut_state{};
+        for (safe_uintmax mut_i{}; mut_i < vals.size(); mut_i += details::CHECKED_BLOCK_SIZE) {
+            details::checked_sum_block(mut_state, vals, mut_i);
+            if (unlikely(details::checked_failed(mut_state))) {
+                break;
+            }
+
+            bsl::touch();
+        }
+
+        return details::checked_result(mut_state);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the sum of the provided elements. The result is
+    ///     exactly the same as adding each element to a
+    ///     bsl::safe_integral<T>, including being invalid if any of the
+    ///     elements are invalid, or if any of the adds would overflow.
+    ///   @include example_checked_sum_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being summed
+    ///   @param vals the elements to sum
+    ///   @return Returns the sum of the provided elements, or
+    ///     bsl::safe_integral<T>::failure() on error.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_sum(span<safe_integral<T>> const &vals) noexcept -> safe_integral<T>
+    {
+        return checked_sum(span<safe_integral<T> const>{vals.data(), vals.size()});
+    }
+}
+
+#endif
@@ -22,6 +22,7 @@
 #ifndef BSL_CONVERT_HPP
 #define BSL_CONVERT_HPP
 
+#include "bounded_integral.hpp"
 #include "conditional.hpp"
 #include "cstr_type.hpp"
 #include "enable_if.hpp"
@@ -35,8 +36,10 @@
 #include "is_signed.hpp"
 #include "is_unsigned.hpp"
 #include "numeric_limits.hpp"
+#include "policy_integral.hpp"
 #include "safe_integral.hpp"
 #include "string_view.hpp"
+#include "touch.hpp"
 #include "unlikely.hpp"
 
 namespace bsl
@@ -82,6 +85,9 @@ namespace bsl
     {
         using t_limits = numeric_limits<T>;
         using f_limits = numeric_limits<F>;
+        using wide_type = conditional_t<(sizeof(T) < sizeof(F)), F, T>;
+        using smax_type = details::safe_integral_smax_t<wide_type>;
+        using umax_type = details::safe_integral_umax_t<wide_type>;
 
         if constexpr (is_same<F, T>::value) {
             return safe_integral<T>{static_cast<T>(val)};
@@ -89,9 +95,9 @@ namespace bsl
 
         if constexpr (is_signed<F>::value) {
             if constexpr (is_signed<T>::value) {
-                constexpr bsl::intmax t_max{static_cast<bsl::intmax>(t_limits::max())};
-                constexpr bsl::intmax t_min{static_cast<bsl::intmax>(t_limits::min())};
-                constexpr bsl::intmax f_max{static_cast<bsl::intmax>(f_limits::max())};
+                constexpr smax_type t_max{static_cast<smax_type>(t_limits::max())};
+                constexpr smax_type t_min{static_cast<smax_type>(t_limits::min())};
+                constexpr smax_type f_max{static_cast<smax_type>(f_limits::max())};
 
                 if constexpr (f_max < t_max) {
                     return safe_integral<T>{static_cast<T>(val)};
@@ -100,12 +106,12 @@ namespace bsl
                     return safe_integral<T>{static_cast<T>(val)};
                 }
                 else {
-                    if (unlikely(static_cast<bsl::intmax>(val) > t_max)) {
+                    if (unlikely(static_cast<smax_type>(val) > t_max)) {
                         conversion_failure_narrowing_results_in_loss_of_data();
                         return safe_integral<T>::failure();
                     }
 
-                    if (unlikely(static_cast<bsl::intmax>(val) < t_min)) {
+                    if (unlikely(static_cast<smax_type>(val) < t_min)) {
                         conversion_failure_narrowing_results_in_loss_of_data();
                         return safe_integral<T>::failure();
                     }
@@ -114,10 +120,10 @@ namespace bsl
                 }
             }
             else {
-                constexpr bsl::uintmax t_max{static_cast<bsl::uintmax>(t_limits::max())};
-                constexpr bsl::uintmax f_max{static_cast<bsl::uintmax>(f_limits::max())};
+                constexpr umax_type t_max{static_cast<umax_type>(t_limits::max())};
+                constexpr umax_type f_max{static_cast<umax_type>(f_limits::max())};
 
-                if (unlikely(static_cast<bsl::intmax>(val) < static_cast<bsl::intmax>(0))) {
+                if (unlikely(static_cast<smax_type>(val) < static_cast<smax_type>(0))) {
                     conversion_failure_narrowing_results_in_loss_of_data();
                     return safe_integral<T>::failure();
                 }
@@ -129,7 +135,7 @@ namespace bsl
                     return safe_integral<T>{static_cast<T>(val)};
                 }
                 else {
-                    if (unlikely(static_cast<bsl::uintmax>(val) > t_max)) {
+                    if (unlikely(static_cast<umax_type>(val) > t_max)) {
                         conversion_failure_narrowing_results_in_loss_of_data();
                         return safe_integral<T>::failure();
                     }
@@ -140,8 +146,8 @@ namespace bsl
         }
         else {
             if constexpr (is_signed<T>::value) {
-                constexpr bsl::uintmax t_max{static_cast<bsl::uintmax>(t_limits::max())};
-                constexpr bsl::uintmax f_max{static_cast<bsl::uintmax>(f_limits::max())};
+                constexpr umax_type t_max{static_cast<umax_type>(t_limits::max())};
+                constexpr umax_type f_max{static_cast<umax_type>(f_limits::max())};
 
                 if constexpr (f_max < t_max) {
                     return safe_integral<T>{static_cast<T>(val)};
@@ -150,7 +156,7 @@ namespace bsl
                     return safe_integral<T>{static_cast<T>(val)};
                 }
                 else {
-                    if (unlikely(static_cast<bsl::uintmax>(val) > t_max)) {
+                    if (unlikely(static_cast<umax_type>(val) > t_max)) {
                         conversion_failure_narrowing_results_in_loss_of_data();
                         return safe_integral<T>::failure();
                     }
@@ -159,8 +165,8 @@ namespace bsl
                 }
             }
             else {
-                constexpr bsl::uintmax t_max{static_cast<bsl::uintmax>(t_limits::max())};
-                constexpr bsl::uintmax f_max{static_cast<bsl::uintmax>(f_limits::max())};
+                constexpr umax_type t_max{static_cast<umax_type>(t_limits::max())};
+                constexpr umax_type f_max{static_cast<umax_type>(f_limits::max())};
 
                 if constexpr (f_max < t_max) {
                     return safe_integral<T>{static_cast<T>(val)};
@@ -169,7 +175,7 @@ namespace bsl
                     return safe_integral<T>{static_cast<T>(val)};
                 }
                 else {
-                    if (unlikely(static_cast<bsl::uintmax>(val) > t_max)) {
+                    if (unlikely(static_cast<umax_type>(val) > t_max)) {
                         conversion_failure_narrowing_results_in_loss_of_data();
                         return safe_integral<T>::failure();
                     }
@@ -210,6 +216,104 @@ namespace bsl
         return convert<T>(val.get());
     }
 
+    /// <!-- description -->
+    ///   @brief Converts from a bsl::policy_integral of type F to a
+    ///     bsl::safe_integral of type T. A bsl::policy_integral is always
+    ///     valid, so this is the same as converting the value returned by
+    ///     get(), which means a narrowing conversion that results in a
+    ///     loss of data returns an invalid bsl::safe_integral.
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam F the integral type to convert from
+    ///   @tparam T the integral type to convert to
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param val the integral to convert from F to T
+    ///   @return Returns f converted from F to T
+    ///
+    template<typename T, typename F, typename P>
+    [[nodiscard]] constexpr auto
+    convert(policy_integral<F, P> const &val) noexcept -> safe_integral<T>
+    {
+        return convert<T>(val.get());
+    }
+
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns true if val can be converted to T without a
+        ///     loss of data. Unlike bsl::convert, this does not report an
+        ///     error, so it can be used to make decisions at compile-time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the integral type to convert to
+        ///   @tparam F the integral type to convert from
+        ///   @param val the integral to check
+        ///   @return Returns true if val can be converted to T without a
+        ///     loss of data.
+        ///
+        template<typename T, typename F>
+        [[nodiscard]] constexpr auto
+        convert_fits(F const val) noexcept -> bool
+        {
+            using wide_type = conditional_t<(sizeof(T) < sizeof(F)), F, T>;
+            using smax_type = details::safe_integral_smax_t<wide_type>;
+            using umax_type = details::safe_integral_umax_t<wide_type>;
+
+            if constexpr (is_signed<F>::value) {
+                if (static_cast<smax_type>(val) < static_cast<smax_type>(0)) {
+                    if constexpr (is_signed<T>::value) {
+                        return static_cast<smax_type>(val) >=
+                               static_cast<smax_type>(numeric_limits<T>::min());
+                    }
+                    else {
+                        return false;
+                    }
+                }
+
+                bsl::touch();
+            }
+
+            return static_cast<umax_type>(val) <=
+                   static_cast<umax_type>(numeric_limits<T>::max());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts from a bsl::bounded_integral to a bsl::safe_integral
+    ///     of type T. If every value in [MIN, MAX] can be represented by T,
+    ///     which is known at compile-time, this conversion is free (i.e.,
+    ///     no check is performed). Otherwise this is the same as
+    ///     converting the value returned by get().
+    ///   @related bsl::bounded_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to convert to
+    ///   @tparam MIN the smallest value of val
+    ///   @tparam MAX the largest value of val
+    ///   @param val the integral to convert to T
+    ///   @return Returns val converted to T
+    ///
+    template<typename T, auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    convert(bounded_integral<MIN, MAX> const &val) noexcept -> safe_integral<T>
+    {
+        constexpr bool min_fits{details::convert_fits<T>(MIN)};
+        constexpr bool max_fits{details::convert_fits<T>(MAX)};
+
+        if constexpr (min_fits) {
+            if constexpr (max_fits) {
+                return safe_integral<T>{static_cast<T>(val.get())};
+            }
+            else {
+                return convert<T>(val.get());
+            }
+        }
+        else {
+            return convert<T>(val.get());
+        }
+    }
+
     // -------------------------------------------------------------------------
     // predefined conversion functions
     // -------------------------------------------------------------------------
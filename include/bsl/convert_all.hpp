@@ -0,0 +1,266 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file convert_all.hpp
+///
+
+#ifndef BSL_CONVERT_ALL_HPP
+#define BSL_CONVERT_ALL_HPP
+
+#include "convert.hpp"
+#include "cstdint.hpp"
+#include "is_integral.hpp"
+#include "numeric_limits.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief stores the total number of elements range checked at once
+        constexpr safe_uintmax CONVERT_ALL_BLOCK_SIZE{static_cast<bsl::uintmax>(64)};
+
+        /// <!-- description -->
+        ///   @brief Returns true if every F can be converted to T without a
+        ///     loss of data, in which case no range check is needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the integral type to convert to
+        ///   @tparam F the integral type to convert from
+        ///   @return Returns true if every F can be converted to T
+        ///
+        template<typename T, typename F>
+        [[nodiscard]] constexpr auto
+        convert_all_always_fits() noexcept -> bool
+        {
+            constexpr bool min_fits{convert_fits<T>(numeric_limits<F>::min())};
+            constexpr bool max_fits{convert_fits<T>(numeric_limits<F>::max())};
+
+            if constexpr (min_fits) {
+                return max_fits;
+            }
+            else {
+                return false;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every element in the provided block can
+        ///     be converted to T without a loss of data. Instead of checking
+        ///     each element, the smallest and largest elements are found
+        ///     (which the compiler vectorizes into SIMD min/max reductions),
+        ///     and only these are checked. For unsigned F, only the largest
+        ///     element needs to be found.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the integral type to convert to
+        ///   @tparam F the integral type to convert from
+        ///   @param src the first element in the block
+        ///   @param len the total number of elements in the block
+        ///   @return Returns true if every element in the block can be
+        ///     converted to T without a loss of data.
+        ///
+        template<typename T, typename F>
+        [[nodiscard]] constexpr auto
+        convert_all_block_fits(F const *const src, bsl::uintmax const len) noexcept -> bool
+        {
+            F mut_min{};
+            F mut_max{};
+
+            for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                F const val{src[mut_i]};
+                if (val < mut_min) {
+                    mut_min = val;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (val > mut_max) {
+                    mut_max = val;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (!convert_fits<T>(mut_min)) {
+                return false;
+            }
+
+            return convert_fits<T>(mut_max);
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts each element in the provided block from F to
+        ///     T without checking. The compiler vectorizes this into SIMD
+        ///     pack (narrowing) or extend (widening) instructions.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the integral type to convert to
+        ///   @tparam F the integral type to convert from
+        ///   @param src the first element in the block to convert from
+        ///   @param pmut_dst the first element in the block to convert to
+        ///   @param len the total number of elements in the block
+        ///
+        template<typename T, typename F>
+        constexpr void
+        convert_all_block(F const *const src, T *const pmut_dst, bsl::uintmax const len) noexcept
+        {
+            for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                pmut_dst[mut_i] = static_cast<T>(src[mut_i]);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts each element in the provided block from F to
+        ///     T, checking each element, and returns the index of the
+        ///     first element that cannot be converted without a loss of
+        ///     data. The elements before this element are converted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the integral type to convert to
+        ///   @tparam F the integral type to convert from
+        ///   @param src the first element in the block to convert from
+        ///   @param pmut_dst the first element in the block to convert to
+        ///   @param len the total number of elements in the block
+        ///   @return Returns the index of the first element in the block
+        ///     that cannot be converted, or len if there is none.
+        ///
+        template<typename T, typename F>
+        [[nodiscard]] constexpr auto
+        convert_all_block_checked(
+            F const *const src, T *const pmut_dst, bsl::uintmax const len) noexcept -> bsl::uintmax
+        {
+            for (bsl::uintmax mut_i{}; mut_i < len; ++mut_i) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                F const val{src[mut_i]};
+                if (!convert_fits<T>(val)) {
+                    return mut_i;
+                }
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                pmut_dst[mut_i] = static_cast<T>(val);
+            }
+
+            return len;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts each element in src from F to T, storing the
+    ///     results in dst, and returns the total number of elements
+    ///     that were converted. The result is exactly the same as calling
+    ///     bsl::convert<T> on each element in order and stopping at the
+    ///     first element that results in a loss of data, which is
+    ///     reported the same way bsl::convert reports it. As a result, if
+    ///     the returned value is less than src.size(), it is the index of
+    ///     the first element that could not be converted, and only the
+    ///     elements before it were converted. Instead of checking each
+    ///     element, each block of elements is range checked once using
+    ///     its smallest and largest elements, and if the conversion is
+    ///     always safe (e.g., widening), no check is performed at all,
+    ///     which allows the compiler to vectorize the loops. If dst is
+    ///     smaller than src, nothing is converted, and
+    ///     bsl::safe_uintmax::failure() is returned.
+    ///   @include example_convert_all_overview.hpp
+    ///   @related bsl::convert
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to convert to
+    ///   @tparam F the integral type to convert from
+    ///   @param src the elements to convert
+    ///   @param dst where to store the converted elements
+    ///   @return Returns the total number of elements converted, or
+    ///     bsl::safe_uintmax::failure() on error.
+    ///
+    template<typename T, typename F>
+    [[nodiscard]] constexpr auto
+    convert_all(span<F const> const &src, span<T> const &dst) noexcept -> safe_uintmax
+    {
+        static_assert(is_integral<F>::value, "only integral types are supported");
+        static_assert(is_integral<T>::value, "only integral types are supported");
+
+        if (unlikely(dst.size() < src.size())) {
+            unlikely_invalid_argument_failure();
+            return safe_uintmax::failure();
+        }
+
+        if (src.empty()) {
+            return src.size();
+        }
+
+        span<T> mut_dst{dst};
+        for (safe_uintmax mut_i{}; mut_i < src.size(); mut_i += details::CONVERT_ALL_BLOCK_SIZE) {
+            safe_uintmax const len{(src.size() - mut_i).min(details::CONVERT_ALL_BLOCK_SIZE)};
+            F const *const blk_src{src.at_if(mut_i)};
+            T *const pmut_blk_dst{mut_dst.at_if(mut_i)};
+
+            if constexpr (details::convert_all_always_fits<T, F>()) {
+                details::convert_all_block(blk_src, pmut_blk_dst, len.get());
+            }
+            else {
+                if (unlikely(!details::convert_all_block_fits<T>(blk_src, len.get()))) {
+                    safe_uintmax const idx{
+                        details::convert_all_block_checked(blk_src, pmut_blk_dst, len.get())};
+
+                    conversion_failure_narrowing_results_in_loss_of_data();
+                    return mut_i + idx;
+                }
+
+                details::convert_all_block(blk_src, pmut_blk_dst, len.get());
+            }
+        }
+
+        return src.size();
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as bsl::convert_all, but for a non-const span of
+    ///     elements to convert.
+    ///   @include example_convert_all_overview.hpp
+    ///   @related bsl::convert
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to convert to
+    ///   @tparam F the integral type to convert from
+    ///   @param src the elements to convert
+    ///   @param dst where to store the converted elements
+    ///   @return Returns the total number of elements converted, or
+    ///     bsl::safe_uintmax::failure() on error.
+    ///
+    template<typename T, typename F>
+    [[nodiscard]] constexpr auto
+    convert_all(span<F> const &src, span<T> const &dst) noexcept -> safe_uintmax
+    {
+        return convert_all(span<F const>{src.data(), src.size()}, dst);
+    }
+}
+
+#endif
@@ -53,6 +53,14 @@ namespace bsl
     using uint32 = ::uint32_t;
     /// @brief defines an 64bit unsigned integer
     using uint64 = ::uint64_t;
+    /// @brief defines an 128bit signed integer. This is a compiler
+    ///   extension provided by Clang and GCC on 64bit targets.
+    // NOLINTNEXTLINE(bsl-types-fixed-width-ints)
+    using int128 = __int128_t;
+    /// @brief defines an 128bit unsigned integer. This is a compiler
+    ///   extension provided by Clang and GCC on 64bit targets.
+    // NOLINTNEXTLINE(bsl-types-fixed-width-ints)
+    using uint128 = __uint128_t;
 
     /// @brief defines at least an 8bit signed integer
     using int_least8 = ::int_least8_t;
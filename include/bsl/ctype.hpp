@@ -0,0 +1,310 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file ctype.hpp
+///
+
+#ifndef BSL_CTYPE_HPP
+#define BSL_CTYPE_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "cstdint.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief defines the total number of possible char_type values
+        constexpr bsl::uintmax CTYPE_TABLE_SIZE{static_cast<bsl::uintmax>(256)};
+
+        /// @brief defines the class bit for whitespace characters
+        constexpr bsl::safe_uint8 CTYPE_SPACE{static_cast<bsl::uint8>(0x01)};
+        /// @brief defines the class bit for decimal digits
+        constexpr bsl::safe_uint8 CTYPE_DIGIT{static_cast<bsl::uint8>(0x02)};
+        /// @brief defines the class bit for hexadecimal digits
+        constexpr bsl::safe_uint8 CTYPE_XDIGIT{static_cast<bsl::uint8>(0x04)};
+        /// @brief defines the class bit for alphabetic characters
+        constexpr bsl::safe_uint8 CTYPE_ALPHA{static_cast<bsl::uint8>(0x08)};
+        /// @brief defines the class bit for punctuation characters
+        constexpr bsl::safe_uint8 CTYPE_PUNCT{static_cast<bsl::uint8>(0x10)};
+
+        /// @brief defines the digit value of a character that is not a digit
+        constexpr bsl::safe_uint8 CTYPE_NOT_A_DIGIT{static_cast<bsl::uint8>(0xFF)};
+
+        /// <!-- description -->
+        ///   @brief Returns the index into the ctype tables for the
+        ///     provided character.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to get the index for
+        ///   @return Returns the index into the ctype tables for the
+        ///     provided character.
+        ///
+        [[nodiscard]] constexpr auto
+        ctype_idx(char_type const c) noexcept -> safe_uintmax
+        {
+            return safe_uintmax{static_cast<bsl::uintmax>(static_cast<bsl::uint8>(c))};
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds the provided class bits to every character in the
+        ///     range [first, last] of the provided class table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_table the class table to modify
+        ///   @param first the first character in the range
+        ///   @param last the last character in the range
+        ///   @param bits the class bits to add
+        ///
+        constexpr void
+        ctype_add_class(
+            array<bsl::uint8, CTYPE_TABLE_SIZE> &mut_table,
+            char_type const first,
+            char_type const last,
+            safe_uint8 const &bits) noexcept
+        {
+            for (safe_uintmax mut_i{ctype_idx(first)}; mut_i <= ctype_idx(last); ++mut_i) {
+                auto *const pmut_elem{mut_table.at_if(mut_i)};
+                *pmut_elem = (safe_uint8{*pmut_elem} | bits).get();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the digit value of every character in the range
+        ///     [first, last] of the provided digit table, starting at
+        ///     the provided value.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_table the digit table to modify
+        ///   @param first the first character in the range
+        ///   @param last the last character in the range
+        ///   @param val the digit value of the first character in the range
+        ///
+        constexpr void
+        ctype_add_digits(
+            array<bsl::uint8, CTYPE_TABLE_SIZE> &mut_table,
+            char_type const first,
+            char_type const last,
+            safe_uint8 const &val) noexcept
+        {
+            safe_uint8 mut_val{val};
+            for (safe_uintmax mut_i{ctype_idx(first)}; mut_i <= ctype_idx(last); ++mut_i) {
+                *mut_table.at_if(mut_i) = mut_val.get();
+                ++mut_val;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the character class table. Each entry is a
+        ///     bitmask of the CTYPE_xxx class bits.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the character class table.
+        ///
+        [[nodiscard]] constexpr auto
+        ctype_make_class_table() noexcept -> array<bsl::uint8, CTYPE_TABLE_SIZE>
+        {
+            array<bsl::uint8, CTYPE_TABLE_SIZE> mut_table{};
+
+            ctype_add_class(mut_table, '\t', '\r', CTYPE_SPACE);
+            ctype_add_class(mut_table, ' ', ' ', CTYPE_SPACE);
+            ctype_add_class(mut_table, '0', '9', CTYPE_DIGIT | CTYPE_XDIGIT);
+            ctype_add_class(mut_table, 'A', 'F', CTYPE_XDIGIT);
+            ctype_add_class(mut_table, 'a', 'f', CTYPE_XDIGIT);
+            ctype_add_class(mut_table, 'A', 'Z', CTYPE_ALPHA);
+            ctype_add_class(mut_table, 'a', 'z', CTYPE_ALPHA);
+            ctype_add_class(mut_table, '!', '/', CTYPE_PUNCT);
+            ctype_add_class(mut_table, ':', '@', CTYPE_PUNCT);
+            ctype_add_class(mut_table, '[', '`', CTYPE_PUNCT);
+            ctype_add_class(mut_table, '{', '~', CTYPE_PUNCT);
+
+            return mut_table;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the digit value table. Each entry is the value
+        ///     of the character as a digit in base 36, or CTYPE_NOT_A_DIGIT
+        ///     if the character is not a digit in any base.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the digit value table.
+        ///
+        [[nodiscard]] constexpr auto
+        ctype_make_digit_table() noexcept -> array<bsl::uint8, CTYPE_TABLE_SIZE>
+        {
+            constexpr safe_uint8 zero{static_cast<bsl::uint8>(0)};
+            constexpr safe_uint8 ten{static_cast<bsl::uint8>(10)};
+
+            array<bsl::uint8, CTYPE_TABLE_SIZE> mut_table{};
+            for (safe_uintmax mut_i{}; mut_i < CTYPE_TABLE_SIZE; ++mut_i) {
+                *mut_table.at_if(mut_i) = CTYPE_NOT_A_DIGIT.get();
+            }
+
+            ctype_add_digits(mut_table, '0', '9', zero);
+            ctype_add_digits(mut_table, 'A', 'Z', ten);
+            ctype_add_digits(mut_table, 'a', 'z', ten);
+
+            return mut_table;
+        }
+
+        /// @brief stores the character class table
+        constexpr array<bsl::uint8, CTYPE_TABLE_SIZE> CTYPE_CLASS_TABLE{ctype_make_class_table()};
+        /// @brief stores the digit value table
+        constexpr array<bsl::uint8, CTYPE_TABLE_SIZE> CTYPE_DIGIT_TABLE{ctype_make_digit_table()};
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided character belongs to any
+        ///     of the provided classes. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to classify
+        ///   @param bits the class bits to test
+        ///   @return Returns true if the provided character belongs to any
+        ///     of the provided classes. Returns false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        ctype_is(char_type const c, safe_uint8 const &bits) noexcept -> bool
+        {
+            return !(safe_uint8{*CTYPE_CLASS_TABLE.at_if(ctype_idx(c))} & bits).is_zero();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided character is whitespace
+    ///     (i.e., ' ', '\\t', '\\n', '\\v', '\\f' or '\\r'). Unlike
+    ///     std::isspace, this function does not depend on the current
+    ///     locale, and is a single table lookup.
+    ///   @include example_ctype_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to classify
+    ///   @return Returns true if the provided character is whitespace.
+    ///
+    [[nodiscard]] constexpr auto
+    isspace(char_type const c) noexcept -> bool
+    {
+        return details::ctype_is(c, details::CTYPE_SPACE);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided character is a decimal
+    ///     digit (i.e., '0' - '9').
+    ///   @include example_ctype_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to classify
+    ///   @return Returns true if the provided character is a decimal
+    ///     digit.
+    ///
+    [[nodiscard]] constexpr auto
+    isdigit(char_type const c) noexcept -> bool
+    {
+        return details::ctype_is(c, details::CTYPE_DIGIT);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided character is a hexadecimal
+    ///     digit (i.e., '0' - '9', 'a' - 'f' or 'A' - 'F').
+    ///   @include example_ctype_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to classify
+    ///   @return Returns true if the provided character is a hexadecimal
+    ///     digit.
+    ///
+    [[nodiscard]] constexpr auto
+    isxdigit(char_type const c) noexcept -> bool
+    {
+        return details::ctype_is(c, details::CTYPE_XDIGIT);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided character is alphabetic
+    ///     (i.e., 'a' - 'z' or 'A' - 'Z').
+    ///   @include example_ctype_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to classify
+    ///   @return Returns true if the provided character is alphabetic.
+    ///
+    [[nodiscard]] constexpr auto
+    isalpha(char_type const c) noexcept -> bool
+    {
+        return details::ctype_is(c, details::CTYPE_ALPHA);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided character is alphanumeric
+    ///     (i.e., isalpha() or isdigit()).
+    ///   @include example_ctype_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to classify
+    ///   @return Returns true if the provided character is alphanumeric.
+    ///
+    [[nodiscard]] constexpr auto
+    isalnum(char_type const c) noexcept -> bool
+    {
+        return details::ctype_is(c, details::CTYPE_ALPHA | details::CTYPE_DIGIT);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided character is a printable
+    ///     ASCII character that is not alphanumeric or whitespace.
+    ///   @include example_ctype_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to classify
+    ///   @return Returns true if the provided character is punctuation.
+    ///
+    [[nodiscard]] constexpr auto
+    ispunct(char_type const c) noexcept -> bool
+    {
+        return details::ctype_is(c, details::CTYPE_PUNCT);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value of the provided character when it is
+    ///     interpreted as a digit in base 36 (i.e., '0' - '9' are 0 - 9,
+    ///     and 'a' - 'z' or 'A' - 'Z' are 10 - 35). If the character is
+    ///     not a digit in any base, 0xFF is returned. This allows a parser
+    ///     to validate and convert a digit in any base with a single table
+    ///     lookup and a single comparison against the base.
+    ///   @include example_ctype_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to convert
+    ///   @return Returns the value of the provided character as a digit,
+    ///     or 0xFF if the character is not a digit.
+    ///
+    [[nodiscard]] constexpr auto
+    digit_value(char_type const c) noexcept -> safe_uint8
+    {
+        return safe_uint8{*details::CTYPE_DIGIT_TABLE.at_if(details::ctype_idx(c))};
+    }
+}
+
+#endif
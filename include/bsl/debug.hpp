@@ -33,31 +33,32 @@
 #include "color.hpp"
 #include "conditional.hpp"
 #include "cstdint.hpp"
+#include "debug_levels.hpp"
+#include "details/log_limit.hpp"
 #include "details/out.hpp"
+#include "details/out_if.hpp"
 #include "details/out_type_alert.hpp"
 #include "details/out_type_debug.hpp"
 #include "details/out_type_empty.hpp"
 #include "details/out_type_error.hpp"
 #include "details/out_type_print.hpp"
+#include "discard.hpp"
 #include "disjunction.hpp"
+#include "enable_if.hpp"
 #include "fmt.hpp"
+#include "forward.hpp"
 #include "is_constant_evaluated.hpp"
+#include "is_same.hpp"
+#include "log_category.hpp"
+#include "remove_cvref.hpp"
 #include "safe_integral.hpp"
 #include "source_location.hpp"
+#include "touch.hpp"
 
 #include <bsl/details/print_thread_id.hpp>
 
 namespace bsl
 {
-    /// @brief defines the default verbose mode
-    constexpr bsl::uintmax CRITICAL_ONLY{static_cast<bsl::uintmax>(0)};
-    /// @brief defines "-v" verbose mode
-    constexpr bsl::uintmax V{static_cast<bsl::uintmax>(1)};
-    /// @brief defines "-vv" verbose mode
-    constexpr bsl::uintmax VV{static_cast<bsl::uintmax>(2)};
-    /// @brief defines "-vvv" verbose mode
-    constexpr bsl::uintmax VVV{static_cast<bsl::uintmax>(3)};
-
     /// @brief newline constant
     constexpr bsl::char_type endl{'\n'};
 
@@ -76,6 +77,18 @@ namespace bsl
                 bool_constant<DL<BSL_DEBUG_LEVEL>, bool_constant<BSL_DEBUG_LEVEL == DL>>::value,
                 out<T>,
                 out<out_type_empty>>;
+
+        /// @brief used to disable the category versions of debug() and
+        ///   alert() at compile-time when DL is more verbose than
+        ///   BSL_LOG_MAX_LEVEL.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam DL the debug level this out statement uses
+        ///   @tparam T the type of out statement being used
+        ///
+        template<bsl::uintmax DL, typename T>
+        using out_if_type = out_if<
+            conditional_t<bool_constant<(DL <= BSL_LOG_MAX_LEVEL)>::value, T, out_type_empty>>;
     }
 
     /// <!-- description -->
@@ -217,6 +230,235 @@ namespace bsl
         return o;
     }
 
+    /// <!-- description -->
+    ///   @brief Returns a bsl::out_if<T> that behaves like bsl::debug(),
+    ///     except that the provided category's runtime level is used
+    ///     instead of BSL_DEBUG_LEVEL. If the category's level is at
+    ///     least DL, "DEBUG [<category>]: " is printed when created.
+    ///     Otherwise, the bsl::out_if<T> is disabled, which costs a
+    ///     single load and branch. If DL is more verbose than
+    ///     BSL_LOG_MAX_LEVEL, the statement is removed at compile-time
+    ///     and the category's level is never read. Test the returned
+    ///     bsl::out_if<T> (or output functions that return the
+    ///     arguments) to ensure that the arguments of a disabled
+    ///     statement are not evaluated.
+    ///   @include example_log_category_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @param cat the category of this out statement
+    ///   @return Returns and instance of bsl::out_if<T>
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY>
+    [[nodiscard]] constexpr auto
+    debug(log_category const &cat) noexcept -> details::out_if_type<DL, details::out_type_debug>
+    {
+        using out_if_type = details::out_if_type<DL, details::out_type_debug>;
+        if constexpr (DL > BSL_LOG_MAX_LEVEL) {
+            return out_if_type{false};
+        }
+
+        out_if_type const o{cat.is_enabled<DL>()};
+        if (!o) {
+            return o;
+        }
+
+        o << bsl::bold_green << "DEBUG" << bsl::reset_color;
+        details::print_thread_id(out<details::out_type_debug>{});
+        o << " [" << cat.name() << "]: ";
+
+        return o;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a bsl::out_if<T> that behaves like bsl::alert(),
+    ///     except that the provided category's runtime level is used
+    ///     instead of BSL_DEBUG_LEVEL. If the category's level is at
+    ///     least DL, "ALERT [<category>]: " is printed when created.
+    ///     Otherwise, the bsl::out_if<T> is disabled, which costs a
+    ///     single load and branch. If DL is more verbose than
+    ///     BSL_LOG_MAX_LEVEL, the statement is removed at compile-time
+    ///     and the category's level is never read. Test the returned
+    ///     bsl::out_if<T> (or output functions that return the
+    ///     arguments) to ensure that the arguments of a disabled
+    ///     statement are not evaluated.
+    ///   @include example_log_category_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @param cat the category of this out statement
+    ///   @return Returns and instance of bsl::out_if<T>
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY>
+    [[nodiscard]] constexpr auto
+    alert(log_category const &cat) noexcept -> details::out_if_type<DL, details::out_type_alert>
+    {
+        using out_if_type = details::out_if_type<DL, details::out_type_alert>;
+        if constexpr (DL > BSL_LOG_MAX_LEVEL) {
+            return out_if_type{false};
+        }
+
+        out_if_type const o{cat.is_enabled<DL>()};
+        if (!o) {
+            return o;
+        }
+
+        o << bsl::bold_yellow << "ALERT" << bsl::reset_color;
+        details::print_thread_id(out<details::out_type_alert>{});
+        o << " [" << cat.name() << "]: ";
+
+        return o;
+    }
+
+    /// <!-- description -->
+    ///   @brief Lazy version of bsl::print(). The provided function is
+    ///     called with an instance of bsl::out<T> only if output is
+    ///     enabled for DL. If output is disabled at compile-time, the
+    ///     function is never called (or instantiated), which means that
+    ///     none of the arguments it outputs are evaluated.
+    ///   @include debug/example_debug_lazy.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @tparam FUNC the type of function that outputs the statement
+    ///   @param pudm_udm_func the function that outputs the statement
+    ///
+    template<
+        bsl::uintmax DL = CRITICAL_ONLY,
+        typename FUNC,
+        enable_if_t<!is_same<remove_cvref_t<FUNC>, log_category>::value, bool> = true>
+    constexpr void
+    print(FUNC &&pudm_udm_func) noexcept
+    {
+        // False positive
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        details::out_type<DL, details::out_type_print> const o{};
+        if constexpr (!o) {
+            bsl::touch();
+        }
+        else {
+            bsl::forward<FUNC>(pudm_udm_func)(print<DL>());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Lazy version of bsl::debug(). If output is enabled for DL,
+    ///     "DEBUG: " is printed and the provided function is called with
+    ///     an instance of bsl::out<T> to output the rest of the statement.
+    ///     If output is disabled at compile-time, the function is never
+    ///     called (or instantiated), which means that none of the
+    ///     arguments it outputs are evaluated.
+    ///   @include debug/example_debug_lazy.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @tparam FUNC the type of function that outputs the statement
+    ///   @param pudm_udm_func the function that outputs the statement
+    ///
+    template<
+        bsl::uintmax DL = CRITICAL_ONLY,
+        typename FUNC,
+        enable_if_t<!is_same<remove_cvref_t<FUNC>, log_category>::value, bool> = true>
+    constexpr void
+    debug(FUNC &&pudm_udm_func) noexcept
+    {
+        // False positive
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        details::out_type<DL, details::out_type_debug> const o{};
+        if constexpr (!o) {
+            bsl::touch();
+        }
+        else {
+            bsl::forward<FUNC>(pudm_udm_func)(debug<DL>());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Lazy version of bsl::alert(). If output is enabled for DL,
+    ///     "ALERT: " is printed and the provided function is called with
+    ///     an instance of bsl::out<T> to output the rest of the statement.
+    ///     If output is disabled at compile-time, the function is never
+    ///     called (or instantiated), which means that none of the
+    ///     arguments it outputs are evaluated.
+    ///   @include debug/example_debug_lazy.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @tparam FUNC the type of function that outputs the statement
+    ///   @param pudm_udm_func the function that outputs the statement
+    ///
+    template<
+        bsl::uintmax DL = CRITICAL_ONLY,
+        typename FUNC,
+        enable_if_t<!is_same<remove_cvref_t<FUNC>, log_category>::value, bool> = true>
+    constexpr void
+    alert(FUNC &&pudm_udm_func) noexcept
+    {
+        // False positive
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        details::out_type<DL, details::out_type_alert> const o{};
+        if constexpr (!o) {
+            bsl::touch();
+        }
+        else {
+            bsl::forward<FUNC>(pudm_udm_func)(alert<DL>());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Lazy version of bsl::debug(cat). If the category's level
+    ///     is at least DL, "DEBUG [<category>]: " is printed and the
+    ///     provided function is called with an instance of bsl::out<T>
+    ///     to output the rest of the statement. Otherwise, the function
+    ///     is not called, and none of the arguments it outputs are
+    ///     evaluated.
+    ///   @include debug/example_debug_lazy.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @tparam FUNC the type of function that outputs the statement
+    ///   @param cat the category of this out statement
+    ///   @param pudm_udm_func the function that outputs the statement
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY, typename FUNC>
+    constexpr void
+    debug(log_category const &cat, FUNC &&pudm_udm_func) noexcept
+    {
+        if (debug<DL>(cat)) {
+            bsl::forward<FUNC>(pudm_udm_func)(out<details::out_type_debug>{});
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Lazy version of bsl::alert(cat). If the category's level
+    ///     is at least DL, "ALERT [<category>]: " is printed and the
+    ///     provided function is called with an instance of bsl::out<T>
+    ///     to output the rest of the statement. Otherwise, the function
+    ///     is not called, and none of the arguments it outputs are
+    ///     evaluated.
+    ///   @include debug/example_debug_lazy.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @tparam FUNC the type of function that outputs the statement
+    ///   @param cat the category of this out statement
+    ///   @param pudm_udm_func the function that outputs the statement
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY, typename FUNC>
+    constexpr void
+    alert(log_category const &cat, FUNC &&pudm_udm_func) noexcept
+    {
+        if (alert<DL>(cat)) {
+            bsl::forward<FUNC>(pudm_udm_func)(out<details::out_type_alert>{});
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
     /// <!-- description -->
     ///   @brief Returns and instance of bsl::out<T>. This version of
     ///     bsl::out<T> prints "ERROR: " when created and does not accept
@@ -297,6 +539,164 @@ namespace bsl
         return sloc;
     }
 
+    /// <!-- description -->
+    ///   @brief Rate limited version of bsl::debug(). Each call site
+    ///     (identified by sloc) can output LOG_LIMIT_BURST statements at
+    ///     once, and then one more every LOG_LIMIT_INTERVAL_MS
+    ///     milliseconds. Statements beyond that are suppressed and
+    ///     counted, which usually costs only a counter increment (the
+    ///     clock is read with a backoff), and the next statement that is output is preceded by a
+    ///     "DEBUG: suppressed N messages" summary. Test the returned
+    ///     bsl::out_if<T> before using it to ensure that the arguments of
+    ///     a suppressed statement are not evaluated.
+    ///   @include debug/example_debug_limited.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @param sloc the location of the call site
+    ///   @return Returns and instance of bsl::out_if<T>
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY>
+    [[nodiscard]] auto
+    debug_limited(source_location const &sloc = here()) noexcept -> out_if<details::out_type_debug>
+    {
+        // False positive
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        details::out_type<DL, details::out_type_debug> const o{};
+        if constexpr (!o) {
+            return out_if<details::out_type_debug>{false};
+        }
+
+        auto &mut_site{details::log_limit_find(sloc)};
+        if (!mut_site.limit<details::LOG_LIMIT_BURST, details::LOG_LIMIT_INTERVAL_MS>()) {
+            return out_if<details::out_type_debug>{false};
+        }
+
+        safe_uintmax const suppressed{mut_site.suppressed()};
+        if (suppressed.is_pos()) {
+            debug<DL>() << "suppressed " << suppressed << " messages" << endl;
+        }
+        else {
+            bsl::touch();
+        }
+
+        bsl::discard(debug<DL>());
+        return out_if<details::out_type_debug>{true};
+    }
+
+    /// <!-- description -->
+    ///   @brief Rate limited version of bsl::alert(). Each call site
+    ///     (identified by sloc) can output LOG_LIMIT_BURST statements at
+    ///     once, and then one more every LOG_LIMIT_INTERVAL_MS
+    ///     milliseconds. Statements beyond that are suppressed and
+    ///     counted, which usually costs only a counter increment (the
+    ///     clock is read with a backoff), and the next statement that is output is preceded by a
+    ///     "ALERT: suppressed N messages" summary. Test the returned
+    ///     bsl::out_if<T> before using it to ensure that the arguments of
+    ///     a suppressed statement are not evaluated.
+    ///   @include debug/example_debug_limited.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @param sloc the location of the call site
+    ///   @return Returns and instance of bsl::out_if<T>
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY>
+    [[nodiscard]] auto
+    alert_limited(source_location const &sloc = here()) noexcept -> out_if<details::out_type_alert>
+    {
+        // False positive
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        details::out_type<DL, details::out_type_alert> const o{};
+        if constexpr (!o) {
+            return out_if<details::out_type_alert>{false};
+        }
+
+        auto &mut_site{details::log_limit_find(sloc)};
+        if (!mut_site.limit<details::LOG_LIMIT_BURST, details::LOG_LIMIT_INTERVAL_MS>()) {
+            return out_if<details::out_type_alert>{false};
+        }
+
+        safe_uintmax const suppressed{mut_site.suppressed()};
+        if (suppressed.is_pos()) {
+            alert<DL>() << "suppressed " << suppressed << " messages" << endl;
+        }
+        else {
+            bsl::touch();
+        }
+
+        bsl::discard(alert<DL>());
+        return out_if<details::out_type_alert>{true};
+    }
+
+    /// <!-- description -->
+    ///   @brief Sampled version of bsl::debug(). Only 1 in every N
+    ///     statements from each call site (identified by sloc) is output,
+    ///     starting with the first one. Every other statement costs a
+    ///     single counter increment. Test the returned bsl::out_if<T>
+    ///     before using it to ensure that the arguments of a statement
+    ///     that is not output are not evaluated.
+    ///   @include debug/example_debug_limited.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @tparam N the sample rate
+    ///   @param sloc the location of the call site
+    ///   @return Returns and instance of bsl::out_if<T>
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY, bsl::uintmax N = details::LOG_SAMPLE_RATE>
+    [[nodiscard]] auto
+    debug_sampled(source_location const &sloc = here()) noexcept -> out_if<details::out_type_debug>
+    {
+        // False positive
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        details::out_type<DL, details::out_type_debug> const o{};
+        if constexpr (!o) {
+            return out_if<details::out_type_debug>{false};
+        }
+
+        if (!details::log_limit_find(sloc).sample<N>()) {
+            return out_if<details::out_type_debug>{false};
+        }
+
+        bsl::discard(debug<DL>());
+        return out_if<details::out_type_debug>{true};
+    }
+
+    /// <!-- description -->
+    ///   @brief Sampled version of bsl::alert(). Only 1 in every N
+    ///     statements from each call site (identified by sloc) is output,
+    ///     starting with the first one. Every other statement costs a
+    ///     single counter increment. Test the returned bsl::out_if<T>
+    ///     before using it to ensure that the arguments of a statement
+    ///     that is not output are not evaluated.
+    ///   @include debug/example_debug_limited.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this out statement
+    ///   @tparam N the sample rate
+    ///   @param sloc the location of the call site
+    ///   @return Returns and instance of bsl::out_if<T>
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY, bsl::uintmax N = details::LOG_SAMPLE_RATE>
+    [[nodiscard]] auto
+    alert_sampled(source_location const &sloc = here()) noexcept -> out_if<details::out_type_alert>
+    {
+        // False positive
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        details::out_type<DL, details::out_type_alert> const o{};
+        if constexpr (!o) {
+            return out_if<details::out_type_alert>{false};
+        }
+
+        if (!details::log_limit_find(sloc).sample<N>()) {
+            return out_if<details::out_type_alert>{false};
+        }
+
+        bsl::discard(alert<DL>());
+        return out_if<details::out_type_alert>{true};
+    }
+
     /// <!-- description -->
     ///   @brief Returns fmt{"#04x", val}
     ///
@@ -0,0 +1,45 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file debug_levels.hpp
+///
+
+#ifndef BSL_DEBUG_LEVELS_HPP
+#define BSL_DEBUG_LEVELS_HPP
+
+#include "cstdint.hpp"
+
+namespace bsl
+{
+    /// @brief defines the default verbose mode
+    constexpr bsl::uintmax CRITICAL_ONLY{static_cast<bsl::uintmax>(0)};
+    /// @brief defines "-v" verbose mode
+    constexpr bsl::uintmax V{static_cast<bsl::uintmax>(1)};
+    /// @brief defines "-vv" verbose mode
+    constexpr bsl::uintmax VV{static_cast<bsl::uintmax>(2)};
+    /// @brief defines "-vvv" verbose mode
+    constexpr bsl::uintmax VVV{static_cast<bsl::uintmax>(3)};
+}
+
+#endif
@@ -0,0 +1,397 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file bounded_range.hpp
+///
+
+#ifndef BSL_DETAILS_BOUNDED_RANGE_HPP
+#define BSL_DETAILS_BOUNDED_RANGE_HPP
+
+#include "../discard.hpp"
+#include "../is_signed.hpp"
+#include "../numeric_limits.hpp"
+#include "../touch.hpp"
+#include "../unlikely.hpp"
+
+namespace bsl::details
+{
+    /// @class bsl::details::bounded_unchecked_t
+    ///
+    /// <!-- description -->
+    ///   @brief Tells a bsl::bounded_integral that the value it is being
+    ///     created from has already been proven to be within its bounds,
+    ///     and therefore does not need to be checked.
+    ///
+    class bounded_unchecked_t final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor that ensures construction of
+        ///     this type must be explicit
+        ///
+        explicit constexpr bounded_unchecked_t() noexcept = default;
+    };
+
+    /// @brief reduces the verbosity of bsl::details::bounded_unchecked_t
+    constexpr bounded_unchecked_t bounded_unchecked{};
+
+    /// @class bsl::details::bounded_range
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the range of values that the result of an operation
+    ///     on two bsl::bounded_integrals can have. If the range cannot be
+    ///     represented by T (i.e., the operation could overflow, wrap or
+    ///     divide by 0), fits is false, and the operation falls back to
+    ///     a bsl::safe_integral, which is checked at run-time.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of integral the range is for
+    ///
+    template<typename T>
+    struct bounded_range final
+    {
+        /// @brief stores the smallest possible result
+        T lo{};
+        /// @brief stores the largest possible result
+        T hi{};
+        /// @brief stores whether or not [lo, hi] can be represented by T
+        bool fits{};
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns val clamped to [MIN, MAX]. A value that is out of
+    ///     bounds is an invalid argument, which is reported at compile-time.
+    ///     If [MIN, MAX] covers every value of T, no check is performed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam MIN the smallest value allowed
+    ///   @tparam MAX the largest value allowed
+    ///   @param val the value to clamp
+    ///   @return Returns val clamped to [MIN, MAX]
+    ///
+    template<auto MIN, decltype(MIN) MAX>
+    [[nodiscard]] constexpr auto
+    bounded_clamp(decltype(MIN) const val) noexcept -> decltype(MIN)
+    {
+        if constexpr (numeric_limits<decltype(MIN)>::min() != MIN) {
+            if (unlikely(val < MIN)) {
+                unlikely_invalid_argument_failure();
+                return MIN;
+            }
+
+            bsl::touch();
+        }
+
+        if constexpr (numeric_limits<decltype(MIN)>::max() != MAX) {
+            if (unlikely(val > MAX)) {
+                unlikely_invalid_argument_failure();
+                return MAX;
+            }
+
+            bsl::touch();
+        }
+
+        return val;
+    }
+
+    /// <!-- description -->
+    ///   @brief Extends the provided range so that it includes val.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param mut_range the range to extend
+    ///   @param val the value the range must include
+    ///
+    template<typename T>
+    constexpr void
+    bounded_extend(bounded_range<T> &mut_range, T const val) noexcept
+    {
+        if (val < mut_range.lo) {
+            mut_range.lo = val;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (val > mut_range.hi) {
+            mut_range.hi = val;
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the range of the four corner results of an
+    ///     operation (i.e., the smallest and the largest of a, b, c and d).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param a the first corner
+    ///   @param b the second corner
+    ///   @param c the third corner
+    ///   @param d the fourth corner
+    ///   @return Returns the range of the four corner results
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bounded_corners(T const a, T const b, T const c, T const d) noexcept -> bounded_range<T>
+    {
+        bounded_range<T> mut_range{a, a, true};
+
+        bounded_extend(mut_range, b);
+        bounded_extend(mut_range, c);
+        bounded_extend(mut_range, d);
+
+        return mut_range;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the range of [lmin, lmax] + [rmin, rmax]
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param lmin the smallest value of the left hand side
+    ///   @param lmax the largest value of the left hand side
+    ///   @param rmin the smallest value of the right hand side
+    ///   @param rmax the largest value of the right hand side
+    ///   @return Returns the range of [lmin, lmax] + [rmin, rmax]
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bounded_add_range(T const lmin, T const lmax, T const rmin, T const rmax) noexcept
+        -> bounded_range<T>
+    {
+        bounded_range<T> mut_range{};
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_add_overflow(lmin, rmin, &mut_range.lo)) {
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_add_overflow(lmax, rmax, &mut_range.hi)) {
+            return {};
+        }
+
+        mut_range.fits = true;
+        return mut_range;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the range of [lmin, lmax] - [rmin, rmax]
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param lmin the smallest value of the left hand side
+    ///   @param lmax the largest value of the left hand side
+    ///   @param rmin the smallest value of the right hand side
+    ///   @param rmax the largest value of the right hand side
+    ///   @return Returns the range of [lmin, lmax] - [rmin, rmax]
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bounded_sub_range(T const lmin, T const lmax, T const rmin, T const rmax) noexcept
+        -> bounded_range<T>
+    {
+        bounded_range<T> mut_range{};
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_sub_overflow(lmin, rmax, &mut_range.lo)) {
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_sub_overflow(lmax, rmin, &mut_range.hi)) {
+            return {};
+        }
+
+        mut_range.fits = true;
+        return mut_range;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the range of [lmin, lmax] * [rmin, rmax]
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param lmin the smallest value of the left hand side
+    ///   @param lmax the largest value of the left hand side
+    ///   @param rmin the smallest value of the right hand side
+    ///   @param rmax the largest value of the right hand side
+    ///   @return Returns the range of [lmin, lmax] * [rmin, rmax]
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bounded_mul_range(T const lmin, T const lmax, T const rmin, T const rmax) noexcept
+        -> bounded_range<T>
+    {
+        T mut_a{};
+        T mut_b{};
+        T mut_c{};
+        T mut_d{};
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_mul_overflow(lmin, rmin, &mut_a)) {
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_mul_overflow(lmin, rmax, &mut_b)) {
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_mul_overflow(lmax, rmin, &mut_c)) {
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        if (__builtin_mul_overflow(lmax, rmax, &mut_d)) {
+            return {};
+        }
+
+        return bounded_corners(mut_a, mut_b, mut_c, mut_d);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the range of [lmin, lmax] / [rmin, rmax]. If
+    ///     [rmin, rmax] contains 0, or the division could overflow
+    ///     (i.e., min() / -1), the range does not fit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param lmin the smallest value of the left hand side
+    ///   @param lmax the largest value of the left hand side
+    ///   @param rmin the smallest value of the right hand side
+    ///   @param rmax the largest value of the right hand side
+    ///   @return Returns the range of [lmin, lmax] / [rmin, rmax]
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bounded_div_range(T const lmin, T const lmax, T const rmin, T const rmax) noexcept
+        -> bounded_range<T>
+    {
+        constexpr T zero{static_cast<T>(0)};
+
+        if (!(rmin > zero)) {
+            if (!(rmax < zero)) {
+                return {};
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        if constexpr (is_signed<T>::value) {
+            constexpr T neg_one{static_cast<T>(-1)};
+
+            if (numeric_limits<T>::min() == lmin) {
+                if (neg_one == rmax) {
+                    return {};
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        return bounded_corners(
+            static_cast<T>(lmin / rmin),
+            static_cast<T>(lmin / rmax),
+            static_cast<T>(lmax / rmin),
+            static_cast<T>(lmax / rmax));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the range of [lmin, lmax] % [rmin, rmax]. The
+    ///     range is only computed when both sides are non-negative and
+    ///     the right hand side cannot be 0, in which case the result is
+    ///     in [0, min(lmax, rmax - 1)]. Otherwise the range does not fit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param lmin the smallest value of the left hand side
+    ///   @param lmax the largest value of the left hand side
+    ///   @param rmin the smallest value of the right hand side
+    ///   @param rmax the largest value of the right hand side
+    ///   @return Returns the range of [lmin, lmax] % [rmin, rmax]
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bounded_mod_range(T const lmin, T const lmax, T const rmin, T const rmax) noexcept
+        -> bounded_range<T>
+    {
+        constexpr T zero{static_cast<T>(0)};
+        constexpr T one{static_cast<T>(1)};
+
+        if (lmin < zero) {
+            return {};
+        }
+
+        if (!(rmin > zero)) {
+            return {};
+        }
+
+        T const rhi{static_cast<T>(rmax - one)};
+        if (lmax < rhi) {
+            return {zero, lmax, true};
+        }
+
+        return {zero, rhi, true};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the range of [lmin, lmax] & [rmin, rmax] for
+    ///     unsigned integrals, which is [0, min(lmax, rmax)].
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral the range is for
+    ///   @param lmin the smallest value of the left hand side
+    ///   @param lmax the largest value of the left hand side
+    ///   @param rmin the smallest value of the right hand side
+    ///   @param rmax the largest value of the right hand side
+    ///   @return Returns the range of [lmin, lmax] & [rmin, rmax]
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    bounded_and_range(T const lmin, T const lmax, T const rmin, T const rmax) noexcept
+        -> bounded_range<T>
+    {
+        constexpr T zero{static_cast<T>(0)};
+        bsl::discard(lmin, rmin);
+
+        if (lmax < rmax) {
+            return {zero, lmax, true};
+        }
+
+        return {zero, rmax, true};
+    }
+}
+
+#endif
@@ -0,0 +1,306 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file checked_state.hpp
+///
+
+#ifndef BSL_DETAILS_CHECKED_STATE_HPP
+#define BSL_DETAILS_CHECKED_STATE_HPP
+
+#include "../cstdint.hpp"
+#include "../is_unsigned.hpp"
+#include "../safe_integral.hpp"
+#include "../span.hpp"
+#include "../touch.hpp"
+#include "../unlikely.hpp"
+
+namespace bsl::details
+{
+    /// @brief stores the total number of elements processed between checks
+    constexpr safe_uintmax CHECKED_BLOCK_SIZE{static_cast<bsl::uintmax>(64)};
+
+    /// @class bsl::details::checked_state
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the state of a checked reduction. Instead of a
+    ///     bsl::safe_integral being checked (and branched on) for each
+    ///     element, the raw sum is accumulated with wrapping arithmetic
+    ///     and whether or not an invalid element or an overflow was seen
+    ///     is recorded in a flag that is only checked once per block.
+    ///     Since these flags are sticky, the result is invalid if and only
+    ///     if the same scalar loop using bsl::safe_integral would have
+    ///     resulted in an invalid bsl::safe_integral.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of integral being accumulated
+    ///
+    template<typename T>
+    struct checked_state final
+    {
+        /// @brief stores the (possibly wrapped) sum
+        T sum{};
+        /// @brief stores a non-zero value if an invalid element was seen
+        bsl::uintmax invalid{};
+        /// @brief stores a non-zero value if an overflow was seen
+        bsl::uintmax overflow{};
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns true if a checked reduction should accumulate
+    ///     each block in a bsl::uintmax. This is only done for unsigned
+    ///     integrals whose values (each the product of FACTORS values)
+    ///     fit in a bsl::uintmax. The block is accumulated using
+    ///     wrapping arithmetic, and the total number of times the
+    ///     bsl::uintmax wraps is counted (see checked_add_carry), which
+    ///     means that no element has to be checked for overflow. Since a
+    ///     sum of unsigned integrals can only grow, checking the sum once
+    ///     per block is the same as checking it after each element.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @tparam FACTORS the total number of T values multiplied together
+    ///     to get each value being accumulated
+    ///   @return Returns true if a checked reduction should accumulate
+    ///     each block in a bsl::uintmax.
+    ///
+    template<typename T, bsl::uintmax FACTORS>
+    [[nodiscard]] constexpr auto
+    checked_use_blocked() noexcept -> bool
+    {
+        constexpr bsl::uintmax bits_per_byte{static_cast<bsl::uintmax>(8)};
+
+        if constexpr (is_unsigned<T>::value) {
+            // NOLINTNEXTLINE(bsl-types-fixed-width-ints-arithmetic-check)
+            return (sizeof(T) * bits_per_byte * FACTORS) <= (sizeof(bsl::uintmax) * bits_per_byte);
+        }
+        else {
+            return false;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds the provided value to a block's bsl::uintmax sum,
+    ///     and adds 1 to the block's carry count if the sum wraps. Since
+    ///     this is a compare and an add, the compiler is free to
+    ///     vectorize the loop that uses it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sum the block's (possibly wrapped) sum
+    ///   @param mut_carries the total number of times mut_sum wrapped
+    ///   @param val the value to add
+    ///
+    constexpr void
+    checked_add_carry(
+        bsl::uintmax &mut_sum, bsl::uintmax &mut_carries, bsl::uintmax const val) noexcept
+    {
+        mut_sum += val;
+        mut_carries += static_cast<bsl::uintmax>(mut_sum < val);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the raw value of the provided bsl::safe_integral.
+    ///     If the bsl::safe_integral is invalid, the state's invalid flag is
+    ///     set, in which case the returned value is meaningless, as the
+    ///     result of the checked reduction will be invalid. Note that this
+    ///     does not branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @param mut_state the state of the checked reduction
+    ///   @param val the bsl::safe_integral to get the raw value of
+    ///   @return Returns the raw value of the provided bsl::safe_integral
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_raw(checked_state<T> &mut_state, safe_integral<T> const &val) noexcept -> T
+    {
+        mut_state.invalid |= static_cast<bsl::uintmax>(val.invalid());
+        return *val.data();
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds the provided value to the state's sum, setting the
+    ///     state's overflow flag if the add overflows. Note that this does
+    ///     not branch, so the compiler is free to unroll and schedule the
+    ///     loop that uses it as it sees fit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @tparam U the type of value being added
+    ///   @param mut_state the state of the checked reduction
+    ///   @param val the value to add
+    ///
+    template<typename T, typename U>
+    constexpr void
+    checked_add(checked_state<T> &mut_state, U const val) noexcept
+    {
+        // This is how Clang presents the builtins, which we are required
+        // top use.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        bool const ovf{__builtin_add_overflow(mut_state.sum, val, &mut_state.sum)};
+        mut_state.overflow |= static_cast<bsl::uintmax>(ovf);
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds a block that was accumulated using checked_add_carry
+    ///     to the state's sum. If the block's sum wrapped, the block's
+    ///     real sum does not fit in a bsl::uintmax, let alone a T, and
+    ///     the state's overflow flag is set.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @param mut_state the state of the checked reduction
+    ///   @param sum the block's (possibly wrapped) sum
+    ///   @param carries the total number of times the block's sum wrapped
+    ///
+    template<typename T>
+    constexpr void
+    checked_add_block(
+        checked_state<T> &mut_state, bsl::uintmax const sum, bsl::uintmax const carries) noexcept
+    {
+        mut_state.overflow |= static_cast<bsl::uintmax>(static_cast<bsl::uintmax>(0) != carries);
+        checked_add(mut_state, sum);
+    }
+
+    /// <!-- description -->
+    ///   @brief Subtracts the provided value from the state's sum, setting
+    ///     the state's overflow flag if the subtract overflows. Like
+    ///     checked_add, this does not branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @param mut_state the state of the checked reduction
+    ///   @param val the value to subtract
+    ///
+    template<typename T>
+    constexpr void
+    checked_sub(checked_state<T> &mut_state, T const val) noexcept
+    {
+        // This is how Clang presents the builtins, which we are required
+        // top use.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        bool const ovf{__builtin_sub_overflow(mut_state.sum, val, &mut_state.sum)};
+        mut_state.overflow |= static_cast<bsl::uintmax>(ovf);
+    }
+
+    /// <!-- description -->
+    ///   @brief Multiplies the state's sum by the provided value, setting
+    ///     the state's overflow flag if the multiply overflows. Like
+    ///     checked_add, this does not branch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @param mut_state the state of the checked reduction
+    ///   @param val the value to multiply by
+    ///
+    template<typename T>
+    constexpr void
+    checked_mul(checked_state<T> &mut_state, T const val) noexcept
+    {
+        // This is how Clang presents the builtins, which we are required
+        // top use.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        bool const ovf{__builtin_mul_overflow(mut_state.sum, val, &mut_state.sum)};
+        mut_state.overflow |= static_cast<bsl::uintmax>(ovf);
+    }
+
+    /// <!-- description -->
+    ///   @brief Merges the invalid and overflow flags of "other" into the
+    ///     provided state. The sum of "other" is not used.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @param mut_state the state to merge the flags into
+    ///   @param other the state to merge the flags from
+    ///
+    template<typename T>
+    constexpr void
+    checked_merge(checked_state<T> &mut_state, checked_state<T> const &other) noexcept
+    {
+        mut_state.invalid |= other.invalid;
+        mut_state.overflow |= other.overflow;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the total number of elements in the block that
+    ///     starts at "pos", given the total number of elements.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pos the index of the first element in the block
+    ///   @param size the total number of elements
+    ///   @return Returns the total number of elements in the block
+    ///
+    [[nodiscard]] constexpr auto
+    checked_block_size(safe_uintmax const &pos, safe_uintmax const &size) noexcept
+        -> safe_uintmax
+    {
+        return (size - pos).min(CHECKED_BLOCK_SIZE);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the checked reduction has failed, meaning
+    ///     there is no reason to process any more blocks.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @param state the state of the checked reduction
+    ///   @return Returns true if the checked reduction has failed
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_failed(checked_state<T> const &state) noexcept -> bool
+    {
+        return static_cast<bsl::uintmax>(0) != (state.invalid | state.overflow);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the result of the checked reduction. If an
+    ///     invalid element or an overflow was seen, this reports the error
+    ///     the same way a bsl::safe_integral would, and returns
+    ///     bsl::safe_integral<T>::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being accumulated
+    ///   @param state the state of the checked reduction
+    ///   @return Returns the result of the checked reduction
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    checked_result(checked_state<T> const &state) noexcept -> safe_integral<T>
+    {
+        if (unlikely(static_cast<bsl::uintmax>(0) != state.invalid)) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        if (unlikely(static_cast<bsl::uintmax>(0) != state.overflow)) {
+            integral_overflow_underflow_wrap_error();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{state.sum};
+    }
+}
+
+#endif
@@ -0,0 +1,94 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file div_wide_raw.hpp
+///
+
+#ifndef BSL_DETAILS_DIV_WIDE_RAW_HPP
+#define BSL_DETAILS_DIV_WIDE_RAW_HPP
+
+#include "../climits.hpp"
+#include "../cstdint.hpp"
+#include "../touch.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Returns ((hi << 64) | lo) / div using a shift-subtract
+    ///     long division, one quotient bit at a time. This only uses
+    ///     64bit arithmetic, so unlike a division of 128bit integrals, it
+    ///     does not need a compiler runtime (e.g., __udivti3). hi must be
+    ///     less than div, which ensures that the quotient fits in 64 bits
+    ///     (and that div is not 0).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param hi the high 64 bits of the dividend
+    ///   @param lo the low 64 bits of the dividend
+    ///   @param div the value to divide the dividend by
+    ///   @return Returns ((hi << 64) | lo) / div
+    ///
+    [[nodiscard]] constexpr auto
+    div_wide_raw(bsl::uint64 const hi, bsl::uint64 const lo, bsl::uint64 const div) noexcept
+        -> bsl::uint64
+    {
+        constexpr bsl::uint64 zero{static_cast<bsl::uint64>(0)};
+        constexpr bsl::uint64 one{static_cast<bsl::uint64>(1)};
+        constexpr bsl::uint64 bits{static_cast<bsl::uint64>(sizeof(bsl::uint64) * CHAR_BIT)};
+        constexpr bsl::uint64 msb{bits - one};
+
+        bsl::uint64 mut_rem{hi};
+        bsl::uint64 mut_lo{lo};
+        bsl::uint64 mut_quo{};
+
+        for (bsl::uint64 mut_i{}; mut_i < bits; ++mut_i) {
+            // The remainder is always less than div, so shifting it can
+            // carry at most one bit out of the 64bit remainder. If that
+            // happens, the 65bit remainder is larger than div, and
+            // subtracting div wraps back around to the right value.
+            bool mut_sub{zero != (mut_rem >> msb)};
+            mut_rem = (mut_rem << one) | (mut_lo >> msb);
+            mut_lo <<= one;
+            mut_quo <<= one;
+
+            if (mut_rem >= div) {
+                mut_sub = true;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_sub) {
+                mut_rem -= div;
+                mut_quo |= one;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        return mut_quo;
+    }
+}
+
+#endif
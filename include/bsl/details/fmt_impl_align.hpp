@@ -88,24 +88,18 @@ namespace bsl::details
 
                     case fmt_align::fmt_align_center: {
                         safe_uintmax const half{padding >> one};
-                        for (safe_uintmax mut_cpi{}; mut_cpi < half; ++mut_cpi) {
-                            o.write_to_console(ops.fill());
-                        }
+                        o.fill_to_console(ops.fill(), half);
                         break;
                     }
 
                     case fmt_align::fmt_align_right: {
-                        for (safe_uintmax mut_rpi{}; mut_rpi < padding; ++mut_rpi) {
-                            o.write_to_console(ops.fill());
-                        }
+                        o.fill_to_console(ops.fill(), padding);
                         break;
                     }
 
                     case fmt_align::fmt_align_default: {
                         if (!left) {
-                            for (safe_uintmax mut_dpi{}; mut_dpi < padding; ++mut_dpi) {
-                                o.write_to_console(ops.fill());
-                            }
+                            o.fill_to_console(ops.fill(), padding);
                         }
                         else {
                             bsl::touch();
@@ -156,17 +150,13 @@ namespace bsl::details
             if (padding != zero) {
                 switch (ops.align()) {
                     case fmt_align::fmt_align_left: {
-                        for (safe_uintmax mut_lpi{}; mut_lpi < padding; ++mut_lpi) {
-                            o.write_to_console(ops.fill());
-                        }
+                        o.fill_to_console(ops.fill(), padding);
                         break;
                     }
 
                     case fmt_align::fmt_align_center: {
                         safe_uintmax const half{padding - (padding >> one)};
-                        for (safe_uintmax mut_cpi{}; mut_cpi < half; ++mut_cpi) {
-                            o.write_to_console(ops.fill());
-                        }
+                        o.fill_to_console(ops.fill(), half);
                         break;
                     }
 
@@ -176,9 +166,7 @@ namespace bsl::details
 
                     case fmt_align::fmt_align_default: {
                         if (left) {
-                            for (safe_uintmax mut_dpi{}; mut_dpi < padding; ++mut_dpi) {
-                                o.write_to_console(ops.fill());
-                            }
+                            o.fill_to_console(ops.fill(), padding);
                         }
                         else {
                             bsl::touch();
@@ -65,6 +65,10 @@ namespace bsl
     constexpr void
     fmt_impl(out<OUT_T> const o, fmt_options const &ops, safe_integral<T> const &val) noexcept
     {
+        static_assert(
+            sizeof(T) <= sizeof(bsl::uintmax),
+            "128bit integrals are not supported by bsl::fmt, convert to 64bit first");
+
         constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
         constexpr safe_uintmax size_of_error{static_cast<bsl::uintmax>(7)};
 
@@ -140,6 +144,10 @@ namespace bsl
     [[maybe_unused]] constexpr auto
     operator<<(out<T1> const o, safe_integral<T2> const &val) noexcept -> out<T1>
     {
+        static_assert(
+            sizeof(T2) <= sizeof(bsl::uintmax),
+            "128bit integrals are not supported by bsl::fmt, convert to 64bit first");
+
         if (is_constant_evaluated()) {
             if (unlikely(!val)) {
                 return o;
@@ -157,28 +165,19 @@ namespace bsl
             return o;
         }
 
-        details::fmt_impl_integral_info<T2> const info{
+        details::fmt_impl_integral_info<T2> mut_info{
             details::get_integral_info<T2>(nullops, val)};
 
-        if (val.is_zero()) {
-            o.write_to_console('0');
-        }
-        else {
-            if constexpr (is_signed<T2>::value) {
-                if (val.is_neg()) {
-                    o.write_to_console('-');
-                }
-                else {
-                    bsl::touch();
-                }
+        if constexpr (is_signed<T2>::value) {
+            if (val.is_neg()) {
+                details::fmt_impl_integral_push(mut_info, '-');
             }
-
-            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
-            for (safe_uintmax mut_i{info.digits}; mut_i.is_pos(); --mut_i) {
-                o.write_to_console(*info.buf.at_if(mut_i - one));
+            else {
+                bsl::touch();
             }
         }
 
+        o.write_to_console(mut_info.buf.at_if(mut_info.start));
         return o;
     }
 
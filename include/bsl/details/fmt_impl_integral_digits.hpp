@@ -0,0 +1,78 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file fmt_impl_integral_digits.hpp
+///
+
+#ifndef BSL_DETAILS_FMT_IMPL_INTEGRAL_DIGITS_HPP
+#define BSL_DETAILS_FMT_IMPL_INTEGRAL_DIGITS_HPP
+
+#include "../array.hpp"
+#include "../char_type.hpp"
+#include "../safe_integral.hpp"
+
+namespace bsl::details
+{
+    /// @brief stores the total number of characters in the digit pair table
+    constexpr safe_uintmax DIGIT_PAIRS_SIZE{static_cast<bsl::uintmax>(200)};
+    /// @brief stores the total number of characters in the nibble table
+    constexpr safe_uintmax NIBBLES_SIZE{static_cast<bsl::uintmax>(16)};
+
+    /// <!-- description -->
+    ///   @brief Returns a table containing "00" through "99". The two
+    ///     characters for the number n are stored at n * 2 and n * 2 + 1,
+    ///     which allows a number to be converted into base 10 two digits
+    ///     at a time.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a table containing "00" through "99".
+    ///
+    [[nodiscard]] constexpr auto
+    make_digit_pairs() noexcept -> array<char_type, DIGIT_PAIRS_SIZE.get()>
+    {
+        constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+        constexpr safe_uintmax two{static_cast<bsl::uintmax>(2)};
+        constexpr safe_uintmax ten{static_cast<bsl::uintmax>(10)};
+        constexpr safe_uintmax hundred{static_cast<bsl::uintmax>(100)};
+        constexpr safe_uintmax offset{static_cast<bsl::uintmax>('0')};
+
+        array<char_type, DIGIT_PAIRS_SIZE.get()> mut_pairs{};
+        for (safe_uintmax mut_i{}; mut_i < hundred; ++mut_i) {
+            safe_uintmax const idx{mut_i * two};
+            *mut_pairs.at_if(idx) = static_cast<char_type>(((mut_i / ten) + offset).get());
+            *mut_pairs.at_if(idx + one) = static_cast<char_type>(((mut_i % ten) + offset).get());
+        }
+
+        return mut_pairs;
+    }
+
+    /// @brief stores "00" through "99" for base 10 conversions
+    constexpr array<char_type, DIGIT_PAIRS_SIZE.get()> DIGIT_PAIRS{make_digit_pairs()};
+
+    /// @brief stores "0" through "F" for base 2, 10 and 16 conversions
+    constexpr array<char_type, NIBBLES_SIZE.get()> NIBBLES{
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+}
+
+#endif
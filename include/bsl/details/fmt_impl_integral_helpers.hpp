@@ -31,6 +31,7 @@
 #include "../safe_integral.hpp"
 #include "../touch.hpp"
 #include "fmt_impl_align.hpp"
+#include "fmt_impl_integral_digits.hpp"
 #include "fmt_impl_integral_info.hpp"
 #include "out.hpp"
 
@@ -89,6 +90,125 @@ namespace bsl::details
         return base10;
     }
 
+    /// <!-- description -->
+    ///   @brief Returns the magnitude of the provided integral. Unlike
+    ///     negating the integral, this works for the most negative
+    ///     value of a signed integral as well.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to get the magnitude of
+    ///   @param val the integral to get the magnitude of
+    ///   @return Returns the magnitude of the provided integral
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    get_integral_magnitude(safe_integral<T> const &val) noexcept -> safe_uintmax
+    {
+        if constexpr (is_signed<T>::value) {
+            if (val.is_neg()) {
+                constexpr safe_integral<T> one{static_cast<T>(1)};
+                constexpr safe_uintmax one_umax{static_cast<bsl::uintmax>(1)};
+                return safe_uintmax{static_cast<bsl::uintmax>((-(val + one)).get())} + one_umax;
+            }
+
+            bsl::touch();
+        }
+
+        return safe_uintmax{static_cast<bsl::uintmax>(val.get())};
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds a character to the front of the integral stored in
+    ///     the provided info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to output
+    ///   @param mut_info the info to add the character to
+    ///   @param c the character to add
+    ///
+    template<typename T>
+    constexpr void
+    fmt_impl_integral_push(fmt_impl_integral_info<T> &mut_info, char_type const c) noexcept
+    {
+        --mut_info.start;
+        *mut_info.buf.at_if(mut_info.start) = c;
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds the digits of the provided magnitude to the provided
+    ///     info in base 10. The digits are converted two at a time using
+    ///     the "00" through "99" table.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to output
+    ///   @param mut_info the info to add the digits to
+    ///   @param mag the magnitude of the integral to add
+    ///
+    template<typename T>
+    constexpr void
+    get_integral_info_dec(fmt_impl_integral_info<T> &mut_info, safe_uintmax const &mag) noexcept
+    {
+        constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+        constexpr safe_uintmax two{static_cast<bsl::uintmax>(2)};
+        constexpr safe_uintmax ten{static_cast<bsl::uintmax>(10)};
+        constexpr safe_uintmax hundred{static_cast<bsl::uintmax>(100)};
+
+        auto mut_mag{mag};
+        while (mut_mag >= hundred) {
+            safe_uintmax const idx{(mut_mag % hundred) * two};
+            mut_mag /= hundred;
+
+            fmt_impl_integral_push(mut_info, *DIGIT_PAIRS.at_if(idx + one));
+            fmt_impl_integral_push(mut_info, *DIGIT_PAIRS.at_if(idx));
+            mut_info.digits += two;
+        }
+
+        if (mut_mag >= ten) {
+            safe_uintmax const idx{mut_mag * two};
+
+            fmt_impl_integral_push(mut_info, *DIGIT_PAIRS.at_if(idx + one));
+            fmt_impl_integral_push(mut_info, *DIGIT_PAIRS.at_if(idx));
+            mut_info.digits += two;
+        }
+        else {
+            fmt_impl_integral_push(mut_info, *NIBBLES.at_if(mut_mag));
+            ++mut_info.digits;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds the digits of the provided magnitude to the provided
+    ///     info in base 2 or base 16. The digits are converted using
+    ///     shifts and masks instead of division.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to output
+    ///   @param mut_info the info to add the digits to
+    ///   @param mag the magnitude of the integral to add
+    ///   @param bits the number of bits in each digit (1 or 4)
+    ///
+    template<typename T>
+    constexpr void
+    get_integral_info_pow2(
+        fmt_impl_integral_info<T> &mut_info,
+        safe_uintmax const &mag,
+        safe_uintmax const &bits) noexcept
+    {
+        constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+        safe_uintmax const mask{(one << bits) - one};
+
+        if (mag.is_zero()) {
+            fmt_impl_integral_push(mut_info, '0');
+            ++mut_info.digits;
+            return;
+        }
+
+        for (auto mut_mag{mag}; mut_mag.is_pos(); mut_mag >>= bits) {
+            fmt_impl_integral_push(mut_info, *NIBBLES.at_if(mut_mag & mask));
+            ++mut_info.digits;
+        }
+    }
+
     /// <!-- description -->
     ///   @brief This function gathers information about an integral
     ///     number which is used by fmt_impl_integral. Specifically:
@@ -100,18 +220,16 @@ namespace bsl::details
     ///       includes things like "0x" and +/-. All of these
     ///       extra characters consume characters from any "width" the
     ///       user might have provided and need to be accounted for.
-    ///     - The fmt_impl_integral function use a common divide by base
-    ///       approach to convert a number to a string. This approach
-    ///       converts the number in reverse order, so the characters
-    ///       must be stored in a buffer and then outputted in reverse
-    ///       order.
-    ///     - The buffer that we store the digits in (which is in reverse
-    ///       order as stated above) is a simple C-style array and not a
-    ///       bsl::array as the bsl::array depends on this functionality
-    ///       which would create a circular reference.
+    ///     - The digits are written from the end of the buffer towards
+    ///       the front, which means that the total number of digits does
+    ///       not need to be known ahead of time, and the resulting string
+    ///       can be outputted with a single write. Base 10 is converted
+    ///       two digits at a time using a "00" through "99" table, while
+    ///       base 2 and base 16 are converted using shifts and a nibble
+    ///       table. The sign and prefix can later be added to the front
+    ///       of the same buffer.
     ///     - The total number of digits that the number will consume
-    ///       must also be recorded. This prevents the need to add a 0
-    ///       at the end of the buffer.
+    ///       must also be recorded as this is needed for alignment.
     ///
     /// <!-- inputs/outputs -->
     ///   @tparam T the type of integral to output
@@ -124,8 +242,11 @@ namespace bsl::details
     get_integral_info(fmt_options const &ops, safe_integral<T> const &val) noexcept
         -> fmt_impl_integral_info<T>
     {
-        constexpr safe_integral<T> base10{static_cast<T>(10)};
-        constexpr safe_integral<T> last_numerical_digit{static_cast<T>(9)};
+        constexpr safe_integral<T> base2{static_cast<T>(2)};
+        constexpr safe_integral<T> base16{static_cast<T>(16)};
+        constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+        constexpr safe_uintmax base2_bits{static_cast<bsl::uintmax>(1)};
+        constexpr safe_uintmax base16_bits{static_cast<bsl::uintmax>(4)};
 
         fmt_impl_integral_info<T> mut_info{};
         auto const base{get_integral_info_base(ops, mut_info)};
@@ -151,71 +272,77 @@ namespace bsl::details
             }
         }
 
-        if (val.is_zero()) {
-            ++mut_info.digits;
+        mut_info.start = INTEGRAL_BUF_SIZE - one;
+        auto const mag{get_integral_magnitude(val)};
+
+        if (base == base16) {
+            get_integral_info_pow2(mut_info, mag, base16_bits);
+        }
+        else if (base == base2) {
+            get_integral_info_pow2(mut_info, mag, base2_bits);
         }
         else {
-            auto mut_val{val};
-            for (mut_info.digits = {}; mut_info.digits < MAX_NUM_DIGITS; ++mut_info.digits) {
-                if (mut_val.is_zero()) {
-                    break;
-                }
-
-                safe_integral<T> mut_digit{mut_val % base};
-                mut_val /= base;
-
-                if constexpr (is_signed<T>::value) {
-                    if (mut_digit.is_neg()) {
-                        mut_digit = -mut_digit;
-                    }
-                    else {
-                        bsl::touch();
-                    }
-                }
-
-                if (mut_digit > last_numerical_digit) {
-                    mut_digit -= base10;
-                    mut_digit += static_cast<T>('A');
-                }
-                else {
-                    mut_digit += static_cast<T>('0');
-                }
-
-                *mut_info.buf.at_if(mut_info.digits) = static_cast<char_type>(mut_digit.get());
-            }
+            get_integral_info_dec(mut_info, mag);
         }
 
         return mut_info;
     }
 
     /// <!-- description -->
-    ///   @brief This function is responsible for implementing the guts
-    ///     for integral types. For integrals, all of the fmt options
-    ///     must be accounted for.
+    ///   @brief Adds any sign and "0x"/"0b" prefix to the front of the
+    ///     integral stored in the provided info, and returns the total
+    ///     number of characters that were added.
     ///
     /// <!-- inputs/outputs -->
-    ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
     ///   @tparam T the type of integral to output
-    ///   @param o the instance of out<T> to output to
     ///   @param ops ops the fmt options used to format the output
     ///   @param val the integral being outputted
+    ///   @param mut_info the info to add the sign and prefix to
+    ///   @return Returns the total number of characters that were added
     ///
-    template<typename OUT_T, typename T>
-    constexpr void
-    fmt_impl_integral(
-        out<OUT_T> const o, fmt_options const &ops, safe_integral<T> const &val) noexcept
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    fmt_impl_integral_add_extras(
+        fmt_options const &ops,
+        safe_integral<T> const &val,
+        fmt_impl_integral_info<T> &mut_info) noexcept -> safe_uintmax
     {
-        fmt_impl_integral_info<T> const info{get_integral_info(ops, val)};
-        safe_uintmax const padding{fmt_impl_align_pre(o, ops, info.digits + info.extras, false)};
+        auto const start{mut_info.start};
+
+        if (ops.alternate_form()) {
+            switch (ops.type()) {
+                case fmt_type::fmt_type_b: {
+                    fmt_impl_integral_push(mut_info, 'b');
+                    fmt_impl_integral_push(mut_info, '0');
+                    break;
+                }
+
+                case fmt_type::fmt_type_x: {
+                    fmt_impl_integral_push(mut_info, 'x');
+                    fmt_impl_integral_push(mut_info, '0');
+                    break;
+                }
+
+                case fmt_type::fmt_type_c:
+                case fmt_type::fmt_type_d:
+                case fmt_type::fmt_type_s:
+                case fmt_type::fmt_type_default: {
+                    break;
+                }
+            }
+        }
+        else {
+            bsl::touch();
+        }
 
         if (is_signed<T>::value) {
             switch (ops.sign()) {
                 case fmt_sign::fmt_sign_pos_neg: {
                     if (val.is_neg()) {
-                        o.write_to_console('-');
+                        fmt_impl_integral_push(mut_info, '-');
                     }
                     else {
-                        o.write_to_console('+');
+                        fmt_impl_integral_push(mut_info, '+');
                     }
 
                     break;
@@ -223,10 +350,10 @@ namespace bsl::details
 
                 case fmt_sign::fmt_sign_space_for_pos: {
                     if (val.is_neg()) {
-                        o.write_to_console('-');
+                        fmt_impl_integral_push(mut_info, '-');
                     }
                     else {
-                        o.write_to_console(' ');
+                        fmt_impl_integral_push(mut_info, ' ');
                     }
 
                     break;
@@ -234,7 +361,7 @@ namespace bsl::details
 
                 case fmt_sign::fmt_sign_neg_only: {
                     if (val.is_neg()) {
-                        o.write_to_console('-');
+                        fmt_impl_integral_push(mut_info, '-');
                     }
                     else {
                         bsl::touch();
@@ -248,50 +375,64 @@ namespace bsl::details
             bsl::touch();
         }
 
-        if (ops.alternate_form()) {
-            switch (ops.type()) {
-                case fmt_type::fmt_type_b: {
-                    o.write_to_console("0b");
-                    break;
-                }
+        return start - mut_info.start;
+    }
 
-                case fmt_type::fmt_type_x: {
-                    o.write_to_console("0x");
-                    break;
-                }
+    /// <!-- description -->
+    ///   @brief This function is responsible for implementing the guts
+    ///     for integral types. For integrals, all of the fmt options
+    ///     must be accounted for. The sign, prefix, any zero padding
+    ///     and the digits are all placed into a single buffer, which is
+    ///     then outputted with a single write. The only exception is
+    ///     zero padding that is too large for the buffer, in which case
+    ///     the zeros are outputted separately.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+    ///   @tparam T the type of integral to output
+    ///   @param o the instance of out<T> to output to
+    ///   @param ops ops the fmt options used to format the output
+    ///   @param val the integral being outputted
+    ///
+    template<typename OUT_T, typename T>
+    constexpr void
+    fmt_impl_integral(
+        out<OUT_T> const o, fmt_options const &ops, safe_integral<T> const &val) noexcept
+    {
+        fmt_impl_integral_info<T> mut_info{get_integral_info(ops, val)};
+        safe_uintmax const padding{
+            fmt_impl_align_pre(o, ops, mut_info.digits + mut_info.extras, false)};
 
-                case fmt_type::fmt_type_c:
-                case fmt_type::fmt_type_d:
-                case fmt_type::fmt_type_s:
-                case fmt_type::fmt_type_default: {
-                    break;
+        bool mut_padded{};
+        if (ops.sign_aware()) {
+            if ((padding + MAX_NUM_EXTRAS) < mut_info.start) {
+                for (safe_uintmax mut_pi{}; mut_pi < padding; ++mut_pi) {
+                    fmt_impl_integral_push(mut_info, '0');
                 }
-            }
-        }
-        else {
-            bsl::touch();
-        }
 
-        if (ops.sign_aware()) {
-            for (safe_uintmax mut_pi{}; mut_pi < padding; ++mut_pi) {
-                o.write_to_console('0');
+                mut_padded = true;
+            }
+            else {
+                bsl::touch();
             }
         }
         else {
-            bsl::touch();
+            mut_padded = true;
         }
 
-        if (val.is_zero()) {
-            o.write_to_console('0');
+        auto const num_extras{fmt_impl_integral_add_extras(ops, val, mut_info)};
+        if (mut_padded) {
+            o.write_to_console(mut_info.buf.at_if(mut_info.start));
         }
         else {
-            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
-            for (safe_uintmax mut_i{info.digits}; mut_i.is_pos(); --mut_i) {
-                o.write_to_console(*info.buf.at_if(mut_i - one));
-            }
+            o.write_to_console(mut_info.buf.at_if(mut_info.start), num_extras);
+
+            o.fill_to_console('0', padding);
+
+            o.write_to_console(mut_info.buf.at_if(mut_info.start + num_extras));
         }
 
-        fmt_impl_align_suf(o, ops, info.digits + info.extras, false);
+        fmt_impl_align_suf(o, ops, mut_info.digits + mut_info.extras, false);
     }
 }
 
@@ -33,6 +33,10 @@ namespace bsl::details
 {
     /// @brief stores the maximum number of digits.
     constexpr safe_uintmax MAX_NUM_DIGITS{static_cast<bsl::uintmax>(64)};
+    /// @brief stores the maximum number of sign and prefix characters.
+    constexpr safe_uintmax MAX_NUM_EXTRAS{static_cast<bsl::uintmax>(3)};
+    /// @brief stores the size of the buffer used to format an integral.
+    constexpr safe_uintmax INTEGRAL_BUF_SIZE{static_cast<bsl::uintmax>(128)};
 
     /// @class bsl::details::fmt_impl_integral_info
     ///
@@ -51,8 +55,11 @@ namespace bsl::details
         safe_uintmax extras{};
         /// @brief stores the total number digits that make up the integral
         safe_uintmax digits{};
-        /// @brief stores the integral as a string in reverse
-        array<char_type, MAX_NUM_DIGITS.get()> buf{};
+        /// @brief stores the index of the first character in buf to output
+        safe_uintmax start{};
+        /// @brief stores the integral as a '\0' terminated string that
+        ///   ends at the end of buf, and starts at "start"
+        array<char_type, INTEGRAL_BUF_SIZE.get()> buf{};
     };
 }
 
@@ -0,0 +1,87 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file fmt_impl_policy_integral.hpp
+///
+
+#ifndef BSL_DETAILS_FMT_IMPL_POLICY_INTEGRAL_HPP
+#define BSL_DETAILS_FMT_IMPL_POLICY_INTEGRAL_HPP
+
+#include "../fmt_options.hpp"
+#include "../policy_integral.hpp"
+#include "../safe_integral.hpp"
+#include "fmt_impl_integral.hpp"
+#include "out.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief This function is responsible for implementing bsl::fmt
+    ///     for bsl::policy_integral types (i.e., bsl::saturating_integral
+    ///     and bsl::wrapping_integral). A bsl::policy_integral is always
+    ///     valid, so this is formatted exactly like a valid
+    ///     bsl::safe_integral of the same type.
+    ///
+    /// <!-- notes -->
+    ///   @note This function exists in the details folder because it is
+    ///     private to the BSL, but it does not exist in the details namespace
+    ///     as it can be overridden by the user to provide their own
+    ///     fmt support for their own types.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+    ///   @tparam T the type of integral being outputted
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param o the instance of out<T> to output to
+    ///   @param ops ops the fmt options used to format the output
+    ///   @param val the integral being outputted
+    ///
+    template<typename OUT_T, typename T, typename P>
+    constexpr void
+    fmt_impl(out<OUT_T> const o, fmt_options const &ops, policy_integral<T, P> const &val) noexcept
+    {
+        fmt_impl(o, ops, safe_integral<T>{val.get()});
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::policy_integral to the
+    ///     provided output type.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T1 the type of outputter provided
+    ///   @tparam T2 the type of integral being outputted
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param val the integral to output
+    ///   @return return o
+    ///
+    template<typename T1, typename T2, typename P>
+    [[maybe_unused]] constexpr auto
+    operator<<(out<T1> const o, policy_integral<T2, P> const &val) noexcept -> out<T1>
+    {
+        return o << safe_integral<T2>{val.get()};
+    }
+}
+
+#endif
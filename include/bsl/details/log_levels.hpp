@@ -0,0 +1,91 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file log_levels.hpp
+///
+
+#ifndef BSL_DETAILS_LOG_LEVELS_HPP
+#define BSL_DETAILS_LOG_LEVELS_HPP
+
+#include "../array.hpp"
+#include "../cstdint.hpp"
+#include "../debug_levels.hpp"
+#include "../safe_integral.hpp"
+
+namespace bsl::details
+{
+    /// @brief defines the total number of log categories that are supported
+    constexpr bsl::uintmax LOG_MAX_CATEGORIES{static_cast<bsl::uintmax>(64)};
+
+    /// @brief defines the type of the table that stores each category's level
+    using log_levels_type = array<bsl::uint8, LOG_MAX_CATEGORIES>;
+
+    /// <!-- description -->
+    ///   @brief Returns a table with every category's level set to
+    ///     BSL_DEBUG_LEVEL, which is what each category starts at.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a table with every category's level set to
+    ///     BSL_DEBUG_LEVEL.
+    ///
+    [[nodiscard]] constexpr auto
+    make_log_levels() noexcept -> log_levels_type
+    {
+        log_levels_type mut_levels{};
+        for (safe_uintmax mut_i{}; mut_i < mut_levels.size(); ++mut_i) {
+            *mut_levels.at_if(mut_i) = static_cast<bsl::uint8>(BSL_DEBUG_LEVEL);
+        }
+
+        return mut_levels;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the global table that stores each category's
+    ///     level. The table is constant initialized, so reading from it
+    ///     is a single load with no initialization check.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the global table that stores each category's
+    ///     level.
+    ///
+    [[nodiscard]] inline auto
+    get_log_levels() noexcept -> log_levels_type &
+    {
+        static constinit log_levels_type mut_levels{make_log_levels()};
+        return mut_levels;
+    }
+
+    /// <!-- description -->
+    ///   @brief Called by bsl::log_category when it is given an invalid
+    ///     id or name, and by bsl::make_log_categories() when two
+    ///     categories share an id or name. This function is
+    ///     intentionally not a constexpr, which means that calling it
+    ///     from a consteval results in a compile-time error.
+    ///
+    inline void
+    log_category_invalid() noexcept
+    {}
+}
+
+#endif
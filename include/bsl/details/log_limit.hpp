@@ -0,0 +1,484 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file log_limit.hpp
+///
+
+#ifndef BSL_DETAILS_LOG_LIMIT_HPP
+#define BSL_DETAILS_LOG_LIMIT_HPP
+
+#include "../array.hpp"
+#include "../cstdint.hpp"
+#include "../cstr_type.hpp"
+#include "../discard.hpp"
+#include "../safe_integral.hpp"
+#include "../source_location.hpp"
+#include "../touch.hpp"
+
+#include <bsl/details/monotonic_ms.hpp>
+
+namespace bsl::details
+{
+    /// @brief defines the total number of call sites that can be limited or sampled
+    constexpr bsl::uintmax LOG_LIMIT_MAX_SITES{static_cast<bsl::uintmax>(64)};
+    /// @brief defines the default number of statements a call site can output in a burst
+    constexpr bsl::uintmax LOG_LIMIT_BURST{static_cast<bsl::uintmax>(10)};
+    /// @brief defines the default number of milliseconds it takes to earn another statement
+    constexpr bsl::uintmax LOG_LIMIT_INTERVAL_MS{static_cast<bsl::uintmax>(100)};
+    /// @brief defines the default sample rate (1 in N statements are output)
+    constexpr bsl::uintmax LOG_SAMPLE_RATE{static_cast<bsl::uintmax>(100)};
+    /// @brief defines the max number of suppressed statements between two clock reads
+    constexpr bsl::uintmax LOG_LIMIT_MAX_BACKOFF{static_cast<bsl::uintmax>(16)};
+
+    /// @brief defines the state of a site that has not been claimed
+    constexpr bsl::uintmax LOG_LIMIT_SITE_FREE{static_cast<bsl::uintmax>(0)};
+    /// @brief defines the state of a site that is being claimed
+    constexpr bsl::uintmax LOG_LIMIT_SITE_CLAIMING{static_cast<bsl::uintmax>(1)};
+    /// @brief defines the state of a site that has been claimed
+    constexpr bsl::uintmax LOG_LIMIT_SITE_READY{static_cast<bsl::uintmax>(2)};
+
+    /// @class bsl::details::log_limit_site
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the rate limiting and sampling state of a single
+    ///     call site, which is identified by its file name and line.
+    ///     Rate limiting uses a token bucket. Tokens are only refilled
+    ///     when the bucket is empty, from the time that has passed since
+    ///     the last refill. While a call site is being suppressed, the
+    ///     clock is not read on every statement. Each time a read finds
+    ///     that no token has been earned yet, the number of statements
+    ///     until the next read doubles, up to LOG_LIMIT_MAX_BACKOFF, and
+    ///     it goes back to 1 once a token is earned. So the cost of most
+    ///     suppressed statements is a failed take() and a counter
+    ///     increment.
+    ///
+    class log_limit_site final
+    {
+        /// @brief stores whether or not this site has been claimed
+        bsl::uintmax m_state;
+        /// @brief stores the file name of the call site
+        cstr_type m_file;
+        /// @brief stores the line of the call site
+        source_location::line_type m_line;
+        /// @brief stores the total number of statements that can be output
+        bsl::uintmax m_tokens;
+        /// @brief stores the time in milliseconds of the last refill
+        bsl::uintmax m_last;
+        /// @brief stores the number of statements suppressed since the last report
+        bsl::uintmax m_suppressed;
+        /// @brief stores the value of m_suppressed at which the clock is read again
+        bsl::uintmax m_check_at;
+        /// @brief stores the number of suppressed statements between clock reads
+        bsl::uintmax m_backoff;
+        /// @brief stores the total number of statements seen by the sampler
+        bsl::uintmax m_calls;
+        /// @brief stores whether or not a thread is currently refilling
+        bool m_refilling;
+
+        /// <!-- description -->
+        ///   @brief Takes a token from the bucket if one is available.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if a token was taken, false if the
+        ///     bucket is empty.
+        ///
+        [[nodiscard]] auto
+        take() noexcept -> bool
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+
+            bsl::uintmax mut_tokens{__atomic_load_n(&m_tokens, __ATOMIC_RELAXED)};
+            while (static_cast<bsl::uintmax>(0) != mut_tokens) {
+                safe_uintmax const tokens{mut_tokens};
+                if (__atomic_compare_exchange_n(
+                        &m_tokens,
+                        &mut_tokens,
+                        (tokens - one).get(),
+                        true,
+                        __ATOMIC_RELAXED,
+                        __ATOMIC_RELAXED)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a token for each INTERVAL_MS milliseconds that
+        ///     have passed since the last refill, up to BURST tokens. If
+        ///     another thread is already refilling, this does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam BURST the maximum number of tokens in the bucket
+        ///   @tparam INTERVAL_MS the number of milliseconds per token
+        ///
+        template<bsl::uintmax BURST, bsl::uintmax INTERVAL_MS>
+        void
+        refill() noexcept
+        {
+            constexpr safe_uintmax burst{BURST};
+            constexpr safe_uintmax interval{INTERVAL_MS};
+
+            safe_uintmax const now{monotonic_ms()};
+            safe_uintmax const last{__atomic_load_n(&m_last, __ATOMIC_RELAXED)};
+
+            if (last.is_pos()) {
+                if ((now - last) < interval) {
+                    return;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (__atomic_test_and_set(&m_refilling, __ATOMIC_ACQUIRE)) {
+                return;
+            }
+
+            safe_uintmax mut_earned{burst};
+            if (last.is_pos()) {
+                mut_earned = (now - last) / interval;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_earned.is_pos()) {
+                bsl::uintmax mut_tokens{__atomic_load_n(&m_tokens, __ATOMIC_RELAXED)};
+                while (true) {
+                    safe_uintmax mut_new{burst};
+                    if (mut_earned < burst) {
+                        mut_new = safe_uintmax{mut_tokens} + mut_earned;
+                        if (mut_new > burst) {
+                            mut_new = burst;
+                        }
+                        else {
+                            bsl::touch();
+                        }
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    if (__atomic_compare_exchange_n(
+                            &m_tokens,
+                            &mut_tokens,
+                            mut_new.get(),
+                            true,
+                            __ATOMIC_RELAXED,
+                            __ATOMIC_RELAXED)) {
+                        break;
+                    }
+
+                    bsl::touch();
+                }
+
+                __atomic_store_n(&m_last, now.get(), __ATOMIC_RELAXED);
+            }
+            else {
+                bsl::touch();
+            }
+
+            __atomic_clear(&m_refilling, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Called when a clock read did not earn a token. Doubles
+        ///     the number of suppressed statements until the next clock
+        ///     read, up to LOG_LIMIT_MAX_BACKOFF.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param count the value of m_suppressed when the clock was read
+        ///
+        void
+        backoff(safe_uintmax const &count) noexcept
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            constexpr safe_uintmax max{LOG_LIMIT_MAX_BACKOFF};
+
+            safe_uintmax mut_backoff{__atomic_load_n(&m_backoff, __ATOMIC_RELAXED)};
+            if (mut_backoff.is_zero()) {
+                mut_backoff = one;
+            }
+            else {
+                mut_backoff = (mut_backoff + mut_backoff).min(max);
+            }
+
+            __atomic_store_n(&m_backoff, mut_backoff.get(), __ATOMIC_RELAXED);
+            __atomic_store_n(&m_check_at, (count + mut_backoff).get(), __ATOMIC_RELAXED);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an unclaimed bsl::details::log_limit_site
+        ///
+        constexpr log_limit_site() noexcept    // --
+            : m_state{}
+            , m_file{}
+            , m_line{}
+            , m_tokens{}
+            , m_last{}
+            , m_suppressed{}
+            , m_check_at{}
+            , m_backoff{}
+            , m_calls{}
+            , m_refilling{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::details::log_limit_site
+        ///
+        constexpr ~log_limit_site() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr log_limit_site(log_limit_site const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr log_limit_site(log_limit_site &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(log_limit_site const &o) &noexcept
+            -> log_limit_site & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(log_limit_site &&mut_o) &noexcept
+            -> log_limit_site & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns true if this site belongs to the provided call
+        ///     site. If this site has not been claimed yet, it is claimed
+        ///     for the provided call site and true is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sloc the location of the call site
+        ///   @return Returns true if this site belongs to the provided
+        ///     call site, false otherwise.
+        ///
+        [[nodiscard]] auto
+        claim(source_location const &sloc) noexcept -> bool
+        {
+            bsl::uintmax mut_state{__atomic_load_n(&m_state, __ATOMIC_ACQUIRE)};
+            if (LOG_LIMIT_SITE_FREE == mut_state) {
+                if (__atomic_compare_exchange_n(
+                        &m_state,
+                        &mut_state,
+                        LOG_LIMIT_SITE_CLAIMING,
+                        false,
+                        __ATOMIC_ACQUIRE,
+                        __ATOMIC_ACQUIRE)) {
+                    m_file = sloc.file_name();
+                    m_line = sloc.line();
+                    __atomic_store_n(&m_state, LOG_LIMIT_SITE_READY, __ATOMIC_RELEASE);
+                    return true;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            while (LOG_LIMIT_SITE_CLAIMING == mut_state) {
+                mut_state = __atomic_load_n(&m_state, __ATOMIC_ACQUIRE);
+            }
+
+            if (m_line != sloc.line()) {
+                return false;
+            }
+
+            return m_file == sloc.file_name();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a statement from this call site should
+        ///     be output, or false if it should be suppressed. Call sites
+        ///     can output BURST statements at once, and then one more for
+        ///     every INTERVAL_MS milliseconds. Suppressed statements are
+        ///     counted, and can be retrieved using suppressed().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam BURST the maximum number of statements in a burst
+        ///   @tparam INTERVAL_MS the number of milliseconds it takes
+        ///     to earn another statement
+        ///   @return Returns true if the statement should be output,
+        ///     false if it should be suppressed.
+        ///
+        template<bsl::uintmax BURST, bsl::uintmax INTERVAL_MS>
+        [[nodiscard]] auto
+        limit() noexcept -> bool
+        {
+            static_assert(static_cast<bsl::uintmax>(0) != BURST);
+            static_assert(static_cast<bsl::uintmax>(0) != INTERVAL_MS);
+
+            if (this->take()) {
+                return true;
+            }
+
+            safe_uintmax const count{__atomic_load_n(&m_suppressed, __ATOMIC_RELAXED)};
+            if (count >= safe_uintmax{__atomic_load_n(&m_check_at, __ATOMIC_RELAXED)}) {
+                this->refill<BURST, INTERVAL_MS>();
+                if (this->take()) {
+                    __atomic_store_n(&m_backoff, static_cast<bsl::uintmax>(0), __ATOMIC_RELAXED);
+                    return true;
+                }
+
+                this->backoff(count);
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::discard(
+                __atomic_add_fetch(&m_suppressed, static_cast<bsl::uintmax>(1), __ATOMIC_RELAXED));
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of statements that were
+        ///     suppressed since the last time this was called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of statements that were
+        ///     suppressed since the last time this was called.
+        ///
+        [[nodiscard]] auto
+        suppressed() noexcept -> safe_uintmax
+        {
+            __atomic_store_n(&m_check_at, static_cast<bsl::uintmax>(0), __ATOMIC_RELAXED);
+            return safe_uintmax{
+                __atomic_exchange_n(&m_suppressed, static_cast<bsl::uintmax>(0), __ATOMIC_RELAXED)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true for 1 in every N statements from this
+        ///     call site, starting with the first one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam N the sample rate
+        ///   @return Returns true if the statement should be output,
+        ///     false if it should be suppressed.
+        ///
+        template<bsl::uintmax N>
+        [[nodiscard]] auto
+        sample() noexcept -> bool
+        {
+            static_assert(static_cast<bsl::uintmax>(0) != N);
+            constexpr safe_uintmax rate{N};
+
+            safe_uintmax const calls{
+                __atomic_fetch_add(&m_calls, static_cast<bsl::uintmax>(1), __ATOMIC_RELAXED)};
+
+            return (calls % rate).is_zero();
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the global table of rate limited and sampled
+    ///     call sites.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the global table of rate limited and sampled
+    ///     call sites.
+    ///
+    [[nodiscard]] inline auto
+    get_log_limit_sites() noexcept -> array<log_limit_site, LOG_LIMIT_MAX_SITES> &
+    {
+        static constinit array<log_limit_site, LOG_LIMIT_MAX_SITES> mut_sites{};
+        return mut_sites;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the state that is shared by every call site that
+    ///     did not fit in the global table of call sites.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the state that is shared by every call site that
+    ///     did not fit in the global table of call sites.
+    ///
+    [[nodiscard]] inline auto
+    get_log_limit_overflow_site() noexcept -> log_limit_site &
+    {
+        static constinit log_limit_site mut_site{};
+        return mut_site;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the state of the provided call site, claiming a
+    ///     site from the global table the first time a call site is
+    ///     seen. Sites are never given back, so if the table is full,
+    ///     the call site shares a single overflow site with every other
+    ///     call site that did not fit, which means that these call
+    ///     sites are still limited and sampled, just as a group.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sloc the location of the call site
+    ///   @return Returns the state of the provided call site
+    ///
+    [[nodiscard]] inline auto
+    log_limit_find(source_location const &sloc) noexcept -> log_limit_site &
+    {
+        constexpr safe_uintmax max{LOG_LIMIT_MAX_SITES};
+        safe_uintmax const start{static_cast<bsl::uintmax>(sloc.line()) % LOG_LIMIT_MAX_SITES};
+
+        for (safe_uintmax mut_i{}; mut_i < max; ++mut_i) {
+            auto *const pmut_site{get_log_limit_sites().at_if((start + mut_i) % max)};
+            if (pmut_site->claim(sloc)) {
+                return *pmut_site;
+            }
+
+            bsl::touch();
+        }
+
+        return get_log_limit_overflow_site();
+    }
+}
+
+#endif
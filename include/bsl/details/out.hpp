@@ -28,11 +28,19 @@
 #ifndef BSL_OUT_HPP
 #define BSL_OUT_HPP
 
+#include "../array.hpp"
 #include "../char_type.hpp"
+#include "../cstdio.hpp"
 #include "../cstr_type.hpp"
+#include "../cstring.hpp"
+#include "../discard.hpp"
 #include "../is_constant_evaluated.hpp"
 #include "../is_same.hpp"
+#include "../safe_integral.hpp"
+#include "out_buffer_target.hpp"
+#include "out_line_buffer.hpp"
 #include "out_type_alert.hpp"
+#include "out_type_buffer.hpp"
 #include "out_type_debug.hpp"
 #include "out_type_empty.hpp"
 #include "out_type_error.hpp"
@@ -42,9 +50,17 @@
 #include <bsl/details/putc_stdout.hpp>
 #include <bsl/details/puts_stderr.hpp>
 #include <bsl/details/puts_stdout.hpp>
+#include <bsl/details/write_stderr.hpp>
+#include <bsl/details/write_stdout.hpp>
 
 namespace bsl
 {
+    namespace details
+    {
+        /// @brief stores the size of the buffer used to output fills
+        constexpr bsl::uintmax OUT_FILL_SIZE{static_cast<bsl::uintmax>(64)};
+    }
+
     /// @class bsl::out
     ///
     /// <!-- description -->
@@ -204,9 +220,24 @@ namespace bsl
             return is_same<T, details::out_type_error>::value;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if this bsl::out outputs to the buffer
+        ///     provided to bsl::format_to instead of stdout or stderr.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this bsl::out outputs to the buffer
+        ///     provided to bsl::format_to instead of stdout or stderr.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_buffer() noexcept -> bool
+        {
+            return is_same<T, details::out_type_buffer>::value;
+        }
+
         /// <!-- description -->
         ///   @brief Outputs a character to either stdout or stderr,
-        ///     depending on the bsl::out's label.
+        ///     depending on the bsl::out's label, or to the buffer
+        ///     provided to bsl::format_to.
         ///
         /// <!-- inputs/outputs -->
         ///   @param c the character to output
@@ -219,26 +250,31 @@ namespace bsl
             }
 
             if constexpr (is_print()) {
-                details::putc_stdout(c);
+                write_to_stdout(c);
             }
 
             if constexpr (is_debug()) {
-                details::putc_stdout(c);
+                write_to_stdout(c);
             }
 
             if constexpr (is_alert()) {
-                details::putc_stderr(c);
+                write_to_stderr(c);
             }
 
             if constexpr (is_error()) {
-                details::putc_stderr(c);
+                make_urgent();
+                write_to_stderr(c);
+            }
+
+            if constexpr (is_buffer()) {
+                details::out_buffer_putc(c);
             }
         }
 
         /// <!-- description -->
         ///   @brief Outputs a string to either stdout or stderr,
-        ///     depending on the bsl::out's label. The string must end in
-        ///     a '\0'.
+        ///     depending on the bsl::out's label, or to the buffer
+        ///     provided to bsl::format_to. The string must end in a '\0'.
         ///
         /// <!-- inputs/outputs -->
         ///   @param str the string to output
@@ -251,21 +287,323 @@ namespace bsl
             }
 
             if constexpr (is_print()) {
-                details::puts_stdout(str);
+                write_to_stdout(str);
             }
 
             if constexpr (is_debug()) {
-                details::puts_stdout(str);
+                write_to_stdout(str);
             }
 
             if constexpr (is_alert()) {
-                details::puts_stderr(str);
+                write_to_stderr(str);
+            }
+
+            if constexpr (is_error()) {
+                make_urgent();
+                write_to_stderr(str);
+            }
+
+            if constexpr (is_buffer()) {
+                details::out_buffer_puts(str);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs "len" characters from the provided buffer to
+        ///     either stdout or stderr, depending on the bsl::out's label,
+        ///     or to the buffer provided to bsl::format_to. Unlike the
+        ///     string version of this function, the characters do not need
+        ///     to end in a '\0', and if output is not buffered, they are
+        ///     output using a single write.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to output
+        ///   @param len the total number of characters in str to output
+        ///
+        static constexpr void
+        write_to_console(char_type const *const str, safe_uintmax const &len) noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
+            }
+
+            if constexpr (is_print()) {
+                write_to_stdout(str, len);
+            }
+
+            if constexpr (is_debug()) {
+                write_to_stdout(str, len);
+            }
+
+            if constexpr (is_alert()) {
+                write_to_stderr(str, len);
             }
 
             if constexpr (is_error()) {
+                make_urgent();
+                write_to_stderr(str, len);
+            }
+
+            if constexpr (is_buffer()) {
+                details::out_buffer_write(str, len);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided character "count" times to either
+        ///     stdout or stderr, depending on the bsl::out's label, or to
+        ///     the buffer provided to bsl::format_to. Instead of outputting
+        ///     one character at a time, the character is copied into a
+        ///     small buffer which is then output in OUT_FILL_SIZE chunks.
+        ///     This is used to output padding and zero fills.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to output
+        ///   @param count the total number of times to output c
+        ///
+        static constexpr void
+        fill_to_console(char_type const c, safe_uintmax const &count) noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
+            }
+
+            if constexpr (empty()) {
+                return;
+            }
+
+            if (count.is_zero()) {
+                return;
+            }
+
+            array<char_type, details::OUT_FILL_SIZE> mut_buf{};
+            safe_uintmax mut_len{count.min(mut_buf.size())};
+            bsl::discard(builtin_memset(mut_buf.data(), c, mut_len));
+
+            for (safe_uintmax mut_i{}; mut_i < count; mut_i += mut_len) {
+                mut_len = (count - mut_i).min(mut_buf.size());
+                write_to_console(mut_buf.data(), mut_len);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes anything that the calling thread has buffered
+        ///     for either stdout or stderr (depending on the bsl::out's
+        ///     label). Buffered output is otherwise written when a '\n'
+        ///     is seen or the buffer is full. If BSL_OUT_BUFFER_SIZE is 0,
+        ///     output is not buffered and this function does nothing. If
+        ///     BSL_OUT_RING_SIZE is not 0, every thread's output ring is
+        ///     also drained before this function returns.
+        ///
+        static constexpr void
+        flush() noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
+            }
+
+            if constexpr (details::OUT_BUFFERED) {
+                if constexpr (is_print()) {
+                    details::get_out_line_buffer<false>().flush();
+                }
+
+                if constexpr (is_debug()) {
+                    details::get_out_line_buffer<false>().flush();
+                }
+
+                if constexpr (is_alert()) {
+                    details::get_out_line_buffer<true>().flush();
+                }
+
+                if constexpr (is_error()) {
+                    details::get_out_line_buffer<true>().flush();
+                }
+            }
+
+            if constexpr (details::OUT_ASYNC) {
+                bsl::discard(details::out_drain_all());
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of lines that were dropped
+        ///     because a thread's output ring was full. If
+        ///     BSL_OUT_RING_SIZE is 0, lines are never dropped and this
+        ///     function always returns 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of lines that were dropped
+        ///     because a thread's output ring was full.
+        ///
+        [[nodiscard]] static constexpr auto
+        dropped() noexcept -> safe_uintmax
+        {
+            if (is_constant_evaluated()) {
+                return {};
+            }
+
+            if constexpr (details::OUT_ASYNC) {
+                return details::out_ring_dropped();
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Makes the drain thread write every thread's output
+        ///     ring to the provided file instead of stdout and stderr, or
+        ///     back to stdout and stderr if pmut_file is a nullptr.
+        ///     Everything committed before this call is written to the
+        ///     previous destination first. The caller owns the file, and
+        ///     must not close it until it has been replaced. If
+        ///     BSL_OUT_RING_SIZE is 0, output is written synchronously and
+        ///     this function does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_file the file to write to, or a nullptr to write
+        ///     to stdout and stderr
+        ///
+        static constexpr void
+        set_file(FILE *const pmut_file) noexcept
+        {
+            if (is_constant_evaluated()) {
+                return;
+            }
+
+            if constexpr (details::OUT_ASYNC) {
+                details::out_ring_set_file(pmut_file);
+            }
+            else {
+                bsl::discard(pmut_file);
+            }
+        }
+
+    private:
+        /// <!-- description -->
+        ///   @brief Marks the calling thread's current stderr line as
+        ///     urgent, so that it is written before the line is complete
+        ///     instead of being left for the drain thread. This only does
+        ///     something if BSL_OUT_RING_SIZE is not 0.
+        ///
+        static constexpr void
+        make_urgent() noexcept
+        {
+            if constexpr (details::OUT_ASYNC) {
+                details::get_out_line_buffer<true>().urgent();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a character to stdout, using the calling
+        ///     thread's line buffer if output is buffered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to output
+        ///
+        static constexpr void
+        write_to_stdout(char_type const c) noexcept
+        {
+            if constexpr (details::OUT_BUFFERED) {
+                details::get_out_line_buffer<false>().putc(c);
+            }
+            else {
+                details::putc_stdout(c);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a character to stderr, using the calling
+        ///     thread's line buffer if output is buffered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to output
+        ///
+        static constexpr void
+        write_to_stderr(char_type const c) noexcept
+        {
+            if constexpr (details::OUT_BUFFERED) {
+                details::get_out_line_buffer<true>().putc(c);
+            }
+            else {
+                details::putc_stderr(c);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a string to stdout, using the calling
+        ///     thread's line buffer if output is buffered. The string
+        ///     must end in a '\0'.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to output
+        ///
+        static constexpr void
+        write_to_stdout(cstr_type const str) noexcept
+        {
+            if constexpr (details::OUT_BUFFERED) {
+                details::get_out_line_buffer<false>().puts(str);
+            }
+            else {
+                details::puts_stdout(str);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a string to stderr, using the calling
+        ///     thread's line buffer if output is buffered. The string
+        ///     must end in a '\0'.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to output
+        ///
+        static constexpr void
+        write_to_stderr(cstr_type const str) noexcept
+        {
+            if constexpr (details::OUT_BUFFERED) {
+                details::get_out_line_buffer<true>().puts(str);
+            }
+            else {
                 details::puts_stderr(str);
             }
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs "len" characters to stdout, using the calling
+        ///     thread's line buffer if output is buffered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to output
+        ///   @param len the total number of characters in str to output
+        ///
+        static constexpr void
+        write_to_stdout(char_type const *const str, safe_uintmax const &len) noexcept
+        {
+            if constexpr (details::OUT_BUFFERED) {
+                details::get_out_line_buffer<false>().write(str, len);
+            }
+            else {
+                details::write_stdout(str, len);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs "len" characters to stderr, using the calling
+        ///     thread's line buffer if output is buffered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to output
+        ///   @param len the total number of characters in str to output
+        ///
+        static constexpr void
+        write_to_stderr(char_type const *const str, safe_uintmax const &len) noexcept
+        {
+            if constexpr (details::OUT_BUFFERED) {
+                details::get_out_line_buffer<true>().write(str, len);
+            }
+            else {
+                details::write_stderr(str, len);
+            }
+        }
     };
 }
 
@@ -0,0 +1,254 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file out_buffer_target.hpp
+///
+
+#ifndef BSL_DETAILS_OUT_BUFFER_TARGET_HPP
+#define BSL_DETAILS_OUT_BUFFER_TARGET_HPP
+
+#include "../char_type.hpp"
+#include "../cstr_type.hpp"
+#include "../cstring.hpp"
+#include "../discard.hpp"
+#include "../safe_integral.hpp"
+#include "../touch.hpp"
+
+#include <bsl/details/thread_storage.hpp>
+
+namespace bsl::details
+{
+    /// @class bsl::details::out_buffer_target
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the characters sent to a bsl::out that was given
+    ///     the out_type_buffer label into a caller provided buffer instead
+    ///     of stdout or stderr. At most size - 1 characters are stored,
+    ///     and the characters stored are always followed by a '\0'. Any
+    ///     characters that do not fit are dropped, and the target is
+    ///     marked as truncated.
+    ///
+    class out_buffer_target final
+    {
+        /// @brief stores a pointer to the caller's buffer
+        char_type *m_buf;
+        /// @brief stores the total number of characters in m_buf
+        safe_uintmax m_size;
+        /// @brief stores the total number of characters written to m_buf
+        safe_uintmax m_count;
+        /// @brief stores whether or not any characters were dropped
+        bool m_truncated;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::details::out_buffer_target given a
+        ///     buffer and the size of the buffer. The buffer must not be
+        ///     a nullptr and the size must be at least 1.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_buf a pointer to the buffer to write to
+        ///   @param size the total number of characters in pmut_buf
+        ///
+        constexpr out_buffer_target(char_type *const pmut_buf, safe_uintmax const &size) noexcept
+            : m_buf{pmut_buf}, m_size{size}, m_count{}, m_truncated{}
+        {
+            *m_buf = '\0';
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a character to the buffer. If the buffer is full,
+        ///     the character is dropped and the target is marked as
+        ///     truncated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to add
+        ///
+        constexpr void
+        putc(char_type const c) noexcept
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+
+            if (m_count + one < m_size) {
+                m_buf[m_count.get()] = c;
+                ++m_count;
+                m_buf[m_count.get()] = '\0';
+            }
+            else {
+                m_truncated = true;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a string to the buffer. If the buffer is full,
+        ///     the remaining characters are dropped and the target is
+        ///     marked as truncated. The string must end in a '\0'.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to add
+        ///
+        constexpr void
+        puts(cstr_type const str) noexcept
+        {
+            this->write(str, builtin_strlen(str));
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds "len" characters from the provided buffer to the
+        ///     buffer using a single memcpy. If the buffer is full, the
+        ///     remaining characters are dropped and the target is marked
+        ///     as truncated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to add
+        ///   @param len the total number of characters in str to add
+        ///
+        constexpr void
+        write(char_type const *const str, safe_uintmax const &len) noexcept
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+
+            safe_uintmax const num{len.min(m_size - one - m_count)};
+            if (num < len) {
+                m_truncated = true;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (num.is_zero()) {
+                return;
+            }
+
+            bsl::discard(builtin_memcpy(&m_buf[m_count.get()], str, num));
+            m_count += num;
+            m_buf[m_count.get()] = '\0';
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of characters written to the
+        ///     buffer, not including the '\0'.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of characters written to the
+        ///     buffer, not including the '\0'.
+        ///
+        [[nodiscard]] constexpr auto
+        count() const noexcept -> safe_uintmax const &
+        {
+            return m_count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if any characters were dropped because
+        ///     the buffer was full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if any characters were dropped because
+        ///     the buffer was full.
+        ///
+        [[nodiscard]] constexpr auto
+        truncated() const noexcept -> bool
+        {
+            return m_truncated;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns a reference to the calling thread's current
+    ///     bsl::details::out_buffer_target, which is a nullptr unless the
+    ///     thread is inside of a call to bsl::format_to.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a reference to the calling thread's current
+    ///     bsl::details::out_buffer_target
+    ///
+    [[nodiscard]] inline auto
+    get_out_buffer_target() noexcept -> out_buffer_target *&
+    {
+        return thread_storage<out_buffer_target *>();
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds a character to the calling thread's current
+    ///     bsl::details::out_buffer_target. If there is no current target,
+    ///     the character is dropped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param c the character to add
+    ///
+    inline void
+    out_buffer_putc(char_type const c) noexcept
+    {
+        auto *const pmut_target{get_out_buffer_target()};
+        if (nullptr != pmut_target) {
+            pmut_target->putc(c);
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds a string to the calling thread's current
+    ///     bsl::details::out_buffer_target. If there is no current target,
+    ///     the string is dropped. The string must end in a '\0'.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to add
+    ///
+    inline void
+    out_buffer_puts(cstr_type const str) noexcept
+    {
+        auto *const pmut_target{get_out_buffer_target()};
+        if (nullptr != pmut_target) {
+            pmut_target->puts(str);
+        }
+        else {
+            bsl::touch();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds "len" characters from the provided buffer to the
+    ///     calling thread's current bsl::details::out_buffer_target. If
+    ///     there is no current target, the characters are dropped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the characters to add
+    ///   @param len the total number of characters in str to add
+    ///
+    inline void
+    out_buffer_write(char_type const *const str, safe_uintmax const &len) noexcept
+    {
+        auto *const pmut_target{get_out_buffer_target()};
+        if (nullptr != pmut_target) {
+            pmut_target->write(str, len);
+        }
+        else {
+            bsl::touch();
+        }
+    }
+}
+
+#endif
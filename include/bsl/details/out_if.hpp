@@ -0,0 +1,176 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file out_if.hpp
+///
+
+#ifndef BSL_DETAILS_OUT_IF_HPP
+#define BSL_DETAILS_OUT_IF_HPP
+
+#include "../declval.hpp"
+#include "../false_type.hpp"
+#include "../forward.hpp"
+#include "../is_same.hpp"
+#include "../touch.hpp"
+#include "../true_type.hpp"
+#include "../void_t.hpp"
+#include "out.hpp"
+#include "out_type_empty.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @class bsl::details::out_if_deferred
+        ///
+        /// <!-- description -->
+        ///   @brief Provides the member constant value equal to true if
+        ///     the provided type is a function that takes no arguments,
+        ///     meaning its output is deferred until it is called.
+        ///     Otherwise the member constant value is false.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam ALWAYS_VOID is always "void"
+        ///   @tparam U the type to query
+        ///
+        template<typename ALWAYS_VOID, typename U>
+        class out_if_deferred final : public false_type
+        {};
+
+        /// @class bsl::details::out_if_deferred
+        ///
+        /// <!-- description -->
+        ///   @brief Provides the member constant value equal to true if
+        ///     the provided type is a function that takes no arguments,
+        ///     meaning its output is deferred until it is called.
+        ///     Otherwise the member constant value is false.
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam U the type to query
+        ///
+        template<typename U>
+        class out_if_deferred<void_t<decltype(declval<U>()())>, U> final : public true_type
+        {};
+    }
+
+    /// @class bsl::out_if
+    ///
+    /// <!-- description -->
+    ///   @brief Returned by the category versions of bsl::debug() and
+    ///     bsl::alert(). Unlike bsl::out, whether or not output is
+    ///     enabled is decided at runtime, so a bsl::out_if stores the
+    ///     result of the category's level check. Every operator<< checks
+    ///     this result before forwarding its argument to bsl::out<T>.
+    ///     Like any other function argument, an operand is evaluated
+    ///     before operator<< is called, even if output is disabled. To
+    ///     ensure that an expensive operand is not evaluated, either
+    ///     test the bsl::out_if first, or pass a function that returns
+    ///     the operand, which is only called if output is enabled:
+    ///     @code
+    ///     if (auto const o{bsl::debug<bsl::V>(CAT)}) {
+    ///         o << "expensive: " << expensive() << bsl::endl;
+    ///     }
+    ///
+    ///     bsl::debug<bsl::V>(CAT) << "expensive: " << [] { return expensive(); };
+    ///     @endcode
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T Defines the type of label used.
+    ///
+    template<typename T>
+    class out_if final
+    {
+        /// @brief stores whether or not output is enabled
+        bool m_enabled;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::out_if
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param enabled true if output is enabled, false otherwise
+        ///
+        explicit constexpr out_if(bool const enabled) noexcept    // --
+            : m_enabled{enabled}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns true if output is enabled. If T is
+        ///     bsl::details::out_type_empty, output was disabled at
+        ///     compile-time, and this always returns false.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if output is enabled
+        ///
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            if constexpr (is_same<T, details::out_type_empty>::value) {
+                return false;
+            }
+
+            return m_enabled;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided argument using bsl::out<T> if the
+    ///     provided bsl::out_if is enabled. Otherwise, this does nothing.
+    ///     If the provided argument is a function that takes no
+    ///     arguments, it is only called if the bsl::out_if is enabled,
+    ///     and what it returns is outputted. If T is
+    ///     bsl::details::out_type_empty, output was disabled at
+    ///     compile-time and the function is never called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @tparam U the type of value being outputted
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param pudm_udm_arg the value to output
+    ///   @return return o
+    ///
+    template<typename T, typename U>
+    [[maybe_unused]] constexpr auto
+    operator<<(out_if<T> const o, U &&pudm_udm_arg) noexcept -> out_if<T>
+    {
+        if constexpr (is_same<T, details::out_type_empty>::value) {
+            return o;
+        }
+
+        if (o) {
+            if constexpr (details::out_if_deferred<void, U>::value) {
+                out<T>{} << bsl::forward<U>(pudm_udm_arg)();
+            }
+            else {
+                out<T>{} << bsl::forward<U>(pudm_udm_arg);
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        return o;
+    }
+}
+
+#endif
@@ -0,0 +1,416 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file out_line_buffer.hpp
+///
+
+#ifndef BSL_DETAILS_OUT_LINE_BUFFER_HPP
+#define BSL_DETAILS_OUT_LINE_BUFFER_HPP
+
+#include "../array.hpp"
+#include "../bool_constant.hpp"
+#include "../char_type.hpp"
+#include "../cstdint.hpp"
+#include "../cstr_type.hpp"
+#include "../cstring.hpp"
+#include "../discard.hpp"
+#include "../disjunction.hpp"
+#include "../safe_integral.hpp"
+#include "../touch.hpp"
+#include "out_ring.hpp"
+
+#include <bsl/details/thread_storage.hpp>
+#include <bsl/details/write_stderr.hpp>
+#include <bsl/details/write_stdout.hpp>
+
+namespace bsl::details
+{
+    /// @brief defines the size of each per-thread output buffer (0 == unbuffered)
+    constexpr bsl::uintmax OUT_BUFFER_SIZE{static_cast<bsl::uintmax>(BSL_OUT_BUFFER_SIZE)};
+    /// @brief defines whether or not bsl::out uses the per-thread output buffers
+    constexpr bool OUT_BUFFERED{static_cast<bsl::uintmax>(0) != OUT_BUFFER_SIZE};
+
+    /// <!-- description -->
+    ///   @brief Returns true if complete lines are committed to the
+    ///     per-thread output rings and written by the drain thread. This
+    ///     requires both BSL_OUT_BUFFER_SIZE and BSL_OUT_RING_SIZE to not
+    ///     be 0, as the rings only ever store complete lines.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns true if output is written by the drain thread
+    ///
+    [[nodiscard]] constexpr auto
+    out_async() noexcept -> bool
+    {
+        static_assert(
+            disjunction<
+                bool_constant<OUT_BUFFERED>,
+                bool_constant<static_cast<bsl::uintmax>(0) == OUT_RING_SIZE>>::value,
+            "BSL_OUT_RING_SIZE requires BSL_OUT_BUFFER_SIZE to not be 0");
+
+        if constexpr (OUT_BUFFERED) {
+            return static_cast<bsl::uintmax>(0) != OUT_RING_SIZE;
+        }
+
+        return false;
+    }
+
+    /// @brief defines whether or not bsl::out commits lines to the per-thread output rings
+    constexpr bool OUT_ASYNC{out_async()};
+
+    /// <!-- description -->
+    ///   @brief Returns the size of each per-thread output buffer. If
+    ///     output is not buffered, the buffers are never used, but they
+    ///     must still be valid types, so a size of 1 is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the size of each per-thread output buffer
+    ///
+    [[nodiscard]] constexpr auto
+    out_line_buffer_size() noexcept -> bsl::uintmax
+    {
+        if constexpr (OUT_BUFFERED) {
+            return OUT_BUFFER_SIZE;
+        }
+
+        return static_cast<bsl::uintmax>(1);
+    }
+
+    /// @class bsl::details::out_line_buffer
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the characters sent to bsl::out until a complete
+    ///     line has been formed, at which point the entire line is written
+    ///     to stdout or stderr with a single write. The buffer is also
+    ///     written when it is full, when flush() is called, or when the
+    ///     buffer is destroyed. Since each thread has its own buffer, lines
+    ///     written by different threads do not interleave, as long as each
+    ///     line fits in the buffer. If OUT_ASYNC is true, the line is
+    ///     committed to the thread's output ring instead, and is written
+    ///     later by the drain thread.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam IS_STDERR true if the buffer is written to stderr, false
+    ///     if the buffer is written to stdout
+    ///   @tparam N the total number of characters the buffer can hold
+    ///
+    template<bool IS_STDERR, bsl::uintmax N>
+    class out_line_buffer final
+    {
+        /// @brief stores the characters that have not been written yet
+        array<char_type, N> m_buf;
+        /// @brief stores the total number of characters in m_buf
+        safe_uintmax m_len;
+        /// @brief stores the ring this buffer commits to (OUT_ASYNC only)
+        out_ring<IS_STDERR, out_ring_size()> *m_ring;
+        /// @brief stores whether or not the line must be written synchronously
+        bool m_urgent;
+
+        /// <!-- description -->
+        ///   @brief Commits the buffer to the calling thread's output
+        ///     ring, claiming one the first time this is called. If the
+        ///     ring is full, the line is dropped and counted, unless it
+        ///     is urgent or the drain thread is not running, in which case
+        ///     every ring is drained first to make room. If the drain
+        ///     thread is not running, or the line is urgent, every ring is
+        ///     also drained before returning. If there are no rings left
+        ///     to claim, the buffer is written directly instead.
+        ///
+        void
+        commit() noexcept
+        {
+            static_assert(N <= OUT_RING_SIZE, "BSL_OUT_RING_SIZE must be >= BSL_OUT_BUFFER_SIZE");
+
+            bool const urgent{m_urgent};
+            m_urgent = false;
+
+            if (nullptr == m_ring) {
+                m_ring = out_ring_claim<IS_STDERR>();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (nullptr == m_ring) {
+                out_ring_write_direct<IS_STDERR>(m_buf.data(), m_len);
+                return;
+            }
+
+            if (!m_ring->fits(m_len)) {
+                // Only block on the drain lock if the line must not be
+                // lost. Otherwise, push() drops and counts the line.
+                bool mut_drain{urgent};
+                if (!out_ring_threaded()) {
+                    mut_drain = true;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (mut_drain) {
+                    bsl::discard(out_drain_all());
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::discard(m_ring->push(m_buf.data(), m_len));
+
+            if (urgent) {
+                bsl::discard(out_drain_all());
+                return;
+            }
+
+            // Pairs with the fence in out_ring_stop(). Either the line is
+            // visible to the final drain, or this thread sees that the
+            // drain thread was stopped and drains the line itself.
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (!out_ring_threaded()) {
+                bsl::discard(out_drain_all());
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::details::out_line_buffer
+        ///
+        constexpr out_line_buffer() noexcept    // --
+            : m_buf{}, m_len{}, m_ring{}, m_urgent{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroys a previously created
+        ///     bsl::details::out_line_buffer, writing anything that is
+        ///     left in the buffer and giving up its output ring.
+        ///
+        constexpr ~out_line_buffer() noexcept
+        {
+            this->flush();
+
+            if constexpr (OUT_ASYNC) {
+                if (nullptr != m_ring) {
+                    m_ring->release();
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr out_line_buffer(out_line_buffer const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr out_line_buffer(out_line_buffer &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_line_buffer const &o) &noexcept
+            -> out_line_buffer & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_line_buffer &&mut_o) &noexcept
+            -> out_line_buffer & = delete;
+
+        /// <!-- description -->
+        ///   @brief Adds a character to the buffer. If the character is a
+        ///     '\n', or the buffer is full, the buffer is written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to add
+        ///
+        constexpr void
+        putc(char_type const c) noexcept
+        {
+            *m_buf.at_if(m_len) = c;
+            ++m_len;
+
+            if ('\n' == c) {
+                this->flush();
+                return;
+            }
+
+            if (m_len == N) {
+                this->flush();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a string to the buffer. Each time a '\n' is seen,
+        ///     or the buffer is full, the buffer is written. The string
+        ///     must end in a '\0'.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the string to add
+        ///
+        constexpr void
+        puts(cstr_type const str) noexcept
+        {
+            this->write(str, builtin_strlen(str));
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds "len" characters from the provided buffer to the
+        ///     buffer. Each time a '\n' is seen, or the buffer is full, the
+        ///     buffer is written. Everything up to and including the next
+        ///     '\n' (or as much of it as fits) is copied into the buffer
+        ///     with a single memcpy.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the characters to add
+        ///   @param len the total number of characters in str to add
+        ///
+        constexpr void
+        write(char_type const *const str, safe_uintmax const &len) noexcept
+        {
+            constexpr safe_uintmax size{N};
+
+            safe_uintmax mut_i{};
+            while (mut_i < len) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                char_type const *const chunk{&str[mut_i.get()]};
+                safe_uintmax const max{(len - mut_i).min(size - m_len)};
+
+                bool mut_line{};
+                safe_uintmax mut_num{};
+                while (mut_num < max) {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    mut_line = ('\n' == chunk[mut_num.get()]);
+                    ++mut_num;
+
+                    if (mut_line) {
+                        break;
+                    }
+
+                    bsl::touch();
+                }
+
+                bsl::discard(builtin_memcpy(m_buf.at_if(m_len), chunk, mut_num));
+                m_len += mut_num;
+                mut_i += mut_num;
+
+                if (mut_line) {
+                    this->flush();
+                    continue;
+                }
+
+                if (size == m_len) {
+                    this->flush();
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the current line as urgent, which means that
+        ///     when it is committed, it is written before flush() returns
+        ///     instead of being left for the drain thread. This is used
+        ///     by bsl::error() so that errors are never lost or delayed.
+        ///
+        constexpr void
+        urgent() noexcept
+        {
+            m_urgent = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes anything in the buffer to stdout or stderr
+        ///     using a single write (or commits it to the output ring if
+        ///     OUT_ASYNC is true), and then empties the buffer.
+        ///
+        constexpr void
+        flush() noexcept
+        {
+            if (m_len.is_zero()) {
+                return;
+            }
+
+            if constexpr (OUT_ASYNC) {
+                this->commit();
+            }
+            else {
+                if constexpr (IS_STDERR) {
+                    write_stderr(m_buf.data(), m_len);
+                }
+                else {
+                    write_stdout(m_buf.data(), m_len);
+                }
+            }
+
+            m_len = static_cast<bsl::uintmax>(0);
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the calling thread's stdout or stderr line buffer.
+    ///     The buffer is created the first time a thread uses it, and is
+    ///     flushed and destroyed when the thread exits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam IS_STDERR true to return the stderr buffer, false to
+    ///     return the stdout buffer
+    ///   @return Returns the calling thread's stdout or stderr line buffer.
+    ///
+    template<bool IS_STDERR>
+    [[nodiscard]] inline auto
+    get_out_line_buffer() noexcept -> out_line_buffer<IS_STDERR, out_line_buffer_size()> &
+    {
+        return thread_storage<out_line_buffer<IS_STDERR, out_line_buffer_size()>>();
+    }
+}
+
+#endif
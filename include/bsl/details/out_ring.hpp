@@ -0,0 +1,867 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file out_ring.hpp
+///
+
+#ifndef BSL_DETAILS_OUT_RING_HPP
+#define BSL_DETAILS_OUT_RING_HPP
+
+#include "../array.hpp"
+#include "../char_type.hpp"
+#include "../cstdint.hpp"
+#include "../cstdio.hpp"
+#include "../cstring.hpp"
+#include "../discard.hpp"
+#include "../is_constant_evaluated.hpp"
+#include "../safe_integral.hpp"
+#include "../touch.hpp"
+#include "out_drain_result.hpp"
+
+#include <bsl/details/start_out_drain_thread.hpp>
+#include <bsl/details/write_file.hpp>
+#include <bsl/details/write_stderr.hpp>
+#include <bsl/details/write_stdout.hpp>
+
+namespace bsl::details
+{
+    /// @brief defines the size of each per-thread output ring (0 == synchronous output)
+    constexpr bsl::uintmax OUT_RING_SIZE{static_cast<bsl::uintmax>(BSL_OUT_RING_SIZE)};
+    /// @brief defines the total number of rings for each of stdout and stderr
+    constexpr bsl::uintmax OUT_MAX_RINGS{static_cast<bsl::uintmax>(64)};
+
+    /// <!-- description -->
+    ///   @brief Returns the size of each per-thread output ring. If
+    ///     output is synchronous, the rings are never used, but they
+    ///     must still be valid types, so a size of 1 is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the size of each per-thread output ring
+    ///
+    [[nodiscard]] constexpr auto
+    out_ring_size() noexcept -> bsl::uintmax
+    {
+        if constexpr (static_cast<bsl::uintmax>(0) != OUT_RING_SIZE) {
+            return OUT_RING_SIZE;
+        }
+
+        return static_cast<bsl::uintmax>(1);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a reference to the file that the rings are
+    ///     drained to, or a nullptr if they are drained to stdout and
+    ///     stderr. Only the holder of the drain lock may read or change
+    ///     the file.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns a reference to the file that the rings are
+    ///     drained to, or a nullptr if they are drained to stdout and
+    ///     stderr.
+    ///
+    [[nodiscard]] inline auto
+    get_out_ring_file() noexcept -> FILE *&
+    {
+        static constinit FILE *pmut_mut_file{};
+        return pmut_mut_file;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes "len" characters from the provided buffer to the
+    ///     file set by bsl::details::out_ring_set_file() or, if there is
+    ///     no file, to stdout or stderr. The caller must hold the drain
+    ///     lock.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam IS_STDERR true if the characters belong on stderr, false
+    ///     if they belong on stdout
+    ///   @param buf the characters to write
+    ///   @param len the total number of characters in buf to write
+    ///
+    template<bool IS_STDERR>
+    inline void
+    out_ring_write(char_type const *const buf, safe_uintmax const &len) noexcept
+    {
+        auto *const pmut_file{get_out_ring_file()};
+        if (nullptr != pmut_file) {
+            write_file(pmut_file, buf, len);
+            return;
+        }
+
+        if constexpr (IS_STDERR) {
+            write_stderr(buf, len);
+        }
+        else {
+            write_stdout(buf, len);
+        }
+    }
+
+    /// @class bsl::details::out_ring
+    ///
+    /// <!-- description -->
+    ///   @brief A lock-free, single-producer, single-consumer ring of
+    ///     characters. The producer is the thread that claimed the ring,
+    ///     which pushes complete lines from its bsl::details::out_line_buffer.
+    ///     The consumer is whoever holds the drain lock (usually the drain
+    ///     thread), which writes everything that has been committed to
+    ///     stdout or stderr (or the file set by out_ring_set_file()) using
+    ///     at most two writes. If a line does not fit, it is dropped and
+    ///     counted instead of blocking the producer. Only urgent lines,
+    ///     and lines committed when there is no drain thread, make the
+    ///     producer drain the rings itself to make room.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam IS_STDERR true if the ring is written to stderr, false
+    ///     if the ring is written to stdout
+    ///   @tparam N the total number of characters the ring can hold
+    ///
+    template<bool IS_STDERR, bsl::uintmax N>
+    class out_ring final
+    {
+        /// @brief stores the characters that have not been written yet
+        array<char_type, N> m_buf;
+        /// @brief stores the total number of characters ever pushed (producer owned)
+        bsl::uintmax m_head;
+        /// @brief stores the total number of characters ever written (consumer owned)
+        bsl::uintmax m_tail;
+        /// @brief stores the total number of lines that were dropped
+        bsl::uintmax m_dropped;
+        /// @brief stores whether or not a thread owns this ring
+        bool m_claimed;
+
+        /// <!-- description -->
+        ///   @brief Writes "len" characters starting at the provided
+        ///     index to stdout, stderr or the file set by
+        ///     out_ring_set_file().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index in m_buf to start writing from
+        ///   @param len the total number of characters to write
+        ///
+        void
+        write(safe_uintmax const &idx, safe_uintmax const &len) const noexcept
+        {
+            out_ring_write<IS_STDERR>(m_buf.at_if(idx), len);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an empty, unclaimed bsl::details::out_ring
+        ///
+        constexpr out_ring() noexcept    // --
+            : m_buf{}, m_head{}, m_tail{}, m_dropped{}, m_claimed{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::details::out_ring
+        ///
+        constexpr ~out_ring() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr out_ring(out_ring const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr out_ring(out_ring &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_ring const &o) &noexcept
+            -> out_ring & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_ring &&mut_o) &noexcept
+            -> out_ring & = delete;
+
+        /// <!-- description -->
+        ///   @brief Makes the calling thread the ring's producer. Returns
+        ///     false if another thread already owns the ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the calling thread now owns the ring,
+        ///     false otherwise.
+        ///
+        [[nodiscard]] auto
+        claim() noexcept -> bool
+        {
+            bool mut_expected{};
+            return __atomic_compare_exchange_n(
+                &m_claimed, &mut_expected, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives up ownership of the ring. Anything that was
+        ///     pushed but not yet written stays in the ring and is written
+        ///     by the next drain.
+        ///
+        void
+        release() noexcept
+        {
+            __atomic_store_n(&m_claimed, false, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if "len" characters can be added to the
+        ///     ring without dropping them. Only the thread that claimed
+        ///     the ring may call this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param len the total number of characters to add
+        ///   @return Returns true if "len" characters can be added to the
+        ///     ring without dropping them.
+        ///
+        [[nodiscard]] auto
+        fits(safe_uintmax const &len) const noexcept -> bool
+        {
+            constexpr safe_uintmax size{N};
+
+            safe_uintmax const head{__atomic_load_n(&m_head, __ATOMIC_RELAXED)};
+            safe_uintmax const tail{__atomic_load_n(&m_tail, __ATOMIC_ACQUIRE)};
+
+            return len <= (size - (head - tail));
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds "len" characters to the ring and commits them so
+        ///     that they can be drained. If there is not enough room, the
+        ///     characters are dropped, the drop is counted and false is
+        ///     returned. Only the thread that claimed the ring may call
+        ///     this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param buf the characters to add
+        ///   @param len the total number of characters in buf
+        ///   @return Returns true if the characters were added, false if
+        ///     they were dropped.
+        ///
+        [[nodiscard]] auto
+        push(char_type const *const buf, safe_uintmax const &len) noexcept -> bool
+        {
+            constexpr safe_uintmax size{N};
+
+            safe_uintmax const head{__atomic_load_n(&m_head, __ATOMIC_RELAXED)};
+            safe_uintmax const tail{__atomic_load_n(&m_tail, __ATOMIC_ACQUIRE)};
+
+            if (len > (size - (head - tail))) {
+                bsl::discard(__atomic_add_fetch(&m_dropped, 1U, __ATOMIC_RELAXED));
+                return false;
+            }
+
+            if (len.is_zero()) {
+                return true;
+            }
+
+            safe_uintmax const idx{head % size};
+            safe_uintmax mut_first{size - idx};
+            if (mut_first > len) {
+                mut_first = len;
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::discard(builtin_memcpy(m_buf.at_if(idx), buf, mut_first));
+            if (mut_first < len) {
+                // The rest of the line wraps around to the start of the
+                // ring, and len has already been checked against the size.
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                bsl::discard(builtin_memcpy(m_buf.data(), &buf[mut_first.get()], len - mut_first));
+            }
+            else {
+                bsl::touch();
+            }
+
+            __atomic_store_n(&m_head, (head + len).get(), __ATOMIC_RELEASE);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes everything that has been committed to stdout,
+        ///     stderr or the file set by out_ring_set_file(), using at most
+        ///     two writes. Only the holder of the drain lock may call this
+        ///     function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if anything was written, false if the
+        ///     ring was empty.
+        ///
+        [[nodiscard]] auto
+        drain() noexcept -> bool
+        {
+            constexpr safe_uintmax size{N};
+
+            safe_uintmax const tail{__atomic_load_n(&m_tail, __ATOMIC_RELAXED)};
+            safe_uintmax const head{__atomic_load_n(&m_head, __ATOMIC_ACQUIRE)};
+
+            if (head == tail) {
+                return false;
+            }
+
+            safe_uintmax const len{head - tail};
+            safe_uintmax const idx{tail % size};
+            safe_uintmax mut_first{size - idx};
+            if (mut_first > len) {
+                mut_first = len;
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->write(idx, mut_first);
+            if (mut_first < len) {
+                this->write({}, len - mut_first);
+            }
+            else {
+                bsl::touch();
+            }
+
+            __atomic_store_n(&m_tail, head.get(), __ATOMIC_RELEASE);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of lines that were dropped
+        ///     because the ring was full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of lines that were dropped
+        ///     because the ring was full.
+        ///
+        [[nodiscard]] auto
+        dropped() const noexcept -> safe_uintmax
+        {
+            return safe_uintmax{__atomic_load_n(&m_dropped, __ATOMIC_RELAXED)};
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the global pool of stdout or stderr rings. Each
+    ///     thread claims its own ring from the pool the first time it
+    ///     writes a line, so there is exactly one producer per ring.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam IS_STDERR true to return the stderr pool, false to
+    ///     return the stdout pool
+    ///   @return Returns the global pool of stdout or stderr rings
+    ///
+    template<bool IS_STDERR>
+    [[nodiscard]] inline auto
+    get_out_ring_pool() noexcept -> array<out_ring<IS_STDERR, out_ring_size()>, OUT_MAX_RINGS> &
+    {
+        static constinit array<out_ring<IS_STDERR, out_ring_size()>, OUT_MAX_RINGS> mut_pool{};
+        return mut_pool;
+    }
+
+    /// <!-- description -->
+    ///   @brief Drains every stdout and stderr ring. Stdout is drained
+    ///     first so that an error is written after the output that came
+    ///     before it. The caller must hold the drain lock.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns true if anything was written, false otherwise.
+    ///
+    [[nodiscard]] inline auto
+    out_drain_rings() noexcept -> bool
+    {
+        bool mut_drained{};
+        for (safe_uintmax mut_i{}; mut_i < OUT_MAX_RINGS; ++mut_i) {
+            if (get_out_ring_pool<false>().at_if(mut_i)->drain()) {
+                mut_drained = true;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        for (safe_uintmax mut_i{}; mut_i < OUT_MAX_RINGS; ++mut_i) {
+            if (get_out_ring_pool<true>().at_if(mut_i)->drain()) {
+                mut_drained = true;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        return mut_drained;
+    }
+
+    /// @class bsl::details::out_ring_state
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the global state shared by all of the rings,
+    ///     including the drain lock, which ensures there is only one
+    ///     consumer at a time. The state is constant initialized and is
+    ///     never destroyed, so the drain thread, and any thread that
+    ///     writes while the process exits, can always use it.
+    ///
+    class out_ring_state final
+    {
+        /// @brief stores whether or not a thread is currently draining
+        bool m_locked;
+        /// @brief stores whether or not the drain thread has been started
+        bool m_started;
+        /// @brief stores whether or not the drain thread is running
+        bool m_threaded;
+        /// @brief stores whether or not the drain thread has been stopped
+        bool m_stopped;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates the global ring state
+        ///
+        constexpr out_ring_state() noexcept    // --
+            : m_locked{}, m_started{}, m_threaded{}, m_stopped{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroys a previously created
+        ///     bsl::details::out_ring_state
+        ///
+        constexpr ~out_ring_state() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr out_ring_state(out_ring_state const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr out_ring_state(out_ring_state &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_ring_state const &o) &noexcept
+            -> out_ring_state & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_ring_state &&mut_o) &noexcept
+            -> out_ring_state & = delete;
+
+        /// <!-- description -->
+        ///   @brief Acquires the drain lock, spinning until it is free.
+        ///
+        void
+        lock() noexcept
+        {
+            while (__atomic_test_and_set(&m_locked, __ATOMIC_ACQUIRE)) {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the drain lock.
+        ///
+        void
+        unlock() noexcept
+        {
+            __atomic_clear(&m_locked, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true the first time it is called, and false
+        ///     every time after that.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true the first time it is called, and false
+        ///     every time after that.
+        ///
+        [[nodiscard]] auto
+        start() noexcept -> bool
+        {
+            return !__atomic_test_and_set(&m_started, __ATOMIC_ACQ_REL);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records whether or not the drain thread is running.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val true if the drain thread is running
+        ///
+        void
+        set_threaded(bool const val) noexcept
+        {
+            __atomic_store_n(&m_threaded, val, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the drain thread is running.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the drain thread is running.
+        ///
+        [[nodiscard]] auto
+        threaded() const noexcept -> bool
+        {
+            return __atomic_load_n(&m_threaded, __ATOMIC_ACQUIRE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the drain thread to stop the next time it
+        ///     calls its drain function. The caller must hold the drain
+        ///     lock.
+        ///
+        void
+        stop() noexcept
+        {
+            __atomic_store_n(&m_stopped, true, __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the drain thread has been stopped.
+        ///     The caller must hold the drain lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the drain thread has been stopped.
+        ///
+        [[nodiscard]] auto
+        stopped() const noexcept -> bool
+        {
+            return __atomic_load_n(&m_stopped, __ATOMIC_RELAXED);
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the global ring state.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the global ring state.
+    ///
+    [[nodiscard]] inline auto
+    get_out_ring_state() noexcept -> out_ring_state &
+    {
+        static constinit out_ring_state mut_state{};
+        return mut_state;
+    }
+
+    /// <!-- description -->
+    ///   @brief Synchronously writes everything that has been committed
+    ///     to every stdout and stderr ring.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns true if anything was written, false otherwise.
+    ///
+    [[maybe_unused]] inline auto
+    out_drain_all() noexcept -> bool
+    {
+        auto &mut_state{get_out_ring_state()};
+
+        mut_state.lock();
+        bool const drained{out_drain_rings()};
+        mut_state.unlock();
+
+        return drained;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes "len" characters from the provided buffer without
+    ///     going through a ring. This is used by threads that could not
+    ///     claim a ring. The drain lock is held while writing, so the
+    ///     write is not interleaved with a drain or a change of file.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam IS_STDERR true if the characters belong on stderr, false
+    ///     if they belong on stdout
+    ///   @param buf the characters to write
+    ///   @param len the total number of characters in buf to write
+    ///
+    template<bool IS_STDERR>
+    inline void
+    out_ring_write_direct(char_type const *const buf, safe_uintmax const &len) noexcept
+    {
+        auto &mut_state{get_out_ring_state()};
+
+        mut_state.lock();
+        out_ring_write<IS_STDERR>(buf, len);
+        mut_state.unlock();
+    }
+
+    /// <!-- description -->
+    ///   @brief Makes the rings drain to the provided file instead of
+    ///     stdout and stderr, or back to stdout and stderr if pmut_file
+    ///     is a nullptr. Everything committed before this call is
+    ///     written to the previous destination first. The caller owns
+    ///     the file, and must not close it until it has been replaced.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_file the file to drain to, or a nullptr for stdout
+    ///     and stderr
+    ///
+    inline void
+    out_ring_set_file(FILE *const pmut_file) noexcept
+    {
+        auto &mut_state{get_out_ring_state()};
+
+        mut_state.lock();
+        bsl::discard(out_drain_rings());
+        get_out_ring_file() = pmut_file;
+        mut_state.unlock();
+    }
+
+    /// <!-- description -->
+    ///   @brief Called over and over by the drain thread. Drains every
+    ///     ring until the drain thread is stopped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns out_drain_result_drained if anything was
+    ///     written, out_drain_result_idle if the drain thread should wait
+    ///     before calling again, and out_drain_result_stopped if the
+    ///     drain thread should exit.
+    ///
+    [[nodiscard]] inline auto
+    out_drain_thread_func() noexcept -> out_drain_result
+    {
+        auto &mut_state{get_out_ring_state()};
+
+        mut_state.lock();
+        if (mut_state.stopped()) {
+            mut_state.unlock();
+            return out_drain_result::out_drain_result_stopped;
+        }
+
+        bool const drained{out_drain_rings()};
+        mut_state.unlock();
+
+        if (drained) {
+            return out_drain_result::out_drain_result_drained;
+        }
+
+        return out_drain_result::out_drain_result_idle;
+    }
+
+    /// <!-- description -->
+    ///   @brief Stops the drain thread (if it is running), waits for it
+    ///     to exit, and then writes anything left in the rings. Once
+    ///     stopped, the drain thread is never started again, and lines
+    ///     are drained by the thread that commits them. This is called
+    ///     when the process exits, and calling it more than once is
+    ///     safe.
+    ///
+    inline void
+    out_ring_stop() noexcept
+    {
+        auto &mut_state{get_out_ring_state()};
+
+        if (mut_state.start()) {
+            bsl::discard(out_drain_all());
+            return;
+        }
+
+        if (mut_state.threaded()) {
+            mut_state.lock();
+            mut_state.stop();
+            mut_state.unlock();
+
+            stop_out_drain_thread();
+            mut_state.set_threaded(false);
+        }
+        else {
+            bsl::touch();
+        }
+
+        // Pairs with the fence in out_line_buffer::commit(). Either the
+        // committing thread sees that the drain thread is not running
+        // and drains its own line, or the line is visible here.
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        bsl::discard(out_drain_all());
+    }
+
+    /// @class bsl::details::out_ring_stopper
+    ///
+    /// <!-- description -->
+    ///   @brief Calls bsl::details::out_ring_stop() when it is
+    ///     destroyed. A single instance is created when the drain thread
+    ///     is started, which means that it is destroyed when the process
+    ///     exits, before anything it depends on is destroyed.
+    ///
+    class out_ring_stopper final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::details::out_ring_stopper
+        ///
+        constexpr out_ring_stopper() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief Destroys a previously created
+        ///     bsl::details::out_ring_stopper, stopping the drain thread
+        ///     and writing anything left in the rings.
+        ///
+        ~out_ring_stopper() noexcept
+        {
+            out_ring_stop();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr out_ring_stopper(out_ring_stopper const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr out_ring_stopper(out_ring_stopper &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_ring_stopper const &o) &noexcept
+            -> out_ring_stopper & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(out_ring_stopper &&mut_o) &noexcept
+            -> out_ring_stopper & = delete;
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns true if the drain thread is running, in which
+    ///     case committed lines are written in the background. The drain
+    ///     thread is started the first time this is called, and is
+    ///     stopped when the process exits. If the platform cannot start
+    ///     it, or it has been stopped, false is returned and lines are
+    ///     drained by the thread that commits them.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns true if the drain thread is running, false
+    ///     otherwise.
+    ///
+    [[nodiscard]] inline auto
+    out_ring_threaded() noexcept -> bool
+    {
+        auto &mut_state{get_out_ring_state()};
+        if (mut_state.start()) {
+            static out_ring_stopper const stopper{};
+            bsl::discard(stopper);
+
+            mut_state.set_threaded(start_out_drain_thread(&out_drain_thread_func));
+        }
+        else {
+            bsl::touch();
+        }
+
+        return mut_state.threaded();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a ring from the stdout or stderr pool that is now
+    ///     owned by the calling thread, or a nullptr if every ring in the
+    ///     pool is owned by another thread.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam IS_STDERR true to claim a stderr ring, false to claim a
+    ///     stdout ring
+    ///   @return Returns a ring owned by the calling thread, or a nullptr
+    ///     if the pool is exhausted.
+    ///
+    template<bool IS_STDERR>
+    [[nodiscard]] inline auto
+    out_ring_claim() noexcept -> out_ring<IS_STDERR, out_ring_size()> *
+    {
+        for (safe_uintmax mut_i{}; mut_i < OUT_MAX_RINGS; ++mut_i) {
+            auto *const pmut_ring{get_out_ring_pool<IS_STDERR>().at_if(mut_i)};
+            if (pmut_ring->claim()) {
+                return pmut_ring;
+            }
+
+            bsl::touch();
+        }
+
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the total number of lines that were dropped
+    ///     because a ring was full.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of lines that were dropped
+    ///     because a ring was full.
+    ///
+    [[nodiscard]] inline auto
+    out_ring_dropped() noexcept -> safe_uintmax
+    {
+        safe_uintmax mut_dropped{};
+        for (safe_uintmax mut_i{}; mut_i < OUT_MAX_RINGS; ++mut_i) {
+            mut_dropped += get_out_ring_pool<false>().at_if(mut_i)->dropped();
+            mut_dropped += get_out_ring_pool<true>().at_if(mut_i)->dropped();
+        }
+
+        return mut_dropped;
+    }
+}
+
+#endif
@@ -0,0 +1,326 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file saturating_policy.hpp
+///
+
+#ifndef BSL_DETAILS_SATURATING_POLICY_HPP
+#define BSL_DETAILS_SATURATING_POLICY_HPP
+
+#include "../cstdint.hpp"
+#include "../is_signed.hpp"
+#include "../numeric_limits.hpp"
+#include "../safe_integral.hpp"
+#include "../touch.hpp"
+#include "../unlikely.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Returns true if val is negative. Unsigned values are
+    ///     never negative.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of value to check
+    ///   @param val the value to check
+    ///   @return Returns true if val is negative.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    saturating_is_neg(T const val) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(val) < static_cast<bsl::intmax>(0);
+        }
+        else {
+            return false;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns numeric_limits<T>::min() if neg is true,
+    ///     otherwise returns numeric_limits<T>::max(). The limit is
+    ///     computed by flipping the bits of max() (which yields min()
+    ///     for both signed and unsigned types), so no branch is needed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of limit to return
+    ///   @param neg true to return min(), false to return max()
+    ///   @return Returns numeric_limits<T>::min() if neg is true,
+    ///     otherwise returns numeric_limits<T>::max().
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    saturating_limit(bool const neg) noexcept -> T
+    {
+        constexpr T zero{static_cast<T>(0)};
+        T const mask{static_cast<T>(zero - static_cast<T>(neg))};
+
+        return static_cast<T>(numeric_limits<T>::max() ^ mask);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns limit if overflow is true, otherwise returns
+    ///     res. The selection is done using a mask instead of a branch
+    ///     so that the overflow flag does not have to be predicted.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of value to select
+    ///   @param overflow true if the operation overflowed
+    ///   @param res the result of the operation
+    ///   @param limit the limit to saturate to
+    ///   @return Returns limit if overflow is true, otherwise returns
+    ///     res.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    saturating_select(bool const overflow, T const res, T const limit) noexcept -> T
+    {
+        constexpr T zero{static_cast<T>(0)};
+        T const mask{static_cast<T>(zero - static_cast<T>(overflow))};
+
+        return static_cast<T>(res ^ static_cast<T>(static_cast<T>(res ^ limit) & mask));
+    }
+
+    /// @class bsl::details::saturating_policy
+    ///
+    /// <!-- description -->
+    ///   @brief Implements the arithmetic of a bsl::saturating_integral.
+    ///     Each operation clamps its result to numeric_limits<T>::min()
+    ///     and numeric_limits<T>::max() instead of overflowing. The
+    ///     operations are implemented using the compiler's overflow
+    ///     builtins and a branch-free select of the limit, so they
+    ///     compile down to a conditional move.
+    ///
+    struct saturating_policy final
+    {
+        /// <!-- description -->
+        ///   @brief Returns lhs + rhs, clamped to the limits of T.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to add
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs + rhs, clamped to the limits of T.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        add(T const lhs, T const rhs) noexcept -> T
+        {
+            T mut_res{};
+            T const limit{saturating_limit<T>(saturating_is_neg(rhs))};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bool const overflow{__builtin_add_overflow(lhs, rhs, &mut_res)};
+            return saturating_select(overflow, mut_res, limit);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs - rhs, clamped to the limits of T.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to subtract
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs - rhs, clamped to the limits of T.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        sub(T const lhs, T const rhs) noexcept -> T
+        {
+            T mut_res{};
+            T const limit{saturating_limit<T>(!saturating_is_neg(rhs))};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bool const overflow{__builtin_sub_overflow(lhs, rhs, &mut_res)};
+            return saturating_select(overflow, mut_res, limit);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs * rhs, clamped to the limits of T.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to multiply
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs * rhs, clamped to the limits of T.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        mul(T const lhs, T const rhs) noexcept -> T
+        {
+            T mut_res{};
+            T const limit{
+                saturating_limit<T>(saturating_is_neg(lhs) != saturating_is_neg(rhs))};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bool const overflow{__builtin_mul_overflow(lhs, rhs, &mut_res)};
+            return saturating_select(overflow, mut_res, limit);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs / rhs, clamped to the limits of T (i.e.,
+        ///     min() / -1 returns max()). Dividing by 0 is still a bug,
+        ///     and is reported at compile-time. At run-time, dividing by 0
+        ///     returns 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to divide
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs / rhs, clamped to the limits of T.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        div(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T zero{static_cast<T>(0)};
+
+            if (unlikely(zero == rhs)) {
+                integral_overflow_underflow_wrap_error();
+                return zero;
+            }
+
+            if constexpr (is_signed<T>::value) {
+                constexpr bsl::intmax neg_one{static_cast<bsl::intmax>(-1)};
+
+                if (numeric_limits<T>::min() == lhs) {
+                    if (neg_one == static_cast<bsl::intmax>(rhs)) {
+                        return numeric_limits<T>::max();
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                return static_cast<T>(
+                    static_cast<bsl::intmax>(lhs) / static_cast<bsl::intmax>(rhs));
+            }
+            else {
+                return static_cast<T>(
+                    static_cast<bsl::uintmax>(lhs) / static_cast<bsl::uintmax>(rhs));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs % rhs (i.e., min() % -1 returns 0). Taking
+        ///     the modulus of 0 is still a bug, and is reported at
+        ///     compile-time. At run-time, taking the modulus of 0 returns 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to mod
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs % rhs
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        mod(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T zero{static_cast<T>(0)};
+
+            if (unlikely(zero == rhs)) {
+                integral_overflow_underflow_wrap_error();
+                return zero;
+            }
+
+            if constexpr (is_signed<T>::value) {
+                constexpr bsl::intmax neg_one{static_cast<bsl::intmax>(-1)};
+
+                if (neg_one == static_cast<bsl::intmax>(rhs)) {
+                    return zero;
+                }
+
+                return static_cast<T>(
+                    static_cast<bsl::intmax>(lhs) % static_cast<bsl::intmax>(rhs));
+            }
+            else {
+                return static_cast<T>(
+                    static_cast<bsl::uintmax>(lhs) % static_cast<bsl::uintmax>(rhs));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs << rhs, clamped to numeric_limits<T>::max()
+        ///     if any set bits would be shifted out.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to shift
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs << rhs, clamped to numeric_limits<T>::max()
+        ///     if any set bits would be shifted out.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        shl(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T zero{static_cast<T>(0)};
+            constexpr T digits{static_cast<T>(numeric_limits<T>::digits)};
+
+            if (zero == lhs) {
+                return zero;
+            }
+
+            if (rhs >= digits) {
+                return numeric_limits<T>::max();
+            }
+
+            if (lhs > static_cast<T>(numeric_limits<T>::max() >> rhs)) {
+                return numeric_limits<T>::max();
+            }
+
+            return static_cast<T>(lhs << rhs);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs >> rhs. Shifting by the number of bits in
+        ///     T or more returns 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to shift
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs >> rhs. Shifting by the number of bits in
+        ///     T or more returns 0.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        shr(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T zero{static_cast<T>(0)};
+            constexpr T digits{static_cast<T>(numeric_limits<T>::digits)};
+
+            if (rhs >= digits) {
+                return zero;
+            }
+
+            return static_cast<T>(lhs >> rhs);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,478 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file trace_arg.hpp
+///
+
+#ifndef BSL_DETAILS_TRACE_ARG_HPP
+#define BSL_DETAILS_TRACE_ARG_HPP
+
+#include "../cstdint.hpp"
+#include "../cstr_type.hpp"
+#include "../discard.hpp"
+#include "../enable_if.hpp"
+#include "../is_bool.hpp"
+#include "../is_integral.hpp"
+#include "../is_signed.hpp"
+#include "../make_unsigned.hpp"
+#include "../nullptr_t.hpp"
+#include "../safe_integral.hpp"
+#include "../string_view.hpp"
+#include "../touch.hpp"
+#include "../unlikely.hpp"
+#include "trace_tag.hpp"
+
+namespace bsl::details
+{
+    /// @brief defines the size of a record's header (id, length and number of arguments)
+    constexpr safe_uintmax TRACE_HEADER_SIZE{static_cast<bsl::uintmax>(7)};
+    /// @brief defines the offset of the record's length in the header
+    constexpr safe_uintmax TRACE_LEN_OFFSET{static_cast<bsl::uintmax>(4)};
+    /// @brief defines the offset of the record's number of arguments in the header
+    constexpr safe_uintmax TRACE_NUM_ARGS_OFFSET{static_cast<bsl::uintmax>(6)};
+    /// @brief defines the max number of arguments in a record
+    constexpr safe_uintmax TRACE_MAX_NUM_ARGS{static_cast<bsl::uintmax>(0xFFU)};
+    /// @brief defines the max size of a record
+    constexpr safe_uintmax TRACE_MAX_RECORD_SIZE{static_cast<bsl::uintmax>(0xFFFFU)};
+    /// @brief defines the max number of characters stored for a string_view
+    constexpr safe_uintmax TRACE_MAX_STR_SIZE{static_cast<bsl::uintmax>(0xFFU)};
+    /// @brief defines the number of bytes used to store a pointer
+    constexpr safe_uintmax TRACE_PTR_SIZE{static_cast<bsl::uintmax>(sizeof(bsl::uint64))};
+
+    /// <!-- description -->
+    ///   @brief Stores the provided unsigned integral at the provided
+    ///     index in little endian byte order. Since the index and the
+    ///     number of bytes are usually known at compile-time, the
+    ///     compiler turns this into a single store.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to store
+    ///   @param pmut_rec the record to store the integral in
+    ///   @param idx the index in pmut_rec to store the integral at
+    ///   @param val the integral to store
+    ///
+    template<typename T>
+    constexpr void
+    trace_store(bsl::uint8 *const pmut_rec, safe_uintmax const &idx, T const val) noexcept
+    {
+        constexpr safe_uintmax size{static_cast<bsl::uintmax>(sizeof(T))};
+        constexpr safe_uintmax bits_per_byte{static_cast<bsl::uintmax>(8)};
+
+        for (safe_uintmax mut_i{}; mut_i < size; ++mut_i) {
+            // The record is a raw buffer of bytes that is sized by the
+            // caller before anything is stored.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            pmut_rec[(idx + mut_i).get()] =
+                static_cast<bsl::uint8>(val >> (mut_i * bits_per_byte).get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the unsigned integral stored at the provided index
+    ///     in little endian byte order.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of unsigned integral to load
+    ///   @param rec the record to load the integral from
+    ///   @param idx the index in rec to load the integral from
+    ///   @return Returns the unsigned integral stored at the provided index
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    trace_load(bsl::uint8 const *const rec, safe_uintmax const &idx) noexcept -> T
+    {
+        constexpr safe_uintmax size{static_cast<bsl::uintmax>(sizeof(T))};
+        constexpr safe_uintmax bits_per_byte{static_cast<bsl::uintmax>(8)};
+
+        T mut_val{};
+        for (safe_uintmax mut_i{}; mut_i < size; ++mut_i) {
+            // The caller ensures that the record contains idx + sizeof(T)
+            // bytes before anything is loaded.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto const byte{static_cast<T>(rec[(idx + mut_i).get()])};
+            mut_val |= static_cast<T>(byte << (mut_i * bits_per_byte).get());
+        }
+
+        return mut_val;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the tag for the provided integral type.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to get the tag for
+    ///   @return Returns the tag for the provided integral type.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    trace_integral_tag() noexcept -> trace_tag
+    {
+        if constexpr (sizeof(T) == sizeof(bsl::uint8)) {
+            if constexpr (is_signed<T>::value) {
+                return trace_tag::trace_tag_i8;
+            }
+
+            return trace_tag::trace_tag_u8;
+        }
+
+        if constexpr (sizeof(T) == sizeof(bsl::uint16)) {
+            if constexpr (is_signed<T>::value) {
+                return trace_tag::trace_tag_i16;
+            }
+
+            return trace_tag::trace_tag_u16;
+        }
+
+        if constexpr (sizeof(T) == sizeof(bsl::uint32)) {
+            if constexpr (is_signed<T>::value) {
+                return trace_tag::trace_tag_i32;
+            }
+
+            return trace_tag::trace_tag_u32;
+        }
+
+        if constexpr (is_signed<T>::value) {
+            return trace_tag::trace_tag_i64;
+        }
+
+        return trace_tag::trace_tag_u64;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to store
+    ///   @param val the argument to store
+    ///   @return Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    trace_arg_size(safe_integral<T> const &val) noexcept -> safe_uintmax
+    {
+        constexpr safe_uintmax size{static_cast<bsl::uintmax>(sizeof(T))};
+
+        bsl::discard(val);
+        return size;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to store
+    ///   @param val the argument to store
+    ///   @return Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    template<
+        typename T,
+        enable_if_t<is_integral<T>::value, bool> = true,
+        enable_if_t<!is_bool<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    trace_arg_size(T const val) noexcept -> safe_uintmax
+    {
+        return trace_arg_size(safe_integral<T>{val});
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val the argument to store
+    ///   @return Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    [[nodiscard]] constexpr auto
+    trace_arg_size(bool const val) noexcept -> safe_uintmax
+    {
+        constexpr safe_uintmax size{static_cast<bsl::uintmax>(1)};
+
+        bsl::discard(val);
+        return size;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of pointer to store
+    ///   @param ptr the argument to store
+    ///   @return Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    trace_arg_size(T const *const ptr) noexcept -> safe_uintmax
+    {
+        bsl::discard(ptr);
+        return TRACE_PTR_SIZE;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ptr the argument to store
+    ///   @return Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    [[nodiscard]] constexpr auto
+    trace_arg_size(bsl::nullptr_t const ptr) noexcept -> safe_uintmax
+    {
+        bsl::discard(ptr);
+        return TRACE_PTR_SIZE;
+    }
+
+    /// <!-- description -->
+    ///   @brief C-style strings are not supported as they would otherwise
+    ///     be stored as a pointer. Use a bsl::string_view instead.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str ignored
+    ///   @return ignored
+    ///
+    [[nodiscard]] constexpr auto trace_arg_size(cstr_type const str) noexcept
+        -> safe_uintmax = delete;
+
+    /// <!-- description -->
+    ///   @brief Returns the number of characters that are stored for the
+    ///     provided string. Strings longer than TRACE_MAX_STR_SIZE are
+    ///     truncated.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to store
+    ///   @return Returns the number of characters that are stored for the
+    ///     provided string.
+    ///
+    [[nodiscard]] constexpr auto
+    trace_str_len(string_view const &str) noexcept -> safe_uintmax
+    {
+        if (str.length() > TRACE_MAX_STR_SIZE) {
+            return TRACE_MAX_STR_SIZE;
+        }
+
+        return str.length();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of payload bytes needed to store the
+    ///     provided argument (a length byte followed by the characters).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the argument to store
+    ///   @return Returns the number of payload bytes needed to store the
+    ///     provided argument.
+    ///
+    [[nodiscard]] constexpr auto
+    trace_arg_size(string_view const &str) noexcept -> safe_uintmax
+    {
+        constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+        return one + trace_str_len(str);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the provided argument's tag at mut_tag and its
+    ///     payload at mut_pos, and then advances both.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to store
+    ///   @param pmut_rec the record to store the argument in
+    ///   @param mut_tag the index of the argument's tag
+    ///   @param mut_pos the index of the argument's payload
+    ///   @param val the argument to store
+    ///
+    template<typename T>
+    constexpr void
+    trace_arg_store(
+        bsl::uint8 *const pmut_rec,
+        safe_uintmax &mut_tag,
+        safe_uintmax &mut_pos,
+        safe_integral<T> const &val) noexcept
+    {
+        auto mut_tag_val{static_cast<bsl::uint8>(trace_integral_tag<T>())};
+        T mut_val{};
+        if (unlikely(val.invalid())) {
+            mut_tag_val |= TRACE_TAG_ERROR;
+        }
+        else {
+            mut_val = val.get();
+        }
+
+        trace_store(pmut_rec, mut_tag, mut_tag_val);
+        if constexpr (is_signed<T>::value) {
+            trace_store(pmut_rec, mut_pos, static_cast<make_unsigned_t<T>>(mut_val));
+        }
+        else {
+            trace_store(pmut_rec, mut_pos, mut_val);
+        }
+
+        ++mut_tag;
+        mut_pos += trace_arg_size(val);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the provided argument's tag at mut_tag and its
+    ///     payload at mut_pos, and then advances both.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to store
+    ///   @param pmut_rec the record to store the argument in
+    ///   @param mut_tag the index of the argument's tag
+    ///   @param mut_pos the index of the argument's payload
+    ///   @param val the argument to store
+    ///
+    template<
+        typename T,
+        enable_if_t<is_integral<T>::value, bool> = true,
+        enable_if_t<!is_bool<T>::value, bool> = true>
+    constexpr void
+    trace_arg_store(
+        bsl::uint8 *const pmut_rec,
+        safe_uintmax &mut_tag,
+        safe_uintmax &mut_pos,
+        T const val) noexcept
+    {
+        trace_arg_store(pmut_rec, mut_tag, mut_pos, safe_integral<T>{val});
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the provided argument's tag at mut_tag and its
+    ///     payload at mut_pos, and then advances both.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_rec the record to store the argument in
+    ///   @param mut_tag the index of the argument's tag
+    ///   @param mut_pos the index of the argument's payload
+    ///   @param val the argument to store
+    ///
+    constexpr void
+    trace_arg_store(
+        bsl::uint8 *const pmut_rec,
+        safe_uintmax &mut_tag,
+        safe_uintmax &mut_pos,
+        bool const val) noexcept
+    {
+        trace_store(pmut_rec, mut_tag, static_cast<bsl::uint8>(trace_tag::trace_tag_bool));
+        trace_store(pmut_rec, mut_pos, static_cast<bsl::uint8>(val));
+
+        ++mut_tag;
+        mut_pos += trace_arg_size(val);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the provided argument's tag at mut_tag and its
+    ///     payload at mut_pos, and then advances both.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of pointer to store
+    ///   @param pmut_rec the record to store the argument in
+    ///   @param mut_tag the index of the argument's tag
+    ///   @param mut_pos the index of the argument's payload
+    ///   @param ptr the argument to store
+    ///
+    template<typename T>
+    constexpr void
+    trace_arg_store(
+        bsl::uint8 *const pmut_rec,
+        safe_uintmax &mut_tag,
+        safe_uintmax &mut_pos,
+        T const *const ptr) noexcept
+    {
+        trace_store(pmut_rec, mut_tag, static_cast<bsl::uint8>(trace_tag::trace_tag_ptr));
+
+        // We must convert the pointer to an integer before we can store
+        // it. There is no math being performed to this number.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto const val{static_cast<bsl::uint64>(reinterpret_cast<bsl::uintptr>(ptr))};
+        trace_store(pmut_rec, mut_pos, val);
+
+        ++mut_tag;
+        mut_pos += trace_arg_size(ptr);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the provided argument's tag at mut_tag and its
+    ///     payload at mut_pos, and then advances both.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_rec the record to store the argument in
+    ///   @param mut_tag the index of the argument's tag
+    ///   @param mut_pos the index of the argument's payload
+    ///   @param ptr the argument to store
+    ///
+    constexpr void
+    trace_arg_store(
+        bsl::uint8 *const pmut_rec,
+        safe_uintmax &mut_tag,
+        safe_uintmax &mut_pos,
+        bsl::nullptr_t const ptr) noexcept
+    {
+        trace_store(pmut_rec, mut_tag, static_cast<bsl::uint8>(trace_tag::trace_tag_ptr));
+        trace_store(pmut_rec, mut_pos, static_cast<bsl::uint64>(0));
+
+        ++mut_tag;
+        mut_pos += trace_arg_size(ptr);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the provided argument's tag at mut_tag and its
+    ///     payload at mut_pos, and then advances both.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_rec the record to store the argument in
+    ///   @param mut_tag the index of the argument's tag
+    ///   @param mut_pos the index of the argument's payload
+    ///   @param str the argument to store
+    ///
+    constexpr void
+    trace_arg_store(
+        bsl::uint8 *const pmut_rec,
+        safe_uintmax &mut_tag,
+        safe_uintmax &mut_pos,
+        string_view const &str) noexcept
+    {
+        constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+        auto const len{trace_str_len(str)};
+
+        trace_store(pmut_rec, mut_tag, static_cast<bsl::uint8>(trace_tag::trace_tag_str));
+        trace_store(pmut_rec, mut_pos, static_cast<bsl::uint8>(len.get()));
+
+        for (safe_uintmax mut_i{}; mut_i < len; ++mut_i) {
+            auto const c{static_cast<bsl::uint8>(*str.at_if(mut_i))};
+            trace_store(pmut_rec, mut_pos + one + mut_i, c);
+        }
+
+        ++mut_tag;
+        mut_pos += trace_arg_size(str);
+    }
+}
+
+#endif
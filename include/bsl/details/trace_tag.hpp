@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file trace_tag.hpp
+///
+
+#ifndef BSL_DETAILS_TRACE_TAG_HPP
+#define BSL_DETAILS_TRACE_TAG_HPP
+
+#include "../cstdint.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Defines the type of each argument stored in a bsl::trace
+    ///     record, which tells the decoder how many bytes the argument
+    ///     uses, and how to format it. If an integral argument was invalid
+    ///     (i.e., its error flag was set), TRACE_TAG_ERROR is added to its
+    ///     tag.
+    ///
+    enum class trace_tag : bsl::uint8
+    {
+        trace_tag_u8 = 1U,
+        trace_tag_u16 = 2U,
+        trace_tag_u32 = 3U,
+        trace_tag_u64 = 4U,
+        trace_tag_i8 = 5U,
+        trace_tag_i16 = 6U,
+        trace_tag_i32 = 7U,
+        trace_tag_i64 = 8U,
+        trace_tag_bool = 9U,
+        trace_tag_ptr = 10U,
+        trace_tag_str = 11U,
+    };
+
+    /// @brief defines the bit that is added to the tag of an invalid integral
+    constexpr bsl::uint8 TRACE_TAG_ERROR{static_cast<bsl::uint8>(0x80U)};
+}
+
+#endif
@@ -0,0 +1,227 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file wrapping_policy.hpp
+///
+
+#ifndef BSL_DETAILS_WRAPPING_POLICY_HPP
+#define BSL_DETAILS_WRAPPING_POLICY_HPP
+
+#include "../cstdint.hpp"
+#include "../discard.hpp"
+#include "../is_signed.hpp"
+#include "../numeric_limits.hpp"
+#include "../safe_integral.hpp"
+#include "../unlikely.hpp"
+
+namespace bsl::details
+{
+    /// @class bsl::details::wrapping_policy
+    ///
+    /// <!-- description -->
+    ///   @brief Implements the arithmetic of a bsl::wrapping_integral.
+    ///     Each operation is explicitly modular (i.e., it wraps on
+    ///     overflow, underflow and signed overflow using two's
+    ///     complement).
+    ///
+    struct wrapping_policy final
+    {
+        /// <!-- description -->
+        ///   @brief Returns lhs + rhs, modulo 2^N.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to add
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs + rhs, modulo 2^N.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        add(T const lhs, T const rhs) noexcept -> T
+        {
+            T mut_res{};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bsl::discard(__builtin_add_overflow(lhs, rhs, &mut_res));
+            return mut_res;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs - rhs, modulo 2^N.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to subtract
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs - rhs, modulo 2^N.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        sub(T const lhs, T const rhs) noexcept -> T
+        {
+            T mut_res{};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bsl::discard(__builtin_sub_overflow(lhs, rhs, &mut_res));
+            return mut_res;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs * rhs, modulo 2^N. Note that unlike the
+        ///     built-in operator, this does not suffer from integer
+        ///     promotion (i.e., multiplying two large uint16 values does
+        ///     not result in signed overflow).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to multiply
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs * rhs, modulo 2^N.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        mul(T const lhs, T const rhs) noexcept -> T
+        {
+            T mut_res{};
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            bsl::discard(__builtin_mul_overflow(lhs, rhs, &mut_res));
+            return mut_res;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs / rhs, modulo 2^N (i.e., min() / -1
+        ///     returns min()). Dividing by 0 is still a bug, and is reported
+        ///     at compile-time. At run-time, dividing by 0 returns 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to divide
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs / rhs, modulo 2^N.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        div(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T zero{static_cast<T>(0)};
+
+            if (unlikely(zero == rhs)) {
+                integral_overflow_underflow_wrap_error();
+                return zero;
+            }
+
+            if constexpr (is_signed<T>::value) {
+                constexpr bsl::intmax neg_one{static_cast<bsl::intmax>(-1)};
+
+                if (neg_one == static_cast<bsl::intmax>(rhs)) {
+                    return sub(zero, lhs);
+                }
+
+                return static_cast<T>(
+                    static_cast<bsl::intmax>(lhs) / static_cast<bsl::intmax>(rhs));
+            }
+            else {
+                return static_cast<T>(
+                    static_cast<bsl::uintmax>(lhs) / static_cast<bsl::uintmax>(rhs));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs % rhs (i.e., min() % -1 returns 0). Taking
+        ///     the modulus of 0 is still a bug, and is reported at
+        ///     compile-time. At run-time, taking the modulus of 0 returns 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to mod
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs % rhs
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        mod(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T zero{static_cast<T>(0)};
+
+            if (unlikely(zero == rhs)) {
+                integral_overflow_underflow_wrap_error();
+                return zero;
+            }
+
+            if constexpr (is_signed<T>::value) {
+                constexpr bsl::intmax neg_one{static_cast<bsl::intmax>(-1)};
+
+                if (neg_one == static_cast<bsl::intmax>(rhs)) {
+                    return zero;
+                }
+
+                return static_cast<T>(
+                    static_cast<bsl::intmax>(lhs) % static_cast<bsl::intmax>(rhs));
+            }
+            else {
+                return static_cast<T>(
+                    static_cast<bsl::uintmax>(lhs) % static_cast<bsl::uintmax>(rhs));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs << (rhs % N), where N is the number of bits
+        ///     in T (i.e., the shift amount wraps as well).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to shift
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs << (rhs % N)
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        shl(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T mask{static_cast<T>(numeric_limits<T>::digits - 1)};
+            return static_cast<T>(lhs << static_cast<T>(rhs & mask));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns lhs >> (rhs % N), where N is the number of bits
+        ///     in T (i.e., the shift amount wraps as well).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of values to shift
+        ///   @param lhs the left hand side of the operation
+        ///   @param rhs the right hand side of the operation
+        ///   @return Returns lhs >> (rhs % N)
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        shr(T const lhs, T const rhs) noexcept -> T
+        {
+            constexpr T mask{static_cast<T>(numeric_limits<T>::digits - 1)};
+            return static_cast<T>(lhs >> static_cast<T>(rhs & mask));
+        }
+    };
+}
+
+#endif
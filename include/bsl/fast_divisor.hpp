@@ -0,0 +1,372 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file fast_divisor.hpp
+///
+
+#ifndef BSL_FAST_DIVISOR_HPP
+#define BSL_FAST_DIVISOR_HPP
+
+#include "cstdint.hpp"
+#include "enable_if.hpp"
+#include "is_same.hpp"
+#include "is_unsigned.hpp"
+#include "mul_hi.hpp"
+#include "safe_integral.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief defines the number of bits in a byte
+        constexpr bsl::uint32 FAST_DIVISOR_BITS_PER_BYTE{static_cast<bsl::uint32>(8)};
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of bits in T
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type to query
+        ///   @return Returns the total number of bits in T
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        fast_divisor_bits() noexcept -> bsl::uint32
+        {
+            return static_cast<bsl::uint32>(sizeof(T)) * FAST_DIVISOR_BITS_PER_BYTE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns floor(log2(val)). val must not be 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to query
+        ///   @param val the value to query
+        ///   @return Returns floor(log2(val))
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        fast_divisor_log2(T const val) noexcept -> bsl::uint32
+        {
+            constexpr T one{static_cast<T>(1)};
+
+            bsl::uint32 mut_log{};
+            for (T mut_val{static_cast<T>(val >> one)}; T{} != mut_val; mut_val >>= one) {
+                ++mut_log;
+            }
+
+            return mut_log;
+        }
+    }
+
+    /// @class bsl::fast_divisor
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a divisor that does not change once it is known
+    ///     (e.g., a page size, a cache line size, the capacity of a ring
+    ///     or a TSC frequency) together with a precomputed magic multiplier
+    ///     and shift. Dividing by a bsl::fast_divisor replaces the hardware
+    ///     divide with a multiply, an optional add and a shift, which is
+    ///     several times faster. The results (including errors) are the
+    ///     same as the bsl::safe_integral divide and modulus operators.
+    ///     Creating a bsl::fast_divisor does perform a divide, so it should
+    ///     be created once and reused.
+    ///   @include example_fast_divisor_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the unsigned integral type of the divisor
+    ///
+    template<typename T>
+    class fast_divisor final
+    {
+        static_assert(is_unsigned<T>::value, "only unsigned integral types are supported");
+
+        /// @brief stores the divisor
+        T m_div;
+        /// @brief stores the magic multiplier
+        T m_magic;
+        /// @brief stores the total number of bits to shift by
+        bsl::uint32 m_shift;
+        /// @brief stores whether or not the divisor is a power of 2
+        bool m_pow2;
+        /// @brief stores whether or not the divide requires an add
+        bool m_add;
+        /// @brief stores whether or not the divisor is invalid (or 0)
+        bool m_error;
+
+        /// <!-- description -->
+        ///   @brief Precomputes the magic multiplier and shift for the
+        ///     provided divisor using the round-up method from Granlund and
+        ///     Montgomery (the same method used by libdivide).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param div the divisor to precompute
+        ///
+        constexpr void
+        precompute(T const div) noexcept
+        {
+            using wide_type = details::mul_wide_unsigned_t<T>;
+            constexpr bsl::uint32 bits{details::fast_divisor_bits<T>()};
+            constexpr T one{static_cast<T>(1)};
+
+            if (unlikely(T{} == div)) {
+                m_error = true;
+                return;
+            }
+
+            m_div = div;
+            m_shift = details::fast_divisor_log2(div);
+
+            if (T{} == (div & static_cast<T>(div - one))) {
+                m_pow2 = true;
+                return;
+            }
+
+            wide_type const num{static_cast<wide_type>(1) << (bits + m_shift)};
+            T mut_magic{static_cast<T>(num / static_cast<wide_type>(div))};
+            T const rem{static_cast<T>(num % static_cast<wide_type>(div))};
+
+            if (static_cast<T>(div - rem) < static_cast<T>(one << m_shift)) {
+                m_add = false;
+            }
+            else {
+                T const twice_rem{static_cast<T>(rem + rem)};
+                mut_magic = static_cast<T>(mut_magic + mut_magic);
+                if (twice_rem < div) {
+                    if (twice_rem < rem) {
+                        ++mut_magic;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+                else {
+                    ++mut_magic;
+                }
+
+                m_add = true;
+            }
+
+            m_magic = static_cast<T>(mut_magic + one);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns val / m_div. The divisor must be valid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the dividend
+        ///   @return Returns val / m_div
+        ///
+        [[nodiscard]] constexpr auto
+        quotient(T const val) const noexcept -> T
+        {
+            constexpr T one{static_cast<T>(1)};
+
+            if (m_pow2) {
+                return static_cast<T>(val >> m_shift);
+            }
+
+            T const hi{details::mul_hi_raw(m_magic, val)};
+            if (m_add) {
+                T const sum{static_cast<T>(static_cast<T>(static_cast<T>(val - hi) >> one) + hi)};
+                return static_cast<T>(sum >> m_shift);
+            }
+
+            return static_cast<T>(hi >> m_shift);
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+
+        /// <!-- description -->
+        ///   @brief Default constructor that creates an invalid
+        ///     bsl::fast_divisor. Dividing by an invalid bsl::fast_divisor
+        ///     results in an error, just like dividing by 0.
+        ///
+        constexpr fast_divisor() noexcept    // --
+            : m_div{}, m_magic{}, m_shift{}, m_pow2{}, m_add{}, m_error{true}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fast_divisor given a BSL fixed width
+        ///     type. If div is 0, the resulting bsl::fast_divisor is invalid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param div the divisor
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        explicit constexpr fast_divisor(U const div) noexcept    // --
+            : m_div{}, m_magic{}, m_shift{}, m_pow2{}, m_add{}, m_error{}
+        {
+            this->precompute(div);
+        }
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fast_divisor given a bsl::safe_integral.
+        ///     If div is 0 or invalid, the resulting bsl::fast_divisor is
+        ///     invalid. Creating a bsl::fast_divisor from an invalid
+        ///     bsl::safe_integral is also reported as an illegal use.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param div the divisor
+        ///
+        explicit constexpr fast_divisor(safe_integral<T> const &div) noexcept    // --
+            : m_div{}, m_magic{}, m_shift{}, m_pow2{}, m_add{}, m_error{}
+        {
+            if (unlikely(div.invalid())) {
+                illegal_use_of_invalid_safe_integral();
+                m_error = true;
+                return;
+            }
+
+            this->precompute(div.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the divisor as a bsl::safe_integral. If the
+        ///     bsl::fast_divisor is invalid, bsl::safe_integral<T>::failure()
+        ///     is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the divisor as a bsl::safe_integral.
+        ///
+        [[nodiscard]] constexpr auto
+        get() const noexcept -> safe_integral<value_type>
+        {
+            if (unlikely(m_error)) {
+                return safe_integral<value_type>::failure();
+            }
+
+            return safe_integral<value_type>{m_div};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::fast_divisor is invalid (i.e.,
+        ///     it was created from 0 or an invalid bsl::safe_integral).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::fast_divisor is invalid
+        ///
+        [[nodiscard]] constexpr auto
+        invalid() const noexcept -> bool
+        {
+            return m_error;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns val / get(). If val is invalid, this is reported
+        ///     as an illegal use. If the bsl::fast_divisor is invalid, this
+        ///     is reported the same way a divide by 0 is. In both cases,
+        ///     bsl::safe_integral<T>::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the dividend
+        ///   @return Returns val / get()
+        ///
+        [[nodiscard]] constexpr auto
+        div(safe_integral<value_type> const &val) const noexcept -> safe_integral<value_type>
+        {
+            if (unlikely(val.invalid())) {
+                illegal_use_of_invalid_safe_integral();
+                return safe_integral<value_type>::failure();
+            }
+
+            if (unlikely(m_error)) {
+                integral_overflow_underflow_wrap_error();
+                return safe_integral<value_type>::failure();
+            }
+
+            return safe_integral<value_type>{this->quotient(val.get())};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns val % get(). If val is invalid, this is reported
+        ///     as an illegal use. If the bsl::fast_divisor is invalid, this
+        ///     is reported the same way a modulus by 0 is. In both cases,
+        ///     bsl::safe_integral<T>::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the dividend
+        ///   @return Returns val % get()
+        ///
+        [[nodiscard]] constexpr auto
+        mod(safe_integral<value_type> const &val) const noexcept -> safe_integral<value_type>
+        {
+            if (unlikely(val.invalid())) {
+                illegal_use_of_invalid_safe_integral();
+                return safe_integral<value_type>::failure();
+            }
+
+            if (unlikely(m_error)) {
+                integral_overflow_underflow_wrap_error();
+                return safe_integral<value_type>::failure();
+            }
+
+            T const raw{val.get()};
+            return safe_integral<value_type>{
+                static_cast<T>(raw - static_cast<T>(this->quotient(raw) * m_div))};
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns rhs.div(lhs)
+    ///   @related bsl::fast_divisor
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type of the divisor
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns rhs.div(lhs)
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator/(safe_integral<T> const &lhs, fast_divisor<T> const &rhs) noexcept -> safe_integral<T>
+    {
+        return rhs.div(lhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns rhs.mod(lhs)
+    ///   @related bsl::fast_divisor
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type of the divisor
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns rhs.mod(lhs)
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator%(safe_integral<T> const &lhs, fast_divisor<T> const &rhs) noexcept -> safe_integral<T>
+    {
+        return rhs.mod(lhs);
+    }
+}
+
+#endif
@@ -35,6 +35,7 @@
 #include "details/fmt_impl_errc_type.hpp"
 #include "details/fmt_impl_integral.hpp"
 #include "details/fmt_impl_null_pointer.hpp"
+#include "details/fmt_impl_policy_integral.hpp"
 #include "details/fmt_impl_string_view.hpp"
 #include "details/fmt_impl_void_pointer.hpp"
 #include "details/out.hpp"
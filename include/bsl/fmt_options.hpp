@@ -32,6 +32,7 @@
 #include "cstdint.hpp"
 #include "cstr_type.hpp"
 #include "cstring.hpp"
+#include "ctype.hpp"
 #include "details/fmt_fsm.hpp"
 #include "fmt_align.hpp"
 #include "fmt_sign.hpp"
@@ -42,15 +43,6 @@
 #include "touch.hpp"
 #include "unlikely.hpp"
 
-// TODO
-// - Once Clang/LLVM supports C++20's consteval, we should determine if
-//   consteval can be used with this class's constructors, which would
-//   ensure that all format strings are parsed at compile-time. We
-//   should also add error logic to the parsers as errors can then be
-//   detected at compile-time, preventing the possibility of format string
-//   errors.
-//
-
 namespace bsl
 {
     /// @class bsl::fmt_options
@@ -99,17 +91,30 @@ namespace bsl
         ///     as much of the format string that the compiler will
         ///     allow so that at run-time, the program only has to
         ///     parse this struct to determine how to format a specific
-        ///     argument.
+        ///     argument. If the format string is known at compile-time,
+        ///     use the _fmt literal instead, which parses and validates
+        ///     the format string at compile-time.
         ///
         /// <!-- inputs/outputs -->
         ///   @param f the user provided format string.
         ///
         explicit constexpr fmt_options(cstr_type const f) noexcept
+            : fmt_options{f, safe_uintmax{bsl::builtin_strlen(f)}}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fmt_options given a user provided
+        ///     format string and the total number of characters in the
+        ///     format string (not including the '\0').
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param f the user provided format string.
+        ///   @param len the total number of characters in f
+        ///
+        constexpr fmt_options(cstr_type const f, safe_uintmax const &len) noexcept
         {
             details::fmt_fsm mut_fsm{};
-
             safe_uintmax mut_idx{};
-            safe_uintmax const len{bsl::builtin_strlen(f)};
 
             while (mut_idx < len) {
                 switch (mut_fsm) {
@@ -407,7 +412,177 @@ namespace bsl
             m_type = val;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided format string is a valid
+        ///     format string, meaning it follows the following syntax with
+        ///     nothing left over:
+        ///     [[fill]align][sign][#][0][width][type]
+        ///     where align is one of "<>^", sign is one of "+- ", width is
+        ///     at most 3 digits and type is one of "bBcdsxX". The
+        ///     constructors do not require a valid format string (anything
+        ///     that is not understood is ignored), but the _fmt literal
+        ///     uses this to reject invalid format strings at compile-time.
+        ///     Like the constructors, the format string must end in a '\0'.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param f the format string to validate
+        ///   @param len the total number of characters in f
+        ///   @return Returns true if the provided format string is a valid
+        ///     format string, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_valid(cstr_type const f, safe_uintmax const &len) noexcept -> bool
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            constexpr safe_uintmax two{static_cast<bsl::uintmax>(2)};
+            constexpr safe_uintmax max_num_width_digits{static_cast<bsl::uintmax>(3)};
+
+            if (len.is_zero()) {
+                return true;
+            }
+
+            safe_uintmax mut_idx{};
+            if (is_valid_align(f[one.get()])) {
+                mut_idx = two;
+            }
+            else {
+                if (is_valid_align(f[mut_idx.get()])) {
+                    mut_idx = one;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (is_valid_sign(f[mut_idx.get()])) {
+                ++mut_idx;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if ('#' == f[mut_idx.get()]) {
+                ++mut_idx;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if ('0' == f[mut_idx.get()]) {
+                ++mut_idx;
+            }
+            else {
+                bsl::touch();
+            }
+
+            for (safe_uintmax mut_i{}; mut_idx < len; ++mut_i) {
+                if (!bsl::isdigit(f[mut_idx.get()])) {
+                    break;
+                }
+
+                if (mut_i == max_num_width_digits) {
+                    return false;
+                }
+
+                ++mut_idx;
+            }
+
+            if (is_valid_type(f[mut_idx.get()])) {
+                ++mut_idx;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_idx == len;
+        }
+
     private:
+        /// <!-- description -->
+        ///   @brief Returns true if the provided character is a valid
+        ///     align field, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to check
+        ///   @return Returns true if the provided character is a valid
+        ///     align field, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_valid_align(char_type const c) noexcept -> bool
+        {
+            switch (c) {
+                case '<':
+                case '>':
+                case '^': {
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided character is a valid
+        ///     sign field, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to check
+        ///   @return Returns true if the provided character is a valid
+        ///     sign field, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_valid_sign(char_type const c) noexcept -> bool
+        {
+            switch (c) {
+                case '+':
+                case '-':
+                case ' ': {
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided character is a valid
+        ///     type field, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to check
+        ///   @return Returns true if the provided character is a valid
+        ///     type field, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_valid_type(char_type const c) noexcept -> bool
+        {
+            switch (c) {
+                case 'b':
+                case 'B':
+                case 'c':
+                case 'd':
+                case 's':
+                case 'x':
+                case 'X': {
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
         /// <!-- description -->
         ///   @brief Returns the fill value for alignment.
         ///
@@ -672,17 +847,12 @@ namespace bsl
                 }
 
                 char_type const digit{f[mut_idx.get()]};
-                if (digit < '0') {
-                    break;
-                }
-
-                if (digit > '9') {
+                if (!bsl::isdigit(digit)) {
                     break;
                 }
 
                 m_width *= base10;
-                m_width += static_cast<bsl::uintmax>(digit);
-                m_width -= static_cast<bsl::uintmax>('0');
+                m_width += static_cast<bsl::uintmax>(bsl::digit_value(digit).get());
                 ++mut_idx;
             }
         }
@@ -742,6 +912,16 @@ namespace bsl
 
     namespace details
     {
+        /// <!-- description -->
+        ///   @brief Called by the _fmt literal when it is given an invalid
+        ///     format string. This function is intentionally not a
+        ///     constexpr, which means that calling it from the _fmt literal
+        ///     (which is a consteval) results in a compile-time error.
+        ///
+        inline void
+        fmt_options_invalid_format_string() noexcept
+        {}
+
         /// <!-- description -->
         ///   @brief Returns the fmt options for a pointer depending on the
         ///     the size of a pointer.
@@ -767,4 +947,34 @@ namespace bsl
     constexpr fmt_options ptrops{details::get_ptrops()};
 }
 
+/// <!-- description -->
+///   @brief Returns a bsl::fmt_options that is parsed from the provided
+///     format string at compile-time. Unlike the bsl::fmt_options
+///     constructor, which parses the format string each time it is
+///     called, this literal is a consteval, meaning the resulting
+///     bsl::fmt_options is always a constant, and an invalid format
+///     string (see bsl::fmt_options::is_valid) results in a compile-time
+///     error instead of being silently ignored.
+///   @include fmt/example_fmt_literal.hpp
+///
+/// <!-- inputs/outputs -->
+///   @param str the format string to parse
+///   @param len the total number of characters in str
+///   @return Returns a bsl::fmt_options that is parsed from the provided
+///     format string at compile-time.
+///
+[[nodiscard]] consteval auto
+operator""_fmt(bsl::cstr_type const str, bsl::uintmax const len) noexcept -> bsl::fmt_options
+{
+    bsl::safe_uintmax const f_len{len};
+    if (!bsl::fmt_options::is_valid(str, f_len)) {
+        bsl::details::fmt_options_invalid_format_string();
+    }
+    else {
+        bsl::touch();
+    }
+
+    return bsl::fmt_options{str, f_len};
+}
+
 #endif
@@ -0,0 +1,128 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file format_to.hpp
+///
+
+#ifndef BSL_FORMAT_TO_HPP
+#define BSL_FORMAT_TO_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "details/out.hpp"
+#include "details/out_buffer_target.hpp"
+#include "details/out_type_buffer.hpp"
+#include "format_to_result.hpp"
+#include "forward.hpp"
+#include "is_constant_evaluated.hpp"
+#include "safe_integral.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Formats into a caller provided buffer instead of stdout
+    ///     or stderr. The provided function is called with a bsl::out,
+    ///     and anything given to this bsl::out using the << operator
+    ///     (including bsl::fmt and any user defined fmt_impl) is written
+    ///     into the provided buffer. This makes it possible to build a
+    ///     message in memory, which can then be sent somewhere other than
+    ///     the console (e.g., a shared memory log or a serial port). Some
+    ///     key points:
+    ///     - At most size - 1 characters are written, and the characters
+    ///       written are always followed by a '\0'. Anything that does
+    ///       not fit is dropped, and the result is marked as truncated.
+    ///     - The bsl::out given to the provided function is only valid
+    ///       for the duration of the call, and calls to bsl::format_to
+    ///       can be nested. The current buffer is tracked per thread.
+    ///     - Like bsl::print() and friends, nothing is written during
+    ///       constant evaluation.
+    ///   @include example_format_to_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam FUNC the type of function to call
+    ///   @param pmut_buf a pointer to the buffer to write to
+    ///   @param size the total number of characters in pmut_buf
+    ///   @param pudm_udm_func the function to call with the bsl::out that
+    ///     writes to pmut_buf
+    ///   @return Returns a bsl::format_to_result containing the total
+    ///     number of characters written (not including the '\0'), and
+    ///     whether or not the output was truncated.
+    ///
+    template<typename FUNC>
+    [[maybe_unused]] constexpr auto
+    format_to(char_type *const pmut_buf, safe_uintmax const &size, FUNC &&pudm_udm_func) noexcept
+        -> format_to_result
+    {
+        if (unlikely(nullptr == pmut_buf)) {
+            unlikely_invalid_argument_failure();
+            return {{}, true};
+        }
+
+        if (unlikely(size.is_zero_or_invalid())) {
+            unlikely_invalid_argument_failure();
+            return {{}, true};
+        }
+
+        if (is_constant_evaluated()) {
+            *pmut_buf = '\0';
+            pudm_udm_func(out<details::out_type_buffer>{});
+            return {{}, false};
+        }
+
+        details::out_buffer_target mut_target{pmut_buf, size};
+        auto *const pmut_prev{details::get_out_buffer_target()};
+
+        details::get_out_buffer_target() = &mut_target;
+        pudm_udm_func(out<details::out_type_buffer>{});
+        details::get_out_buffer_target() = pmut_prev;
+
+        return {mut_target.count(), mut_target.truncated()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Formats into the provided bsl::array instead of stdout
+    ///     or stderr. See the pointer and size version of bsl::format_to
+    ///     for more details.
+    ///   @include example_format_to_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the total number of characters in mut_buf
+    ///   @tparam FUNC the type of function to call
+    ///   @param mut_buf the array to write to
+    ///   @param pudm_udm_func the function to call with the bsl::out that
+    ///     writes to mut_buf
+    ///   @return Returns a bsl::format_to_result containing the total
+    ///     number of characters written (not including the '\0'), and
+    ///     whether or not the output was truncated.
+    ///
+    template<bsl::uintmax N, typename FUNC>
+    [[maybe_unused]] constexpr auto
+    format_to(array<char_type, N> &mut_buf, FUNC &&pudm_udm_func) noexcept -> format_to_result
+    {
+        return format_to(mut_buf.data(), mut_buf.size(), bsl::forward<FUNC>(pudm_udm_func));
+    }
+}
+
+#endif
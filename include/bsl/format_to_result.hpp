@@ -0,0 +1,52 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file format_to_result.hpp
+///
+
+#ifndef BSL_FORMAT_TO_RESULT_HPP
+#define BSL_FORMAT_TO_RESULT_HPP
+
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::format_to_result
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the return value of bsl::format_to. This tells
+    ///     the caller how many characters were written to the provided
+    ///     buffer (not including the '\0'), as well as whether or not the
+    ///     output had to be truncated to fit.
+    ///
+    struct format_to_result final
+    {
+        /// @brief stores the total number of characters written
+        safe_uintmax count;
+        /// @brief stores whether or not the output was truncated
+        bool truncated;
+    };
+}
+
+#endif
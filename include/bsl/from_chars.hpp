@@ -29,6 +29,7 @@
 #define BSL_FROM_CHARS_HPP
 
 #include "char_type.hpp"
+#include "ctype.hpp"
 #include "is_signed.hpp"
 #include "safe_integral.hpp"
 #include "string_view.hpp"
@@ -61,29 +62,7 @@ namespace bsl
         {
             safe_uintmax mut_i{};
             for (; mut_i < str.length(); ++mut_i) {
-                char_type const digit{*str.at_if(mut_i)};
-
-                if (' ' == digit) {
-                    continue;
-                }
-
-                if ('\t' == digit) {
-                    continue;
-                }
-
-                if ('\n' == digit) {
-                    continue;
-                }
-
-                if ('\v' == digit) {
-                    continue;
-                }
-
-                if ('\f' == digit) {
-                    continue;
-                }
-
-                if ('\r' == digit) {
+                if (bsl::isspace(*str.at_if(mut_i))) {
                     continue;
                 }
 
@@ -114,6 +93,7 @@ namespace bsl
             -> safe_integral<T>
         {
             constexpr safe_integral<T> base10{static_cast<T>(10)};
+            constexpr safe_uint8 base10_digits{static_cast<bsl::uint8>(10)};
 
             bool mut_negate{};
             safe_integral<T> mut_val{};
@@ -130,36 +110,25 @@ namespace bsl
             }
 
             for (safe_uintmax mut_i{mut_idx}; mut_i < str.length(); ++mut_i) {
-                safe_integral<T> const digit{static_cast<T>(*str.at_if(mut_i))};
-
-                constexpr safe_integral<T> lower_num{static_cast<T>('/')};
-                constexpr safe_integral<T> upper_num{static_cast<T>(':')};
-
-                if (digit > lower_num) {
-                    if (digit < upper_num) {
-                        constexpr safe_integral<T> offset{static_cast<T>('0')};
-                        if constexpr (is_signed<T>::value) {
-                            if (mut_negate) {
-                                mut_val *= base10;
-                                mut_val -= (digit - offset);
-                            }
-                            else {
-                                mut_val *= base10;
-                                mut_val += (digit - offset);
-                            }
+                safe_uint8 const digit{bsl::digit_value(*str.at_if(mut_i))};
+                if (digit < base10_digits) {
+                    safe_integral<T> const val{static_cast<T>(digit.get())};
+                    if constexpr (is_signed<T>::value) {
+                        if (mut_negate) {
+                            mut_val *= base10;
+                            mut_val -= val;
                         }
                         else {
                             mut_val *= base10;
-                            mut_val += (digit - offset);
+                            mut_val += val;
                         }
-
-                        continue;
+                    }
+                    else {
+                        mut_val *= base10;
+                        mut_val += val;
                     }
 
-                    bsl::touch();
-                }
-                else {
-                    bsl::touch();
+                    continue;
                 }
 
                 details::invalid_dec_or_hex_integral();
@@ -189,65 +158,17 @@ namespace bsl
                 return safe_integral<T>::failure();
             }
 
-            constexpr safe_integral<T> base10{static_cast<T>(10)};
             constexpr safe_integral<T> base16{static_cast<T>(16)};
+            constexpr safe_uint8 base16_digits{static_cast<bsl::uint8>(16)};
 
             safe_integral<T> mut_val{};
 
             for (safe_uintmax mut_i{idx}; mut_i < str.length(); ++mut_i) {
-                safe_integral<T> const digit{static_cast<T>(*str.at_if(mut_i))};
-
-                constexpr safe_integral<T> lower_num{static_cast<T>('/')};
-                constexpr safe_integral<T> upper_num{static_cast<T>(':')};
-
-                if (digit > lower_num) {
-                    if (digit < upper_num) {
-                        constexpr safe_integral<T> offset{static_cast<T>('0')};
-                        mut_val *= base16;
-                        mut_val += (digit - offset);
-                        continue;
-                    }
-
-                    bsl::touch();
-                }
-                else {
-                    bsl::touch();
-                }
-
-                constexpr safe_integral<T> lower_alpha1{static_cast<T>('@')};
-                constexpr safe_integral<T> upper_alpha1{static_cast<T>('G')};
-
-                if (digit > lower_alpha1) {
-                    if (digit < upper_alpha1) {
-                        constexpr safe_integral<T> offset{static_cast<T>('A')};
-                        mut_val *= base16;
-                        mut_val += base10;
-                        mut_val += (digit - offset);
-                        continue;
-                    }
-
-                    bsl::touch();
-                }
-                else {
-                    bsl::touch();
-                }
-
-                constexpr safe_integral<T> lower_alpha2{static_cast<T>('`')};
-                constexpr safe_integral<T> upper_alpha2{static_cast<T>('g')};
-
-                if (digit > lower_alpha2) {
-                    if (digit < upper_alpha2) {
-                        constexpr safe_integral<T> offset{static_cast<T>('a')};
-                        mut_val *= base16;
-                        mut_val += base10;
-                        mut_val += (digit - offset);
-                        continue;
-                    }
-
-                    bsl::touch();
-                }
-                else {
-                    bsl::touch();
+                safe_uint8 const digit{bsl::digit_value(*str.at_if(mut_i))};
+                if (digit < base16_digits) {
+                    mut_val *= base16;
+                    mut_val += safe_integral<T>{static_cast<T>(digit.get())};
+                    continue;
                 }
 
                 details::invalid_dec_or_hex_integral();
@@ -0,0 +1,774 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file fused_integral.hpp
+///
+
+#ifndef BSL_FUSED_INTEGRAL_HPP
+#define BSL_FUSED_INTEGRAL_HPP
+
+#include "cstdint.hpp"
+#include "details/checked_state.hpp"
+#include "enable_if.hpp"
+#include "is_integral.hpp"
+#include "is_same.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::fused_integral
+    ///
+    /// <!-- description -->
+    ///   @brief Captures a chain of arithmetic on bsl::safe_integral
+    ///     values (e.g., base + idx * stride + off) so that the chain is
+    ///     only checked once. Each bsl::safe_integral operator checks (and
+    ///     branches on) its own result. A bsl::fused_integral instead
+    ///     computes each operation using the compiler's overflow builtins
+    ///     (which produce the infinitely precise result's overflow status
+    ///     without needing a wider type), and ORs that status into a
+    ///     sticky flag. The flag is only checked by to_safe(), which
+    ///     results in exactly the same bsl::safe_integral (and the same
+    ///     reported error) as the unfused chain would have. Note that
+    ///     checking only the range of the final result would not be the
+    ///     same, as an intermediate result can overflow even when the
+    ///     final result fits (e.g., (a - b) + b, or (a * b) * 0).
+    ///
+    ///     A chain becomes fused as soon as one of its operands is a
+    ///     bsl::fused_integral, which is usually done with
+    ///     bsl::make_fused().
+    ///   @include example_fused_integral_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type to encapsulate.
+    ///
+    template<typename T>
+    class fused_integral final
+    {
+        static_assert(bsl::is_integral<T>::value, "only integral types are supported");
+
+        /// @brief stores the value of the chain and its sticky error flags
+        details::checked_state<T> m_state;
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+
+        /// <!-- description -->
+        ///   @brief Default constructor that creates a bsl::fused_integral
+        ///     with a value of 0.
+        ///
+        constexpr fused_integral() noexcept    // --
+            : m_state{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fused_integral given a BSL fixed width
+        ///     type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param val the value to set the bsl::fused_integral to
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        explicit constexpr fused_integral(U const val) noexcept    // --
+            : m_state{val, {}, {}}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::fused_integral given a bsl::safe_integral
+        ///     of the same type. If val is invalid, so is the chain, which
+        ///     is reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the bsl::fused_integral to
+        ///
+        explicit constexpr fused_integral(safe_integral<T> const &val) noexcept    // --
+            : m_state{}
+        {
+            m_state.sum = details::checked_raw(m_state, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::fused_integral
+        ///
+        constexpr ~fused_integral() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr fused_integral(fused_integral const &o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr fused_integral(fused_integral &&mut_o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(fused_integral const &o) &noexcept
+            -> fused_integral & = default;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(fused_integral &&mut_o) &noexcept
+            -> fused_integral & = default;
+
+        /// <!-- description -->
+        ///   @brief Performs the one check of the chain, returning the
+        ///     result as a bsl::safe_integral. If any of the operands were
+        ///     invalid, this is reported as an illegal use of an invalid
+        ///     bsl::safe_integral. If any of the operations overflowed,
+        ///     underflowed or wrapped, this is reported as such. In both
+        ///     cases, bsl::safe_integral<T>::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the result of the chain as a bsl::safe_integral
+        ///
+        [[nodiscard]] constexpr auto
+        to_safe() const noexcept -> safe_integral<value_type>
+        {
+            return details::checked_result(m_state);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this += rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to add to *this
+        ///   @return Returns *this += rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator+=(fused_integral<value_type> const &rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_merge(m_state, rhs.m_state);
+            details::checked_add(m_state, rhs.m_state.sum);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator+=(fused_integral<value_type> const &rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this += rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to add to *this
+        ///   @return Returns *this += rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator+=(safe_integral<value_type> const &rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_add(m_state, details::checked_raw(m_state, rhs));
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator+=(safe_integral<value_type> const &rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this += rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to add to *this
+        ///   @return Returns *this += rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator+=(U const rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_add(m_state, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator+=(U const rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this -= rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to subtract from *this
+        ///   @return Returns *this -= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator-=(fused_integral<value_type> const &rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_merge(m_state, rhs.m_state);
+            details::checked_sub(m_state, rhs.m_state.sum);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator-=(fused_integral<value_type> const &rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this -= rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to subtract from *this
+        ///   @return Returns *this -= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator-=(safe_integral<value_type> const &rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_sub(m_state, details::checked_raw(m_state, rhs));
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator-=(safe_integral<value_type> const &rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this -= rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to subtract from *this
+        ///   @return Returns *this -= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator-=(U const rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_sub(m_state, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator-=(U const rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this *= rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to multiply *this
+        ///   @return Returns *this *= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator*=(fused_integral<value_type> const &rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_merge(m_state, rhs.m_state);
+            details::checked_mul(m_state, rhs.m_state.sum);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator*=(fused_integral<value_type> const &rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this *= rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to multiply *this
+        ///   @return Returns *this *= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator*=(safe_integral<value_type> const &rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_mul(m_state, details::checked_raw(m_state, rhs));
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator*=(safe_integral<value_type> const &rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this *= rhs. The operation is not checked,
+        ///     instead, any error is recorded and reported by to_safe().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to multiply *this
+        ///   @return Returns *this *= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator*=(U const rhs) &noexcept -> fused_integral<value_type> &
+        {
+            details::checked_mul(m_state, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator*=(U const rhs) const &&noexcept
+            -> fused_integral<value_type> & = delete;
+    };
+
+    // -------------------------------------------------------------------------
+    // fused_integral arithmetic operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} += rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} += rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator+(fused_integral<T> const &lhs, fused_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp += rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} += rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} += rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator+(fused_integral<T> const &lhs, safe_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp += rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} += rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} += rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator+(safe_integral<T> const &lhs, fused_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp += rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} += rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} += rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator+(fused_integral<T> const &lhs, T const rhs) noexcept -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp += rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} += rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} += rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator+(T const lhs, fused_integral<T> const &rhs) noexcept -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp += rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} -= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} -= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator-(fused_integral<T> const &lhs, fused_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp -= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} -= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} -= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator-(fused_integral<T> const &lhs, safe_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp -= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} -= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} -= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator-(safe_integral<T> const &lhs, fused_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp -= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} -= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} -= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator-(fused_integral<T> const &lhs, T const rhs) noexcept -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp -= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} -= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} -= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator-(T const lhs, fused_integral<T> const &rhs) noexcept -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp -= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} *= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} *= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator*(fused_integral<T> const &lhs, fused_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp *= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} *= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} *= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator*(fused_integral<T> const &lhs, safe_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp *= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} *= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} *= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator*(safe_integral<T> const &lhs, fused_integral<T> const &rhs) noexcept
+        -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp *= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} *= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} *= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator*(fused_integral<T> const &lhs, T const rhs) noexcept -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp *= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{lhs} *= rhs
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns fused_integral<T>{lhs} *= rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    operator*(T const lhs, fused_integral<T> const &rhs) noexcept -> fused_integral<T>
+    {
+        fused_integral<T> mut_tmp{lhs};
+        return mut_tmp *= rhs;
+    }
+
+    // -------------------------------------------------------------------------
+    // helpers
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{val}
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to fuse.
+    ///   @param val the integral to start the fused chain with
+    ///   @return Returns fused_integral<T>{val}
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    make_fused(T const &val) noexcept -> fused_integral<T>
+    {
+        return fused_integral<T>{val};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns fused_integral<T>{val}
+    ///   @related bsl::fused_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to fuse.
+    ///   @param val the bsl::safe_integral to start the fused chain with
+    ///   @return Returns fused_integral<T>{val}
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    make_fused(safe_integral<T> const &val) noexcept -> fused_integral<T>
+    {
+        return fused_integral<T>{val};
+    }
+
+    // -------------------------------------------------------------------------
+    // supported fused_integral types
+    // -------------------------------------------------------------------------
+
+    /// @brief provides the bsl::fused_integral version of bsl::int8
+    using fused_int8 = fused_integral<bsl::int8>;
+    /// @brief provides the bsl::fused_integral version of bsl::int16
+    using fused_int16 = fused_integral<bsl::int16>;
+    /// @brief provides the bsl::fused_integral version of bsl::int32
+    using fused_int32 = fused_integral<bsl::int32>;
+    /// @brief provides the bsl::fused_integral version of bsl::int64
+    using fused_int64 = fused_integral<bsl::int64>;
+    /// @brief provides the bsl::fused_integral version of bsl::intmax
+    using fused_intmax = fused_integral<bsl::intmax>;
+    /// @brief provides the bsl::fused_integral version of bsl::intptr
+    using fused_intptr = fused_integral<bsl::intptr>;
+    /// @brief provides the bsl::fused_integral version of bsl::uint8
+    using fused_uint8 = fused_integral<bsl::uint8>;
+    /// @brief provides the bsl::fused_integral version of bsl::uint16
+    using fused_uint16 = fused_integral<bsl::uint16>;
+    /// @brief provides the bsl::fused_integral version of bsl::uint32
+    using fused_uint32 = fused_integral<bsl::uint32>;
+    /// @brief provides the bsl::fused_integral version of bsl::uint64
+    using fused_uint64 = fused_integral<bsl::uint64>;
+    /// @brief provides the bsl::fused_integral version of bsl::uintmax
+    using fused_uintmax = fused_integral<bsl::uintmax>;
+    /// @brief provides the bsl::fused_integral version of bsl::uintptr
+    using fused_uintptr = fused_integral<bsl::uintptr>;
+}
+
+#endif
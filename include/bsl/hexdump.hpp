@@ -0,0 +1,274 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file hexdump.hpp
+///
+
+#ifndef BSL_HEXDUMP_HPP
+#define BSL_HEXDUMP_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "cstdint.hpp"
+#include "details/fmt_impl_integral_digits.hpp"
+#include "details/out.hpp"
+#include "details/wrapping_policy.hpp"
+#include "is_constant_evaluated.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief stores the total number of bytes on each line of a hexdump
+        constexpr safe_uintmax HEXDUMP_BYTES_PER_LINE{static_cast<bsl::uintmax>(16)};
+        /// @brief stores the total number of hex digits in each address
+        constexpr safe_uintmax HEXDUMP_ADDR_DIGITS{static_cast<bsl::uintmax>(16)};
+        /// @brief stores where the hex column starts
+        constexpr safe_uintmax HEXDUMP_HEX_START{static_cast<bsl::uintmax>(18)};
+        /// @brief stores where the ASCII column starts (including the '|')
+        constexpr safe_uintmax HEXDUMP_ASCII_START{static_cast<bsl::uintmax>(68)};
+        /// @brief stores the total number of characters in a line (including the '\0')
+        constexpr safe_uintmax HEXDUMP_LINE_SIZE{static_cast<bsl::uintmax>(88)};
+
+        /// <!-- description -->
+        ///   @brief Returns a blank hexdump line, which contains spaces
+        ///     everywhere except for the ASCII column's '|' characters, the
+        ///     '\n' and the '\0'. Every line of a hexdump starts as a copy
+        ///     of this line, which means that the columns of a partial line
+        ///     are already padded.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a blank hexdump line
+        ///
+        [[nodiscard]] constexpr auto
+        make_hexdump_line() noexcept -> array<char_type, HEXDUMP_LINE_SIZE.get()>
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            constexpr safe_uintmax two{static_cast<bsl::uintmax>(2)};
+            constexpr safe_uintmax ascii_end{HEXDUMP_ASCII_START + one + HEXDUMP_BYTES_PER_LINE};
+
+            array<char_type, HEXDUMP_LINE_SIZE.get()> mut_line{};
+            for (safe_uintmax mut_i{}; mut_i < HEXDUMP_LINE_SIZE; ++mut_i) {
+                *mut_line.at_if(mut_i) = ' ';
+            }
+
+            *mut_line.at_if(HEXDUMP_ASCII_START) = '|';
+            *mut_line.at_if(ascii_end) = '|';
+            *mut_line.at_if(HEXDUMP_LINE_SIZE - two) = '\n';
+            *mut_line.at_if(HEXDUMP_LINE_SIZE - one) = '\0';
+
+            return mut_line;
+        }
+
+        /// @brief stores a blank hexdump line
+        constexpr array<char_type, HEXDUMP_LINE_SIZE.get()> HEXDUMP_BLANK_LINE{make_hexdump_line()};
+
+        /// <!-- description -->
+        ///   @brief Returns the printable version of the provided byte,
+        ///     which is the byte itself if it is printable ASCII, or a
+        ///     '.' otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param byte the byte to convert
+        ///   @return Returns the printable version of the provided byte
+        ///
+        [[nodiscard]] constexpr auto
+        hexdump_printable(bsl::uint8 const byte) noexcept -> char_type
+        {
+            constexpr bsl::uint8 first{static_cast<bsl::uint8>(0x20)};
+            constexpr bsl::uint8 last{static_cast<bsl::uint8>(0x7E)};
+
+            if (byte < first) {
+                return '.';
+            }
+
+            if (byte > last) {
+                return '.';
+            }
+
+            return static_cast<char_type>(byte);
+        }
+
+        /// <!-- description -->
+        ///   @brief Fills in the provided line with the address, hex
+        ///     bytes and ASCII bytes of the line that starts at "off".
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_line the line to fill in
+        ///   @param buf the bytes being dumped
+        ///   @param off the offset into buf of the first byte on this line
+        ///   @param addr the address of the first byte on this line
+        ///
+        constexpr void
+        hexdump_line(
+            array<char_type, HEXDUMP_LINE_SIZE.get()> &mut_line,
+            span<bsl::uint8 const> const &buf,
+            safe_uintmax const &off,
+            safe_uintmax const &addr) noexcept
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            constexpr safe_uintmax three{static_cast<bsl::uintmax>(3)};
+            constexpr safe_uintmax four{static_cast<bsl::uintmax>(4)};
+            constexpr safe_uintmax mask{static_cast<bsl::uintmax>(0xF)};
+            constexpr safe_uintmax half{HEXDUMP_BYTES_PER_LINE / static_cast<bsl::uintmax>(2)};
+
+            mut_line = HEXDUMP_BLANK_LINE;
+
+            safe_uintmax mut_addr{addr};
+            for (safe_uintmax mut_i{HEXDUMP_ADDR_DIGITS}; mut_i.is_pos(); --mut_i) {
+                *mut_line.at_if(mut_i - one) = *NIBBLES.at_if(mut_addr & mask);
+                mut_addr >>= four;
+            }
+
+            for (safe_uintmax mut_i{}; mut_i < HEXDUMP_BYTES_PER_LINE; ++mut_i) {
+                safe_uintmax const idx{off + mut_i};
+                if (idx >= buf.size()) {
+                    break;
+                }
+
+                bsl::uint8 const byte{*buf.at_if(idx)};
+                safe_uintmax const val{static_cast<bsl::uintmax>(byte)};
+
+                safe_uintmax mut_col{HEXDUMP_HEX_START + (mut_i * three)};
+                if (mut_i >= half) {
+                    ++mut_col;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                *mut_line.at_if(mut_col) = *NIBBLES.at_if(val >> four);
+                *mut_line.at_if(mut_col + one) = *NIBBLES.at_if(val & mask);
+                *mut_line.at_if(HEXDUMP_ASCII_START + one + mut_i) = hexdump_printable(byte);
+            }
+        }
+    }
+
+    /// @class bsl::hexdump
+    ///
+    /// <!-- description -->
+    ///   @brief Outputs a region of memory as a hexdump. Each line
+    ///     contains the address of the first byte on the line, followed
+    ///     by 16 bytes in hex and then the same 16 bytes in ASCII, with
+    ///     non-printable bytes shown as '.'. Each line is built in a
+    ///     buffer and written at once, so dumping a page costs a few
+    ///     hundred writes instead of a few dozen writes per byte.
+    ///   @include example_hexdump_overview.hpp
+    ///
+    class hexdump final
+    {
+        /// @brief stores the bytes to dump
+        span<bsl::uint8 const> m_buf;
+        /// @brief stores the address of the first byte
+        safe_uintmax m_base;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::hexdump given the bytes to dump and the
+        ///     address that is shown for the first byte.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param buf the bytes to dump
+        ///   @param base the address that is shown for the first byte.
+        ///     Defaults to 0, in which case offsets are shown instead. The
+        ///     addresses shown wrap if base + offset would overflow.
+        ///
+        explicit constexpr hexdump(
+            span<bsl::uint8 const> const &buf, safe_uintmax const &base = {}) noexcept
+            : m_buf{buf}, m_base{base}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the bytes to dump
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the bytes to dump
+        ///
+        [[nodiscard]] constexpr auto
+        buf() const noexcept -> span<bsl::uint8 const> const &
+        {
+            return m_buf;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the address that is shown for the first byte
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the address that is shown for the first byte
+        ///
+        [[nodiscard]] constexpr auto
+        base() const noexcept -> safe_uintmax const &
+        {
+            return m_base;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Outputs the provided bsl::hexdump to the provided
+    ///     output type, one line at a time. If the base address is
+    ///     invalid, nothing is output.
+    ///   @related bsl::hexdump
+    ///   @include example_hexdump_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @param o the instance of the outputter used to output the value.
+    ///   @param val the hexdump to output
+    ///   @return return o
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr auto
+    operator<<(out<T> const o, hexdump const &val) noexcept -> out<T>
+    {
+        if (is_constant_evaluated()) {
+            return o;
+        }
+
+        if constexpr (!o) {
+            return o;
+        }
+
+        if (unlikely(val.base().invalid())) {
+            unlikely_invalid_argument_failure();
+            return o;
+        }
+
+        bsl::uintmax const base{val.base().get()};
+        array<char_type, details::HEXDUMP_LINE_SIZE.get()> mut_line{};
+        for (safe_uintmax mut_off{}; mut_off < val.buf().size();
+             mut_off += details::HEXDUMP_BYTES_PER_LINE) {
+            safe_uintmax const addr{details::wrapping_policy::add(base, mut_off.get())};
+            details::hexdump_line(mut_line, val.buf(), mut_off, addr);
+            o.write_to_console(mut_line.data());
+        }
+
+        return o;
+    }
+}
+
+#endif
@@ -129,6 +129,22 @@ namespace bsl
     class is_integral<bsl::uint64 const> final : public true_type
     {};
 
+    template<>
+    class is_integral<bsl::int128> final : public true_type
+    {};
+
+    template<>
+    class is_integral<bsl::int128 const> final : public true_type
+    {};
+
+    template<>
+    class is_integral<bsl::uint128> final : public true_type
+    {};
+
+    template<>
+    class is_integral<bsl::uint128 const> final : public true_type
+    {};
+
     /// @endcond doxygen on
 }
 
@@ -100,6 +100,14 @@ namespace bsl
     class is_signed<bsl::int64 const> final : public true_type
     {};
 
+    template<>
+    class is_signed<bsl::int128> final : public true_type
+    {};
+
+    template<>
+    class is_signed<bsl::int128 const> final : public true_type
+    {};
+
     /// @endcond doxygen on
 }
 
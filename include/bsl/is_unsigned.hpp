@@ -97,6 +97,14 @@ namespace bsl
     class is_unsigned<bsl::uint64 const> final : public true_type
     {};
 
+    template<>
+    class is_unsigned<bsl::uint128> final : public true_type
+    {};
+
+    template<>
+    class is_unsigned<bsl::uint128 const> final : public true_type
+    {};
+
     /// @endcond doxygen on
 }
 
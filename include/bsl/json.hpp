@@ -0,0 +1,670 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file json.hpp
+///
+
+#ifndef BSL_JSON_HPP
+#define BSL_JSON_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "conditional.hpp"
+#include "cstdint.hpp"
+#include "cstr_type.hpp"
+#include "debug.hpp"
+#include "details/fmt_impl_integral_digits.hpp"
+#include "details/out.hpp"
+#include "details/out_type_alert.hpp"
+#include "details/out_type_debug.hpp"
+#include "details/out_type_empty.hpp"
+#include "details/out_type_error.hpp"
+#include "details/out_type_print.hpp"
+#include "discard.hpp"
+#include "enable_if.hpp"
+#include "is_constant_evaluated.hpp"
+#include "is_integral.hpp"
+#include "is_same.hpp"
+#include "nullptr_t.hpp"
+#include "safe_integral.hpp"
+#include "source_location.hpp"
+#include "string_view.hpp"
+#include "touch.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief stores the size of the largest escape sequence (\u00XX)
+        constexpr safe_uintmax JSON_ESCAPE_SIZE{static_cast<bsl::uintmax>(6)};
+        /// @brief stores the size of a short escape sequence (i.e., \n)
+        constexpr safe_uintmax JSON_SHORT_ESCAPE_SIZE{static_cast<bsl::uintmax>(2)};
+        /// @brief stores the first character that does not need a \u00XX escape
+        constexpr bsl::uint8 JSON_FIRST_PRINTABLE{static_cast<bsl::uint8>(0x20)};
+
+        /// <!-- description -->
+        ///   @brief If the provided character must be escaped in a JSON
+        ///     string, the escape sequence is written to mut_esc and its
+        ///     length is returned. Otherwise, 0 is returned and mut_esc is
+        ///     left in an unspecified state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the character to escape
+        ///   @param mut_esc where to write the escape sequence
+        ///   @return Returns the length of the escape sequence, or 0 if
+        ///     the character does not need to be escaped.
+        ///
+        [[nodiscard]] constexpr auto
+        json_escape_char(
+            char_type const c, array<char_type, JSON_ESCAPE_SIZE.get()> &mut_esc) noexcept
+            -> safe_uintmax
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            constexpr safe_uintmax two{static_cast<bsl::uintmax>(2)};
+            constexpr safe_uintmax three{static_cast<bsl::uintmax>(3)};
+            constexpr safe_uintmax four{static_cast<bsl::uintmax>(4)};
+            constexpr safe_uintmax five{static_cast<bsl::uintmax>(5)};
+            constexpr safe_uintmax mask{static_cast<bsl::uintmax>(0xF)};
+
+            *mut_esc.front_if() = '\\';
+            switch (c) {
+                case '"': {
+                    *mut_esc.at_if(one) = '"';
+                    return JSON_SHORT_ESCAPE_SIZE;
+                }
+
+                case '\\': {
+                    *mut_esc.at_if(one) = '\\';
+                    return JSON_SHORT_ESCAPE_SIZE;
+                }
+
+                case '\n': {
+                    *mut_esc.at_if(one) = 'n';
+                    return JSON_SHORT_ESCAPE_SIZE;
+                }
+
+                case '\r': {
+                    *mut_esc.at_if(one) = 'r';
+                    return JSON_SHORT_ESCAPE_SIZE;
+                }
+
+                case '\t': {
+                    *mut_esc.at_if(one) = 't';
+                    return JSON_SHORT_ESCAPE_SIZE;
+                }
+
+                case '\b': {
+                    *mut_esc.at_if(one) = 'b';
+                    return JSON_SHORT_ESCAPE_SIZE;
+                }
+
+                case '\f': {
+                    *mut_esc.at_if(one) = 'f';
+                    return JSON_SHORT_ESCAPE_SIZE;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            bsl::uint8 const val{static_cast<bsl::uint8>(c)};
+            if (val >= JSON_FIRST_PRINTABLE) {
+                return {};
+            }
+
+            safe_uintmax const idx{static_cast<bsl::uintmax>(val)};
+            *mut_esc.at_if(one) = 'u';
+            *mut_esc.at_if(two) = '0';
+            *mut_esc.at_if(three) = '0';
+            *mut_esc.at_if(four) = *NIBBLES.at_if(idx >> four);
+            *mut_esc.at_if(five) = *NIBBLES.at_if(idx & mask);
+
+            return JSON_ESCAPE_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided string as the contents of a JSON
+        ///     string (i.e., without the surrounding quotes). Runs of
+        ///     characters that do not need to be escaped, which is most of
+        ///     them, are output using a single write instead of one
+        ///     character at a time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param str the string to escape and output
+        ///
+        template<typename T>
+        constexpr void
+        json_escape(out<T> const o, string_view const &str) noexcept
+        {
+            array<char_type, JSON_ESCAPE_SIZE.get()> mut_esc{};
+
+            safe_uintmax mut_run{};
+            for (safe_uintmax mut_i{}; mut_i < str.length(); ++mut_i) {
+                safe_uintmax const len{json_escape_char(*str.at_if(mut_i), mut_esc)};
+                if (len.is_zero()) {
+                    continue;
+                }
+
+                if (mut_i > mut_run) {
+                    o.write_to_console(str.at_if(mut_run), mut_i - mut_run);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                o.write_to_console(mut_esc.data(), len);
+                mut_run = mut_i + static_cast<bsl::uintmax>(1);
+            }
+
+            if (str.length() > mut_run) {
+                o.write_to_console(str.at_if(mut_run), str.length() - mut_run);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided string as a quoted and escaped
+        ///     JSON string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param str the string to output
+        ///
+        template<typename T>
+        constexpr void
+        json_string(out<T> const o, string_view const &str) noexcept
+        {
+            o.write_to_console('"');
+            details::json_escape(o, str);
+            o.write_to_console('"');
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided bool as a JSON value.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val the value to output
+        ///
+        template<typename T>
+        constexpr void
+        json_value(out<T> const o, bool const val) noexcept
+        {
+            o << val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided character as a JSON string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val the value to output
+        ///
+        template<typename T>
+        constexpr void
+        json_value(out<T> const o, char_type const val) noexcept
+        {
+            array<char_type, JSON_ESCAPE_SIZE.get()> mut_esc{};
+            safe_uintmax const len{json_escape_char(val, mut_esc)};
+
+            o.write_to_console('"');
+            if (len.is_zero()) {
+                o.write_to_console(val);
+            }
+            else {
+                o.write_to_console(mut_esc.data(), len);
+            }
+            o.write_to_console('"');
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided string as a JSON string. If the
+        ///     string is a nullptr, null is output instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val the value to output
+        ///
+        template<typename T>
+        constexpr void
+        json_value(out<T> const o, cstr_type const val) noexcept
+        {
+            if (nullptr == val) {
+                o.write_to_console("null");
+            }
+            else {
+                details::json_string(o, string_view{val});
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided string as a JSON string. If the
+        ///     string is invalid, null is output instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val the value to output
+        ///
+        template<typename T>
+        constexpr void
+        json_value(out<T> const o, string_view const &val) noexcept
+        {
+            if (!val) {
+                o.write_to_console("null");
+            }
+            else {
+                details::json_string(o, val);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs null.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val ignored
+        ///
+        template<typename T>
+        constexpr void
+        json_value(out<T> const o, bsl::nullptr_t const val) noexcept
+        {
+            bsl::discard(val);
+            o.write_to_console("null");
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided pointer as a JSON string, as JSON
+        ///     numbers cannot be relied on to hold 64bit addresses.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val the value to output
+        ///
+        template<typename T>
+        constexpr void
+        json_value(out<T> const o, void const *const val) noexcept
+        {
+            o.write_to_console('"');
+            o << val;
+            o.write_to_console('"');
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided integral as a JSON number. If the
+        ///     integral is invalid, null is output instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @tparam U the type of integral to output
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val the value to output
+        ///
+        template<typename T, typename U>
+        constexpr void
+        json_value(out<T> const o, safe_integral<U> const &val) noexcept
+        {
+            if (!val) {
+                o.write_to_console("null");
+            }
+            else {
+                o << val;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the provided integral as a JSON number.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of outputter provided
+        ///   @tparam U the type of integral to output
+        ///   @param o the instance of the outputter used to output the value.
+        ///   @param val the value to output
+        ///
+        template<typename T, typename U, enable_if_t<is_integral<U>::value, bool> = true>
+        constexpr void
+        json_value(out<T> const o, U const val) noexcept
+        {
+            o << safe_integral<U>{val};
+        }
+    }
+
+    /// @class bsl::json_kv
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a key/value pair that is added to a
+    ///     bsl::json_record using operator<<. Use bsl::kv() to create
+    ///     one. The value is stored as a reference, which means that a
+    ///     bsl::json_kv must be used in the same statement that creates
+    ///     it.
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam V the type of value stored
+    ///
+    template<typename V>
+    class json_kv final
+    {
+        /// @brief stores the key
+        cstr_type m_key;
+        /// @brief stores a reference to the value
+        V const &m_val;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::json_kv given a key and a value
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param key the key of the key/value pair
+        ///   @param val the value of the key/value pair
+        ///
+        constexpr json_kv(cstr_type const key, V const &val) noexcept    // --
+            : m_key{key}, m_val{val}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the key of the key/value pair
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the key of the key/value pair
+        ///
+        [[nodiscard]] constexpr auto
+        key() const noexcept -> cstr_type
+        {
+            return m_key;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the key/value pair
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the key/value pair
+        ///
+        [[nodiscard]] constexpr auto
+        val() const noexcept -> V const &
+        {
+            return m_val;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns a bsl::json_kv given a key and a value.
+    ///   @related bsl::json_kv
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam V the type of value to store
+    ///   @param key the key of the key/value pair
+    ///   @param val the value of the key/value pair
+    ///   @return Returns a bsl::json_kv given a key and a value.
+    ///
+    template<typename V>
+    [[nodiscard]] constexpr auto
+    kv(cstr_type const key, V const &val) noexcept -> json_kv<V>
+    {
+        return json_kv<V>{key, val};
+    }
+
+    /// @class bsl::json_record
+    ///
+    /// <!-- description -->
+    ///   @brief Outputs a single structured log record as one line of
+    ///     JSON (i.e., JSON lines). The constructor outputs the level and
+    ///     the source location of the record, each key/value pair added
+    ///     with operator<< is output as it is added, and the destructor
+    ///     closes the record with a '}' and a '\n'. Since the record is
+    ///     a single line, if output is buffered and the record fits in
+    ///     BSL_OUT_BUFFER_SIZE, it is output using a single write and is
+    ///     not interleaved with output from other threads. A record that
+    ///     does not fit is output in BSL_OUT_BUFFER_SIZE pieces, and if
+    ///     output is not buffered, the record is output as it is built.
+    ///     In both of these cases, output from other threads can appear
+    ///     in the middle of the record. Use bsl::print_json(),
+    ///     bsl::debug_json(), bsl::alert_json() or bsl::error_json() to
+    ///     create one.
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of out statement being used
+    ///
+    template<typename T>
+    class json_record final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::json_record, outputting the level and
+        ///     source location of the record.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param lvl the level of the record
+        ///   @param sloc the location of the call site
+        ///
+        constexpr json_record(cstr_type const lvl, source_location const &sloc) noexcept
+        {
+            out<T> const o{};
+            if constexpr (!o) {
+                bsl::discard(lvl);
+                bsl::discard(sloc);
+            }
+            else {
+                o.write_to_console("{\"lvl\":");
+                details::json_value(o, lvl);
+                o.write_to_console(",\"file\":");
+                details::json_value(o, sloc.file_name());
+                o.write_to_console(",\"line\":");
+                details::json_value(o, sloc.line());
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys a previously created bsl::json_record,
+        ///     closing the record.
+        ///
+        constexpr ~json_record() noexcept
+        {
+            out<T> const o{};
+            if constexpr (!o) {
+                bsl::touch();
+            }
+            else {
+                o.write_to_console("}\n");
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr json_record(json_record const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr json_record(json_record &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(json_record const &o) &noexcept
+            -> json_record & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(json_record &&mut_o) &noexcept
+            -> json_record & = delete;
+    };
+
+    /// <!-- description -->
+    ///   @brief Adds a key/value pair to the provided bsl::json_record.
+    ///     Strings are quoted and escaped, integrals are output as
+    ///     numbers, and invalid values are output as null.
+    ///   @related bsl::json_record
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of out statement being used
+    ///   @tparam V the type of value being added
+    ///   @param rec the record to add the key/value pair to
+    ///   @param pair the key/value pair to add
+    ///   @return return rec
+    ///
+    template<typename T, typename V>
+    [[maybe_unused]] constexpr auto
+    operator<<(json_record<T> const &rec, json_kv<V> const &pair) noexcept
+        -> json_record<T> const &
+    {
+        out<T> const o{};
+        if constexpr (!o) {
+            return rec;
+        }
+
+        if (is_constant_evaluated()) {
+            return rec;
+        }
+
+        o.write_to_console(',');
+        details::json_value(o, pair.key());
+        o.write_to_console(':');
+        details::json_value(o, pair.val());
+
+        return rec;
+    }
+
+    namespace details
+    {
+        /// @brief used to disable records for debug_json() and alert_json()
+        ///
+        /// <!-- template parameters -->
+        ///   @tparam DL the debug level this record uses
+        ///   @tparam T the type of out statement being used
+        ///
+        template<bsl::uintmax DL, typename T>
+        using json_record_type = conditional_t<
+            is_same<out_type<DL, T>, out<T>>::value,
+            json_record<T>,
+            json_record<out_type_empty>>;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a bsl::json_record that outputs a record with a
+    ///     "print" level to stdout. Like bsl::print(), if DL is larger
+    ///     than BSL_DEBUG_LEVEL, the record is compiled away.
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this record
+    ///   @param sloc the location of the call site
+    ///   @return Returns a bsl::json_record
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY>
+    [[nodiscard]] constexpr auto
+    print_json(source_location const &sloc = here()) noexcept
+        -> details::json_record_type<DL, details::out_type_print>
+    {
+        return details::json_record_type<DL, details::out_type_print>{"print", sloc};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a bsl::json_record that outputs a record with a
+    ///     "debug" level to stdout. Like bsl::debug(), if DL is larger
+    ///     than BSL_DEBUG_LEVEL, the record is compiled away.
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this record
+    ///   @param sloc the location of the call site
+    ///   @return Returns a bsl::json_record
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY>
+    [[nodiscard]] constexpr auto
+    debug_json(source_location const &sloc = here()) noexcept
+        -> details::json_record_type<DL, details::out_type_debug>
+    {
+        return details::json_record_type<DL, details::out_type_debug>{"debug", sloc};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a bsl::json_record that outputs a record with an
+    ///     "alert" level to stderr. Like bsl::alert(), if DL is larger
+    ///     than BSL_DEBUG_LEVEL, the record is compiled away.
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam DL the debug level for this record
+    ///   @param sloc the location of the call site
+    ///   @return Returns a bsl::json_record
+    ///
+    template<bsl::uintmax DL = CRITICAL_ONLY>
+    [[nodiscard]] constexpr auto
+    alert_json(source_location const &sloc = here()) noexcept
+        -> details::json_record_type<DL, details::out_type_alert>
+    {
+        return details::json_record_type<DL, details::out_type_alert>{"alert", sloc};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a bsl::json_record that outputs a record with an
+    ///     "error" level to stderr. Like bsl::error(), this cannot be
+    ///     turned off, and the record is output right away, even when
+    ///     output is buffered.
+    ///   @include example_json_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sloc the location of the call site
+    ///   @return Returns a bsl::json_record
+    ///
+    [[nodiscard]] constexpr auto
+    error_json(source_location const &sloc = here()) noexcept
+        -> json_record<details::out_type_error>
+    {
+        return json_record<details::out_type_error>{"error", sloc};
+    }
+}
+
+#endif
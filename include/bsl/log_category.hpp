@@ -0,0 +1,275 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file log_category.hpp
+///
+
+#ifndef BSL_LOG_CATEGORY_HPP
+#define BSL_LOG_CATEGORY_HPP
+
+#include "array.hpp"
+#include "cstdint.hpp"
+#include "cstr_type.hpp"
+#include "details/log_levels.hpp"
+#include "is_constant_evaluated.hpp"
+#include "safe_integral.hpp"
+#include "string_view.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::log_category
+    ///
+    /// <!-- description -->
+    ///   @brief Names a subsystem whose debug level can be changed at
+    ///     runtime. Categories are declared at compile-time, each with a
+    ///     unique id less than 64, and every category starts at
+    ///     BSL_DEBUG_LEVEL. Give a category to bsl::debug() or
+    ///     bsl::alert() to use the category's level instead of
+    ///     BSL_DEBUG_LEVEL, and use bsl::set_log_level() to change it.
+    ///     The levels are stored in a table of bytes, so a disabled
+    ///     statement costs a single load and branch.
+    ///   @include example_log_category_overview.hpp
+    ///
+    class log_category final
+    {
+        /// @brief stores the category's index in the level table
+        bsl::uintmax m_id;
+        /// @brief stores the category's name
+        cstr_type m_name;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::log_category. If the id is not less
+        ///     than 64, or the name is a nullptr, a compile-time error
+        ///     is produced.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the category's unique id
+        ///   @param name the category's name
+        ///
+        consteval log_category(bsl::uintmax const id, cstr_type const name) noexcept    // --
+            : m_id{id}, m_name{name}
+        {
+            if (id >= details::LOG_MAX_CATEGORIES) {
+                details::log_category_invalid();
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (nullptr == name) {
+                details::log_category_invalid();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the category's id
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the category's id
+        ///
+        [[nodiscard]] constexpr auto
+        id() const noexcept -> safe_uintmax
+        {
+            return safe_uintmax{m_id};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the category's name
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the category's name
+        ///
+        [[nodiscard]] constexpr auto
+        name() const noexcept -> cstr_type
+        {
+            return m_name;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the category's current level is at
+        ///     least DL. This is a single load from the level table,
+        ///     which does not need a bounds check as the id was checked
+        ///     at compile-time. During constant evaluation, this always
+        ///     returns false.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam DL the debug level to check
+        ///   @return Returns true if the category's current level is at
+        ///     least DL.
+        ///
+        template<bsl::uintmax DL>
+        [[nodiscard]] constexpr auto
+        is_enabled() const noexcept -> bool
+        {
+            if (is_constant_evaluated()) {
+                return false;
+            }
+
+            // The id was checked against the size of the table when the
+            // category was created, which is a consteval.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto const *const level{&details::get_log_levels().data()[m_id]};
+            return DL <= __atomic_load_n(level, __ATOMIC_RELAXED);
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns a list of the provided categories that can be
+    ///     given to bsl::set_log_level(). If two of the categories share
+    ///     the same id or the same name, a compile-time error is
+    ///     produced, as they would share the same level, or one of them
+    ///     could not be found by name.
+    ///   @related bsl::log_category
+    ///   @include example_log_category_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TN the types of the categories (must be
+    ///     bsl::log_category)
+    ///   @param cats the categories to add to the list
+    ///   @return Returns a list of the provided categories
+    ///
+    template<typename... TN>
+    [[nodiscard]] consteval auto
+    make_log_categories(TN const &...cats) noexcept -> array<log_category, sizeof...(TN)>
+    {
+        array<log_category, sizeof...(TN)> const list{cats...};
+
+        for (safe_uintmax mut_i{}; mut_i < list.size(); ++mut_i) {
+            safe_uintmax const next{mut_i + static_cast<bsl::uintmax>(1)};
+            for (safe_uintmax mut_j{next}; mut_j < list.size(); ++mut_j) {
+                auto const *const lhs{list.at_if(mut_i)};
+                auto const *const rhs{list.at_if(mut_j)};
+
+                if (lhs->id() == rhs->id()) {
+                    details::log_category_invalid();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (string_view{lhs->name()} == string_view{rhs->name()}) {
+                    details::log_category_invalid();
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+
+        return list;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the provided category's current level.
+    ///   @related bsl::log_category
+    ///   @include example_log_category_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param cat the category to query
+    ///   @return Returns the provided category's current level.
+    ///
+    [[nodiscard]] inline auto
+    log_level(log_category const &cat) noexcept -> safe_uintmax
+    {
+        auto const *const level{details::get_log_levels().at_if(cat.id())};
+        return safe_uintmax{static_cast<bsl::uintmax>(__atomic_load_n(level, __ATOMIC_RELAXED))};
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets the provided category's level. Statements using the
+    ///     category with a debug level less than or equal to "level" are
+    ///     outputted, and the rest are not. The level must be between
+    ///     bsl::CRITICAL_ONLY (0) and bsl::VVV (3).
+    ///   @related bsl::log_category
+    ///   @include example_log_category_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param cat the category to change
+    ///   @param level the category's new level
+    ///   @return Returns true if the level was changed, false if the
+    ///     level is invalid.
+    ///
+    [[maybe_unused]] inline auto
+    set_log_level(log_category const &cat, safe_uintmax const &level) noexcept -> bool
+    {
+        constexpr safe_uintmax max_level{static_cast<bsl::uintmax>(3)};
+
+        if (unlikely(!level)) {
+            unlikely_invalid_argument_failure();
+            return false;
+        }
+
+        if (unlikely(level > max_level)) {
+            unlikely_invalid_argument_failure();
+            return false;
+        }
+
+        auto *const pmut_level{details::get_log_levels().at_if(cat.id())};
+        __atomic_store_n(pmut_level, static_cast<bsl::uint8>(level.get()), __ATOMIC_RELAXED);
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets the level of the category in the provided list with
+    ///     the provided name (e.g., from a command line option). Returns
+    ///     false if no category in the list has the provided name, or if
+    ///     the level is invalid.
+    ///   @related bsl::log_category
+    ///   @include example_log_category_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the total number of categories in the list
+    ///   @param cats the list of categories to search
+    ///   @param name the name of the category to change
+    ///   @param level the category's new level
+    ///   @return Returns true if the category was found and its level was
+    ///     changed, false otherwise.
+    ///
+    template<bsl::uintmax N>
+    [[nodiscard]] auto
+    set_log_level(
+        array<log_category, N> const &cats,
+        string_view const &name,
+        safe_uintmax const &level) noexcept -> bool
+    {
+        for (safe_uintmax mut_i{}; mut_i < cats.size(); ++mut_i) {
+            auto const *const cat{cats.at_if(mut_i)};
+            if (name == cat->name()) {
+                return set_log_level(*cat, level);
+            }
+
+            bsl::touch();
+        }
+
+        return false;
+    }
+}
+
+#endif
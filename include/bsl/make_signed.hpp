@@ -119,6 +119,20 @@ namespace bsl
         using type = bsl::int64 const;
     };
 
+    template<>
+    struct make_signed<bsl::uint128> final
+    {
+        /// @brief provides the member typedef "type"
+        using type = bsl::int128;
+    };
+
+    template<>
+    struct make_signed<bsl::uint128 const> final
+    {
+        /// @brief provides the member typedef "type"
+        using type = bsl::int128 const;
+    };
+
     /// @endcond doxygen on
 }
 
@@ -119,6 +119,20 @@ namespace bsl
         using type = bsl::uint64 const;
     };
 
+    template<>
+    struct make_unsigned<bsl::int128> final
+    {
+        /// @brief provides the member typedef "type"
+        using type = bsl::uint128;
+    };
+
+    template<>
+    struct make_unsigned<bsl::int128 const> final
+    {
+        /// @brief provides the member typedef "type"
+        using type = bsl::uint128 const;
+    };
+
     /// @endcond doxygen on
 }
 
@@ -0,0 +1,66 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file memory_order.hpp
+///
+
+#ifndef BSL_MEMORY_ORDER_HPP
+#define BSL_MEMORY_ORDER_HPP
+
+#include "cstdint.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Enumerates the memory orders that can be given to the
+    ///     bsl::atomic operations. The values are the same as the
+    ///     compiler's __ATOMIC_XXX constants, which is what the
+    ///     bsl::atomic operations are built on.
+    ///   @include example_atomic_overview.hpp
+    ///
+    enum class memory_order : bsl::int32
+    {
+        relaxed = __ATOMIC_RELAXED,
+        consume = __ATOMIC_CONSUME,
+        acquire = __ATOMIC_ACQUIRE,
+        release = __ATOMIC_RELEASE,
+        acq_rel = __ATOMIC_ACQ_REL,
+        seq_cst = __ATOMIC_SEQ_CST
+    };
+
+    /// @brief alias for: memory_order::relaxed
+    constexpr memory_order memory_order_relaxed{memory_order::relaxed};
+    /// @brief alias for: memory_order::consume
+    constexpr memory_order memory_order_consume{memory_order::consume};
+    /// @brief alias for: memory_order::acquire
+    constexpr memory_order memory_order_acquire{memory_order::acquire};
+    /// @brief alias for: memory_order::release
+    constexpr memory_order memory_order_release{memory_order::release};
+    /// @brief alias for: memory_order::acq_rel
+    constexpr memory_order memory_order_acq_rel{memory_order::acq_rel};
+    /// @brief alias for: memory_order::seq_cst
+    constexpr memory_order memory_order_seq_cst{memory_order::seq_cst};
+}
+
+#endif
@@ -0,0 +1,231 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file mul_div.hpp
+///
+
+#ifndef BSL_MUL_DIV_HPP
+#define BSL_MUL_DIV_HPP
+
+#include "cstdint.hpp"
+#include "is_signed.hpp"
+#include "mul_hi.hpp"
+#include "numeric_limits.hpp"
+#include "safe_integral.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+#include <bsl/details/div_wide.hpp>
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the magnitude of val as a bsl::uint64 (i.e.,
+        ///     -val if val is negative, val otherwise). Unlike -val, this
+        ///     works for numeric_limits<T>::min() as well.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to convert
+        ///   @param val the value to convert
+        ///   @return Returns the magnitude of val as a bsl::uint64
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        mul_div_magnitude(T const val) noexcept -> bsl::uint64
+        {
+            bsl::uint64 const uval{static_cast<bsl::uint64>(val)};
+            if constexpr (is_signed<T>::value) {
+                if (val < T{}) {
+                    return static_cast<bsl::uint64>(0) - uval;
+                }
+
+                bsl::touch();
+            }
+
+            return uval;
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements bsl::mul_div for integrals that are 32 bits
+        ///     or smaller, whose product always fits in a bsl::int64 or
+        ///     bsl::uint64, so the product can be divided directly.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to multiply and divide
+        ///   @param lhs the left hand side of the multiply
+        ///   @param rhs the right hand side of the multiply
+        ///   @param div the value to divide the product by (not 0)
+        ///   @return Returns (lhs * rhs) / div, or
+        ///     bsl::safe_integral<T>::failure() on overflow
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        mul_div_narrow(T const lhs, T const rhs, T const div) noexcept -> safe_integral<T>
+        {
+            using wide_type = mul_wide_t<T>;
+
+            wide_type const prod{static_cast<wide_type>(lhs) * static_cast<wide_type>(rhs)};
+            wide_type const res{prod / static_cast<wide_type>(div)};
+
+            if (unlikely(res > static_cast<wide_type>(numeric_limits<T>::max()))) {
+                integral_overflow_underflow_wrap_error();
+                return safe_integral<T>::failure();
+            }
+
+            if constexpr (is_signed<T>::value) {
+                if (unlikely(res < static_cast<wide_type>(numeric_limits<T>::min()))) {
+                    integral_overflow_underflow_wrap_error();
+                    return safe_integral<T>::failure();
+                }
+
+                bsl::touch();
+            }
+
+            return safe_integral<T>{static_cast<T>(res)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements bsl::mul_div for 64bit integrals. The
+        ///     product of the magnitudes is split into its high and low
+        ///     halves, and divided using bsl::details::div_wide, so no
+        ///     128bit division (and therefore no compiler runtime) is
+        ///     needed. If the high half is not less than div, the
+        ///     quotient cannot fit in 64 bits, so this is checked before
+        ///     the division.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to multiply and divide
+        ///   @param lhs the left hand side of the multiply
+        ///   @param rhs the right hand side of the multiply
+        ///   @param div the value to divide the product by (not 0)
+        ///   @return Returns (lhs * rhs) / div, or
+        ///     bsl::safe_integral<T>::failure() on overflow
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        mul_div_64(T const lhs, T const rhs, T const div) noexcept -> safe_integral<T>
+        {
+            static_assert(sizeof(T) == sizeof(bsl::uint64));
+
+            bsl::uint64 const ulhs{mul_div_magnitude(lhs)};
+            bsl::uint64 const urhs{mul_div_magnitude(rhs)};
+            bsl::uint64 const udiv{mul_div_magnitude(div)};
+
+            bsl::uint64 const hi{mul_hi_raw(ulhs, urhs)};
+            if (unlikely(hi >= udiv)) {
+                integral_overflow_underflow_wrap_error();
+                return safe_integral<T>::failure();
+            }
+
+            bsl::uint64 const quo{div_wide(hi, ulhs * urhs, udiv)};
+            bsl::uint64 mut_max{static_cast<bsl::uint64>(numeric_limits<T>::max())};
+
+            bool mut_neg{};
+            if constexpr (is_signed<T>::value) {
+                mut_neg = ((lhs < T{}) != (rhs < T{})) != (div < T{});
+                if (mut_neg) {
+                    ++mut_max;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (unlikely(quo > mut_max)) {
+                integral_overflow_underflow_wrap_error();
+                return safe_integral<T>::failure();
+            }
+
+            if (mut_neg) {
+                return safe_integral<T>{static_cast<T>(static_cast<bsl::uint64>(0) - quo)};
+            }
+
+            return safe_integral<T>{static_cast<T>(quo)};
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns (lhs * rhs) / div without the intermediate product
+    ///     overflowing (e.g., converting TSC ticks to nanoseconds using
+    ///     ticks * 1000000000 / freq). The product is computed exactly
+    ///     using an integral that is twice the size of T, so the result
+    ///     is exact (rounded towards zero). For 64bit integrals, the
+    ///     128bit product is divided using a 128/64 division (divq on
+    ///     x86_64), so no compiler runtime is needed. Like the bsl::safe_integral
+    ///     operators, if any of the arguments are invalid, this is
+    ///     reported as an illegal use, and if div is 0, or the result
+    ///     cannot be represented by T, this is reported as an overflow.
+    ///     In all of these cases, bsl::safe_integral<T>::failure() is
+    ///     returned.
+    ///   @include example_mul_div_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to multiply and divide
+    ///   @param lhs the left hand side of the multiply
+    ///   @param rhs the right hand side of the multiply
+    ///   @param div the value to divide the product by
+    ///   @return Returns (lhs * rhs) / div
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    mul_div(
+        safe_integral<T> const &lhs,
+        safe_integral<T> const &rhs,
+        safe_integral<T> const &div) noexcept -> safe_integral<T>
+    {
+        using wide_type = details::mul_wide_t<T>;
+        static_assert(sizeof(T) < sizeof(wide_type), "128bit integrals are not supported");
+
+        if (unlikely(lhs.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        if (unlikely(rhs.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        if (unlikely(div.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        if (unlikely(div.is_zero())) {
+            integral_overflow_underflow_wrap_error();
+            return safe_integral<T>::failure();
+        }
+
+        if constexpr (sizeof(T) <= details::MUL_WIDE_MAX_NARROW_SIZE) {
+            return details::mul_div_narrow(lhs.get(), rhs.get(), div.get());
+        }
+        else {
+            return details::mul_div_64(lhs.get(), rhs.get(), div.get());
+        }
+    }
+}
+
+#endif
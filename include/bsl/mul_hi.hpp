@@ -0,0 +1,123 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file mul_hi.hpp
+///
+
+#ifndef BSL_MUL_HI_HPP
+#define BSL_MUL_HI_HPP
+
+#include "climits.hpp"
+#include "conditional.hpp"
+#include "cstdint.hpp"
+#include "is_signed.hpp"
+#include "safe_integral.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief defines the size of the largest type a 64bit integral
+        ///   can store the product of
+        constexpr bsl::uintmax MUL_WIDE_MAX_NARROW_SIZE{static_cast<bsl::uintmax>(4)};
+
+        /// @brief defines an unsigned type that can store the product of
+        ///   two unsigned Ts without overflowing
+        template<typename T>
+        using mul_wide_unsigned_t = conditional_t<
+            (sizeof(T) <= MUL_WIDE_MAX_NARROW_SIZE),
+            bsl::uint64,
+            bsl::uint128>;
+
+        /// @brief defines a type that can store the product of two Ts
+        ///   without overflowing
+        template<typename T>
+        using mul_wide_t = conditional_t<
+            is_signed<T>::value,
+            conditional_t<(sizeof(T) <= MUL_WIDE_MAX_NARROW_SIZE), bsl::int64, bsl::int128>,
+            mul_wide_unsigned_t<T>>;
+
+        /// <!-- description -->
+        ///   @brief Returns the high half of lhs * rhs (i.e., the bits of
+        ///     the product that do not fit in a T). This never overflows,
+        ///     and on 64bit targets, it compiles down to a single multiply
+        ///     instruction.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to multiply
+        ///   @param lhs the left hand side of the multiply
+        ///   @param rhs the right hand side of the multiply
+        ///   @return Returns the high half of lhs * rhs
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        mul_hi_raw(T const lhs, T const rhs) noexcept -> T
+        {
+            static_assert(sizeof(T) < sizeof(mul_wide_t<T>), "128bit integrals are not supported");
+
+            using wide_type = mul_wide_t<T>;
+            constexpr bsl::uint32 bits{static_cast<bsl::uint32>(sizeof(T) * CHAR_BIT)};
+
+            return static_cast<T>(
+                (static_cast<wide_type>(lhs) * static_cast<wide_type>(rhs)) >> bits);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the high half of lhs * rhs (i.e., the bits of the
+    ///     product that do not fit in a T). Together with lhs * rhs
+    ///     computed with wrapping arithmetic, this provides the exact
+    ///     product of any two Ts. Since the high half of the product
+    ///     always fits in a T, this never overflows. If lhs or rhs are
+    ///     invalid, this is reported as an illegal use, and
+    ///     bsl::safe_integral<T>::failure() is returned.
+    ///   @include example_mul_hi_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to multiply
+    ///   @param lhs the left hand side of the multiply
+    ///   @param rhs the right hand side of the multiply
+    ///   @return Returns the high half of lhs * rhs
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    mul_hi(safe_integral<T> const &lhs, safe_integral<T> const &rhs) noexcept
+        -> safe_integral<T>
+    {
+        if (unlikely(lhs.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        if (unlikely(rhs.invalid())) {
+            illegal_use_of_invalid_safe_integral();
+            return safe_integral<T>::failure();
+        }
+
+        return safe_integral<T>{details::mul_hi_raw(lhs.get(), rhs.get())};
+    }
+}
+
+#endif
@@ -1262,6 +1262,177 @@ namespace bsl
         }
     };
 
+    /// @class bsl::numeric_limits
+    ///
+    /// <!-- description -->
+    ///   @brief Implements std::numeric_limits
+    ///   @include example_numeric_limits_overview.hpp
+    ///
+    template<>
+    class numeric_limits<bsl::int128> final
+    {
+    public:
+        /// @brief stores whether or not this is a specialization
+        static constexpr bool is_specialized{true};
+        /// @brief stores whether or not T is exact
+        static constexpr bool is_exact{true};
+        /// @brief stores whether or not T has defined infinity
+        static constexpr bool has_infinity{false};
+        /// @brief stores whether or not T has a quiet NaN
+        static constexpr bool has_quiet_NaN{false};
+        /// @brief stores whether or not T has a signaling NaN
+        static constexpr bool has_signaling_NaN{false};
+        /// @brief stores the denorm style of T
+        static constexpr float_denorm_style has_denorm{float_denorm_style::denorm_absent};
+        /// @brief stores whether or not floating points detect loss
+        static constexpr bool has_denorm_loss{false};
+        /// @brief stores the rounding style of T
+        static constexpr float_round_style round_style{float_round_style::round_toward_zero};
+        /// @brief stores the type of floating point
+        static constexpr bool is_iec559{false};
+        /// @brief stores whether or not T is bounded
+        static constexpr bool is_bounded{true};
+        /// @brief stores whether or not T handles overflow with modulo
+        static constexpr bool is_modulo{false};
+        /// @brief stores the number of radix digits for T
+        static constexpr bsl::int32 digits{details::get_digits<bsl::int128>()};
+        /// @brief stores the number of base 10 digits for T
+        static constexpr bsl::int32 digits10{0};    // TODO... need to sort out the need for log10
+        /// @brief stores the number of base 10 digits to diff T
+        static constexpr bsl::int32 max_digits10{0};
+        /// @brief stores the integer base that presents digits
+        static constexpr bsl::int32 radix{2};
+        /// @brief stores the smallest negative exponential number
+        static constexpr bsl::int32 min_exponent{0};
+        /// @brief stores the smallest negative exponential number in base 10
+        static constexpr bsl::int32 min_exponent10{0};
+        /// @brief stores the largest positive exponential number
+        static constexpr bsl::int32 max_exponent{0};
+        /// @brief stores the largest positive exponential number in base 10
+        static constexpr bsl::int32 max_exponent10{0};
+        /// @brief stores whether T can generate a trap
+        static constexpr bool traps{false};
+        /// @brief stores whether or T detected tinyness before rounding
+        static constexpr bool tinyness_before{false};
+
+        /// <!-- description -->
+        ///   @brief Returns the min value of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the min value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        min() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(-max() - static_cast<bsl::int128>(1));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the lowest value of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the lowest value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        lowest() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(-max() - static_cast<bsl::int128>(1));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max value of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        max() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(~static_cast<bsl::uint128>(0) >> 1U);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the floating point resolution
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        epsilon() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the rounding error of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the rounding error of T
+        ///
+        [[nodiscard]] static constexpr auto
+        round_error() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of infinity for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of infinity for T
+        ///
+        [[nodiscard]] static constexpr auto
+        infinity() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the quiet NaN value for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the quiet NaN value for T
+        ///
+        [[nodiscard]] static constexpr auto
+        quiet_NaN() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the signaling NaN value for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the signaling NaN value for T
+        ///
+        [[nodiscard]] static constexpr auto
+        signaling_NaN() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the smallest subnormal value for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the smallest subnormal value for T
+        ///
+        [[nodiscard]] static constexpr auto
+        denorm_min() noexcept -> bsl::int128
+        {
+            return static_cast<bsl::int128>(0);
+        }
+    };
+
     /// @class bsl::numeric_limits
     ///
     /// <!-- description -->
@@ -1946,6 +2117,177 @@ namespace bsl
         }
     };
 
+    /// @class bsl::numeric_limits
+    ///
+    /// <!-- description -->
+    ///   @brief Implements std::numeric_limits
+    ///   @include example_numeric_limits_overview.hpp
+    ///
+    template<>
+    class numeric_limits<bsl::uint128> final
+    {
+    public:
+        /// @brief stores whether or not this is a specialization
+        static constexpr bool is_specialized{true};
+        /// @brief stores whether or not T is exact
+        static constexpr bool is_exact{true};
+        /// @brief stores whether or not T has defined infinity
+        static constexpr bool has_infinity{false};
+        /// @brief stores whether or not T has a quiet NaN
+        static constexpr bool has_quiet_NaN{false};
+        /// @brief stores whether or not T has a signaling NaN
+        static constexpr bool has_signaling_NaN{false};
+        /// @brief stores the denorm style of T
+        static constexpr float_denorm_style has_denorm{float_denorm_style::denorm_absent};
+        /// @brief stores whether or not floating points detect loss
+        static constexpr bool has_denorm_loss{false};
+        /// @brief stores the rounding style of T
+        static constexpr float_round_style round_style{float_round_style::round_toward_zero};
+        /// @brief stores the type of floating point
+        static constexpr bool is_iec559{false};
+        /// @brief stores whether or not T is bounded
+        static constexpr bool is_bounded{true};
+        /// @brief stores whether or not T handles overflow with modulo
+        static constexpr bool is_modulo{true};
+        /// @brief stores the number of radix digits for T
+        static constexpr bsl::int32 digits{details::get_digits<bsl::uint128>()};
+        /// @brief stores the number of base 10 digits for T
+        static constexpr bsl::int32 digits10{0};    // TODO... need to sort out the need for log10
+        /// @brief stores the number of base 10 digits to diff T
+        static constexpr bsl::int32 max_digits10{0};
+        /// @brief stores the integer base that presents digits
+        static constexpr bsl::int32 radix{2};
+        /// @brief stores the smallest negative exponential number
+        static constexpr bsl::int32 min_exponent{0};
+        /// @brief stores the smallest negative exponential number in base 10
+        static constexpr bsl::int32 min_exponent10{0};
+        /// @brief stores the largest positive exponential number
+        static constexpr bsl::int32 max_exponent{0};
+        /// @brief stores the largest positive exponential number in base 10
+        static constexpr bsl::int32 max_exponent10{0};
+        /// @brief stores whether T can generate a trap
+        static constexpr bool traps{false};
+        /// @brief stores whether or T detected tinyness before rounding
+        static constexpr bool tinyness_before{false};
+
+        /// <!-- description -->
+        ///   @brief Returns the min value of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the min value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        min() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the lowest value of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the lowest value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        lowest() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max value of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        max() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(~static_cast<bsl::uint128>(0));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the floating point resolution
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max value of T
+        ///
+        [[nodiscard]] static constexpr auto
+        epsilon() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the rounding error of T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the rounding error of T
+        ///
+        [[nodiscard]] static constexpr auto
+        round_error() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of infinity for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of infinity for T
+        ///
+        [[nodiscard]] static constexpr auto
+        infinity() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the quiet NaN value for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the quiet NaN value for T
+        ///
+        [[nodiscard]] static constexpr auto
+        quiet_NaN() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the signaling NaN value for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the signaling NaN value for T
+        ///
+        [[nodiscard]] static constexpr auto
+        signaling_NaN() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the smallest subnormal value for T
+        ///   @include example_numeric_limits_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the smallest subnormal value for T
+        ///
+        [[nodiscard]] static constexpr auto
+        denorm_min() noexcept -> bsl::uint128
+        {
+            return static_cast<bsl::uint128>(0);
+        }
+    };
+
     /// @endcond doxygen on
 }
 
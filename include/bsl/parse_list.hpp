@@ -0,0 +1,388 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file parse_list.hpp
+///
+
+#ifndef BSL_PARSE_LIST_HPP
+#define BSL_PARSE_LIST_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "cstdint.hpp"
+#include "ctype.hpp"
+#include "is_signed.hpp"
+#include "npos.hpp"
+#include "numeric_limits.hpp"
+#include "parse_list_result.hpp"
+#include "safe_integral.hpp"
+#include "span.hpp"
+#include "string_view.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief defines the parse_list code of a character that cannot appear in a field
+        constexpr bsl::uint8 PARSE_LIST_INVALID{CTYPE_NOT_A_DIGIT.get()};
+        /// @brief defines the parse_list code of a delimiter
+        constexpr bsl::uint8 PARSE_LIST_DELIM{static_cast<bsl::uint8>(0xFE)};
+        /// @brief defines the parse_list code of whitespace
+        constexpr bsl::uint8 PARSE_LIST_SPACE{static_cast<bsl::uint8>(0xFD)};
+        /// @brief defines the parse_list code of a '-'
+        constexpr bsl::uint8 PARSE_LIST_MINUS{static_cast<bsl::uint8>(0xFC)};
+
+        /// <!-- description -->
+        ///   @brief Returns true if bsl::parse_list supports the provided
+        ///     base for the provided type. Base 10 is always supported,
+        ///     and base 16 is only supported for unsigned types.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T The type of integral to parse
+        ///   @param base the base to check
+        ///   @return Returns true if the base is supported
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        parse_list_supports(safe_int32 const &base) noexcept -> bool
+        {
+            constexpr safe_int32 base10{10};
+            constexpr safe_int32 base16{16};
+
+            if (base10 == base) {
+                return true;
+            }
+
+            if constexpr (is_signed<T>::value) {
+                return false;
+            }
+
+            return base16 == base;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a table used by bsl::parse_list to classify
+        ///     each character with a single lookup. Each entry is the
+        ///     value of the character as a digit in the provided base, or
+        ///     one of the PARSE_LIST_xxx codes. The table starts as a copy
+        ///     of the ctype digit table. Delimiters are not included, as
+        ///     they are provided by each call to bsl::parse_list.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param digits the total number of digits in the base
+        ///   @param minus true if a '-' is allowed to start a field
+        ///   @return Returns a table used by bsl::parse_list
+        ///
+        [[nodiscard]] constexpr auto
+        parse_list_make_base_table(safe_uint8 const &digits, bool const minus) noexcept
+            -> array<bsl::uint8, CTYPE_TABLE_SIZE>
+        {
+            array<bsl::uint8, CTYPE_TABLE_SIZE> mut_table{CTYPE_DIGIT_TABLE};
+            for (safe_uintmax mut_i{}; mut_i < CTYPE_TABLE_SIZE; ++mut_i) {
+                auto *const pmut_elem{mut_table.at_if(mut_i)};
+                if (safe_uint8{*pmut_elem} >= digits) {
+                    *pmut_elem = PARSE_LIST_INVALID;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (ctype_is(static_cast<char_type>(mut_i.get()), CTYPE_SPACE)) {
+                    *pmut_elem = PARSE_LIST_SPACE;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (minus) {
+                *mut_table.at_if(ctype_idx('-')) = PARSE_LIST_MINUS;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_table;
+        }
+
+        /// @brief stores the bsl::parse_list table for base 10 unsigned integrals
+        constexpr array<bsl::uint8, CTYPE_TABLE_SIZE> PARSE_LIST_TABLE_DEC{
+            parse_list_make_base_table(safe_uint8{static_cast<bsl::uint8>(10)}, false)};
+        /// @brief stores the bsl::parse_list table for base 10 signed integrals
+        constexpr array<bsl::uint8, CTYPE_TABLE_SIZE> PARSE_LIST_TABLE_DEC_SIGNED{
+            parse_list_make_base_table(safe_uint8{static_cast<bsl::uint8>(10)}, true)};
+        /// @brief stores the bsl::parse_list table for base 16 unsigned integrals
+        constexpr array<bsl::uint8, CTYPE_TABLE_SIZE> PARSE_LIST_TABLE_HEX{
+            parse_list_make_base_table(safe_uint8{static_cast<bsl::uint8>(16)}, false)};
+
+        /// <!-- description -->
+        ///   @brief Returns the PARSE_LIST_TABLE_xxx constant for the
+        ///     provided type and base.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T The type of integral to parse
+        ///   @param base either 10 or 16
+        ///   @return Returns the PARSE_LIST_TABLE_xxx constant for the
+        ///     provided type and base.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        parse_list_base_table(safe_int32 const &base) noexcept
+            -> array<bsl::uint8, CTYPE_TABLE_SIZE> const &
+        {
+            constexpr safe_int32 base16{16};
+
+            if (base16 == base) {
+                return PARSE_LIST_TABLE_HEX;
+            }
+
+            if constexpr (is_signed<T>::value) {
+                return PARSE_LIST_TABLE_DEC_SIGNED;
+            }
+
+            return PARSE_LIST_TABLE_DEC;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the table used by bsl::parse_list to classify
+        ///     each character with a single lookup. The digit, whitespace
+        ///     and '-' entries come from one of the PARSE_LIST_TABLE_xxx
+        ///     constants, which are only built once at compile-time, so a
+        ///     call only copies the table and overlays the provided
+        ///     delimiters, which take priority over everything else.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T The type of integral to parse
+        ///   @param delims the set of characters that separate each field
+        ///   @param base either 10 or 16
+        ///   @return Returns the table used by bsl::parse_list
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        parse_list_make_table(string_view const &delims, safe_int32 const &base) noexcept
+            -> array<bsl::uint8, CTYPE_TABLE_SIZE>
+        {
+            array<bsl::uint8, CTYPE_TABLE_SIZE> mut_table{parse_list_base_table<T>(base)};
+            for (safe_uintmax mut_i{}; mut_i < delims.length(); ++mut_i) {
+                *mut_table.at_if(ctype_idx(*delims.at_if(mut_i))) = PARSE_LIST_DELIM;
+            }
+
+            return mut_table;
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the field at "count" as bad, storing an invalid
+        ///     bsl::safe_integral in mut_out if there is room for it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T The type of integral to parse
+        ///   @param mut_out the span to store the parsed fields in
+        ///   @param count the index of the bad field
+        ///   @return Returns a bsl::parse_list_result for the bad field
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        parse_list_bad_field(span<safe_integral<T>> &mut_out, safe_uintmax const &count) noexcept
+            -> parse_list_result
+        {
+            auto *const pmut_elem{mut_out.at_if(count)};
+            if (nullptr != pmut_elem) {
+                *pmut_elem = safe_integral<T>::failure();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return {count, count};
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Parses a list of delimiter separated integrals into the
+    ///     provided span in a single pass over the string. Each field is
+    ///     converted using the same rules as bsl::from_chars, meaning
+    ///     leading whitespace is ignored, a '-' may only start a base 10
+    ///     field of a signed type, base 10 and base 16 are supported,
+    ///     and base 16 can only be an unsigned type. Instead of finding
+    ///     each field and then converting it, every character is
+    ///     classified with a single lookup into a table that is built at
+    ///     compile-time for the type and base (only the delimiters are
+    ///     added per call), and its digit is accumulated into a raw
+    ///     magnitude as it is read, so each character is only ever read
+    ///     once, and overflow is only checked near the limit of a T.
+    ///     Some key points:
+    ///     - Parsing stops at the first field that cannot be converted.
+    ///       The index of this field is returned as the bad field, and
+    ///       out.at_if(bad_field) (if it exists) is left holding a
+    ///       bsl::safe_integral with its error flag set.
+    ///     - Parsing also stops if there is no more room in out. In this
+    ///       case, the bad field is the index of the first field that
+    ///       could not be stored.
+    ///     - Consecutive delimiters, or a trailing delimiter, produce an
+    ///       empty field, which is a bad field.
+    ///     - An empty string is an empty list, and is not an error.
+    ///   @include example_parse_list_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T The type of integral to parse
+    ///   @param str the string containing the list to parse
+    ///   @param delims the set of characters that separate each field
+    ///   @param out the span to store the parsed fields in
+    ///   @param base either 10 or 16
+    ///   @return Returns a bsl::parse_list_result containing the total
+    ///     number of fields stored in out, and the index of the first
+    ///     bad field, or bsl::npos if every field was parsed.
+    ///
+    template<typename T>
+    [[maybe_unused]] constexpr auto
+    parse_list(
+        string_view const &str,
+        string_view const &delims,
+        span<safe_integral<T>> const &out,
+        safe_int32 const &base) noexcept -> parse_list_result
+    {
+        span<safe_integral<T>> mut_out{out};
+        if (str.empty()) {
+            return {{}, npos};
+        }
+
+        if (unlikely(!details::parse_list_supports<T>(base))) {
+            unlikely_invalid_argument_failure();
+            return details::parse_list_bad_field(mut_out, {});
+        }
+
+        auto const table{details::parse_list_make_table<T>(delims, base)};
+
+        // Each field is accumulated as a raw magnitude. Only once the
+        // magnitude reaches "cutoff" can the next digit overflow, so the
+        // exact check (which needs a division) is only done for the last
+        // digit or two of a field that is close to the limit of a T.
+        constexpr bsl::uintmax one{static_cast<bsl::uintmax>(1)};
+        constexpr bsl::uintmax max_mag{static_cast<bsl::uintmax>(numeric_limits<T>::max())};
+        bsl::uintmax const radix{static_cast<bsl::uintmax>(base.get())};
+        bsl::uintmax const cutoff{max_mag / radix};
+
+        safe_uintmax mut_count{};
+        bsl::uintmax mut_mag{};
+        bsl::uintmax mut_limit{max_mag};
+        bool mut_started{};
+        bool mut_negate{};
+        bool mut_digits{};
+
+        // The string and the table are bounds checked once, and then
+        // their elements are read directly.
+        auto const *const chars{str.data()};
+        auto const *const codes{table.data()};
+        bsl::uintmax const len{str.length().get()};
+
+        for (bsl::uintmax mut_i{}; mut_i <= len; ++mut_i) {
+            bsl::uint8 mut_code{details::PARSE_LIST_DELIM};
+            if (mut_i < len) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                mut_code = codes[details::ctype_idx(chars[mut_i]).get()];
+            }
+            else {
+                bsl::touch();
+            }
+
+            switch (mut_code) {
+                case details::PARSE_LIST_DELIM: {
+                    if (unlikely(!mut_digits)) {
+                        return details::parse_list_bad_field(mut_out, mut_count);
+                    }
+
+                    auto *const pmut_elem{mut_out.at_if(mut_count)};
+                    if (unlikely(nullptr == pmut_elem)) {
+                        return {mut_count, mut_count};
+                    }
+
+                    if (mut_negate) {
+                        *pmut_elem = safe_integral<T>{static_cast<T>(bsl::uintmax{} - mut_mag)};
+                    }
+                    else {
+                        *pmut_elem = safe_integral<T>{static_cast<T>(mut_mag)};
+                    }
+
+                    ++mut_count;
+                    mut_mag = {};
+                    mut_limit = max_mag;
+                    mut_started = false;
+                    mut_negate = false;
+                    mut_digits = false;
+                    break;
+                }
+
+                case details::PARSE_LIST_SPACE: {
+                    if (unlikely(mut_started)) {
+                        return details::parse_list_bad_field(mut_out, mut_count);
+                    }
+
+                    break;
+                }
+
+                case details::PARSE_LIST_MINUS: {
+                    if (unlikely(mut_started)) {
+                        return details::parse_list_bad_field(mut_out, mut_count);
+                    }
+
+                    mut_started = true;
+                    mut_negate = true;
+                    mut_limit = max_mag + one;
+                    break;
+                }
+
+                case details::PARSE_LIST_INVALID: {
+                    return details::parse_list_bad_field(mut_out, mut_count);
+                }
+
+                default: {
+                    bsl::uintmax const digit{static_cast<bsl::uintmax>(mut_code)};
+
+                    mut_started = true;
+                    mut_digits = true;
+
+                    if (unlikely(mut_mag >= cutoff)) {
+                        if (mut_mag > ((mut_limit - digit) / radix)) {
+                            return details::parse_list_bad_field(mut_out, mut_count);
+                        }
+
+                        bsl::touch();
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    mut_mag = (mut_mag * radix) + digit;
+                    break;
+                }
+            }
+        }
+
+        return {mut_count, npos};
+    }
+}
+
+#endif
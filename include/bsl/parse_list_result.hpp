@@ -0,0 +1,52 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file parse_list_result.hpp
+///
+
+#ifndef BSL_PARSE_LIST_RESULT_HPP
+#define BSL_PARSE_LIST_RESULT_HPP
+
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::parse_list_result
+    ///
+    /// <!-- description -->
+    ///   @brief Provides the return value of bsl::parse_list. This tells
+    ///     the caller how many fields were stored in the provided span,
+    ///     as well as the index of the first field that could not be
+    ///     parsed (or bsl::npos if every field was parsed).
+    ///
+    struct parse_list_result final
+    {
+        /// @brief stores the total number of fields that were parsed
+        safe_uintmax count;
+        /// @brief stores the index of the first bad field, or bsl::npos
+        safe_uintmax bad_field;
+    };
+}
+
+#endif
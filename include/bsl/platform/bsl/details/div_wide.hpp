@@ -0,0 +1,71 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_DIV_WIDE_HPP
+#define BSL_DETAILS_DIV_WIDE_HPP
+
+#include "../../../cstdint.hpp"
+#include "../../../details/div_wide_raw.hpp"
+#include "../../../is_constant_evaluated.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Returns ((hi << 64) | lo) / div without calling the
+    ///     compiler's 128bit division runtime (e.g., __udivti3), which
+    ///     is slow and is not available to freestanding targets. On
+    ///     x86_64 this is a single divq. Everywhere else (and at
+    ///     compile-time), bsl::details::div_wide_raw is used. hi must be
+    ///     less than div, which ensures that the quotient fits in 64 bits
+    ///     (divq faults otherwise).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param hi the high 64 bits of the dividend
+    ///   @param lo the low 64 bits of the dividend
+    ///   @param div the value to divide the dividend by
+    ///   @return Returns ((hi << 64) | lo) / div
+    ///
+    [[nodiscard]] constexpr auto
+    div_wide(bsl::uint64 const hi, bsl::uint64 const lo, bsl::uint64 const div) noexcept
+        -> bsl::uint64
+    {
+        if (is_constant_evaluated()) {
+            return div_wide_raw(hi, lo, div);
+        }
+
+#if defined(__x86_64__)
+        bsl::uint64 mut_quo{lo};
+        bsl::uint64 mut_rem{hi};
+
+        // NOLINTNEXTLINE(hicpp-no-assembler)
+        __asm__("divq %[div]" : "+a"(mut_quo), "+d"(mut_rem) : [div] "rm"(div) : "cc");
+
+        return mut_quo;
+#else
+        return div_wide_raw(hi, lo, div);
+#endif
+    }
+}
+
+#endif
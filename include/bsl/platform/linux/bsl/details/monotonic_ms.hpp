@@ -0,0 +1,64 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_MONOTONIC_MS_HPP
+#define BSL_DETAILS_MONOTONIC_MS_HPP
+
+#include "../../../../cstdint.hpp"
+#include "../../../../discard.hpp"
+#include "../../../../safe_integral.hpp"
+
+#include <time.h>
+
+namespace bsl::details
+{
+    /// @brief defines the total number of milliseconds in a second
+    constexpr bsl::uintmax MONOTONIC_MS_PER_S{static_cast<bsl::uintmax>(1000)};
+    /// @brief defines the total number of nanoseconds in a millisecond
+    constexpr bsl::uintmax MONOTONIC_NS_PER_MS{static_cast<bsl::uintmax>(1000000)};
+
+    /// <!-- description -->
+    ///   @brief Returns the number of milliseconds since some fixed
+    ///     point in the past. The coarse clock is used as it is read
+    ///     from the vDSO without a system call, and millisecond
+    ///     precision is all that is needed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the number of milliseconds since some fixed
+    ///     point in the past.
+    ///
+    [[nodiscard]] inline auto
+    monotonic_ms() noexcept -> safe_uintmax
+    {
+        timespec mut_ts{};
+        bsl::discard(clock_gettime(CLOCK_MONOTONIC_COARSE, &mut_ts));
+
+        safe_uintmax const sec{static_cast<bsl::uintmax>(mut_ts.tv_sec)};
+        safe_uintmax const nsec{static_cast<bsl::uintmax>(mut_ts.tv_nsec)};
+
+        return (sec * MONOTONIC_MS_PER_S) + (nsec / MONOTONIC_NS_PER_MS);
+    }
+}
+
+#endif
@@ -0,0 +1,324 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_PRINT_THREAD_ID_HPP
+#define BSL_DETAILS_PRINT_THREAD_ID_HPP
+
+#include "../../../../cstdint.hpp"
+#include "../../../../details/out.hpp"
+#include "../../../../discard.hpp"
+#include "../../../../fmt.hpp"
+#include "../../../../is_constant_evaluated.hpp"
+#include "../../../../safe_integral.hpp"
+#include "../../../../touch.hpp"
+
+#include <bsl/details/thread_storage.hpp>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+#include <sched.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace bsl::details
+{
+    /// @brief defines the total number of nanoseconds in a second
+    constexpr bsl::uintmax TIMESTAMP_NS_PER_S{static_cast<bsl::uintmax>(1000000000)};
+    /// @brief defines how long the timestamp clock is calibrated for
+    constexpr long TIMESTAMP_CALIBRATION_NS{10000000L};
+
+    /// @class bsl::details::thread_id_cache
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the ID of a thread once it has been read from the
+    ///     kernel. This is its own type so that it gets its own
+    ///     bsl::details::thread_storage instance.
+    ///
+    struct thread_id_cache final
+    {
+        /// @brief stores the ID of the thread, or 0 if it was not read yet
+        bsl::uintmax tid;
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the ID of the calling thread. The ID is only
+    ///     read from the kernel the first time a thread calls this
+    ///     function, after which it is cached in the thread's
+    ///     bsl::details::thread_storage.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the ID of the calling thread
+    ///
+    [[nodiscard]] inline auto
+    thread_id() noexcept -> safe_uintmax
+    {
+        auto &mut_cache{thread_storage<thread_id_cache>()};
+        if (static_cast<bsl::uintmax>(0) == mut_cache.tid) {
+            // syscall() is variadic, which is the only way to call gettid
+            // without requiring glibc 2.30 or higher.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            mut_cache.tid = static_cast<bsl::uintmax>(syscall(SYS_gettid));
+        }
+        else {
+            bsl::touch();
+        }
+
+        return safe_uintmax{mut_cache.tid};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of nanoseconds since some fixed
+    ///     point in the past.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the number of nanoseconds since some fixed
+    ///     point in the past.
+    ///
+    [[nodiscard]] inline auto
+    monotonic_ns() noexcept -> safe_uintmax
+    {
+        timespec mut_ts{};
+        bsl::discard(clock_gettime(CLOCK_MONOTONIC, &mut_ts));
+
+        safe_uintmax const sec{static_cast<bsl::uintmax>(mut_ts.tv_sec)};
+        safe_uintmax const nsec{static_cast<bsl::uintmax>(mut_ts.tv_nsec)};
+
+        return (sec * TIMESTAMP_NS_PER_S) + nsec;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU has an invariant TSC (i.e., the
+    ///     TSC ticks at a constant rate in every P, C and T state, and is
+    ///     synchronized between CPUs). Returns false if it does not, or
+    ///     if this is not x86_64.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns true if the CPU has an invariant TSC
+    ///
+    [[nodiscard]] inline auto
+    timestamp_has_invariant_tsc() noexcept -> bool
+    {
+#if defined(__x86_64__)
+        constexpr bsl::uint32 leaf{static_cast<bsl::uint32>(0x80000007)};
+        constexpr bsl::uint32 invariant_tsc{static_cast<bsl::uint32>(0x100)};
+
+        bsl::uint32 mut_eax{};
+        bsl::uint32 mut_ebx{};
+        bsl::uint32 mut_ecx{};
+        bsl::uint32 mut_edx{};
+
+        if (0 == __get_cpuid(leaf, &mut_eax, &mut_ebx, &mut_ecx, &mut_edx)) {
+            return false;
+        }
+
+        return static_cast<bsl::uint32>(0) != (mut_edx & invariant_tsc);
+#else
+        return false;
+#endif
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the current value of the timestamp counter. If
+    ///     tsc is true, this is the TSC, which is read using rdtscp so
+    ///     that the read is not executed before the instructions that
+    ///     come before it. Otherwise, the monotonic clock is used.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tsc true to read the TSC, false to read the monotonic clock
+    ///   @return Returns the current value of the timestamp counter
+    ///
+    [[nodiscard]] inline auto
+    timestamp_ticks(bool const tsc) noexcept -> safe_uintmax
+    {
+#if defined(__x86_64__)
+        if (tsc) {
+            bsl::uint32 mut_aux{};
+            return safe_uintmax{static_cast<bsl::uintmax>(__builtin_ia32_rdtscp(&mut_aux))};
+        }
+
+        bsl::touch();
+#else
+        bsl::discard(tsc);
+#endif
+
+        return monotonic_ns();
+    }
+
+    /// @class bsl::details::timestamp_clock
+    ///
+    /// <!-- description -->
+    ///   @brief Converts timestamp counter ticks into the time since
+    ///     the clock was created. The TSC is only used if it is
+    ///     invariant, in which case the number of ticks per second is
+    ///     calibrated once against the monotonic clock when the clock is
+    ///     created, so reading the time is a single rdtscp, three
+    ///     divisions and a modulo. Otherwise, the monotonic clock is used
+    ///     directly and no calibration is needed.
+    ///
+    class timestamp_clock final
+    {
+        /// @brief stores whether or not the TSC is used
+        bool m_tsc;
+        /// @brief stores the ticks when the clock was created
+        safe_uintmax m_base;
+        /// @brief stores the total number of ticks per second
+        safe_uintmax m_ticks_per_s;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates and calibrates a bsl::details::timestamp_clock
+        ///
+        timestamp_clock() noexcept    // --
+            : m_tsc{timestamp_has_invariant_tsc()}, m_base{}, m_ticks_per_s{TIMESTAMP_NS_PER_S}
+        {
+            if (!m_tsc) {
+                m_base = timestamp_ticks(m_tsc);
+                return;
+            }
+
+            safe_uintmax const ns0{monotonic_ns()};
+            safe_uintmax const ticks0{timestamp_ticks(m_tsc)};
+
+            constexpr timespec delay{0, TIMESTAMP_CALIBRATION_NS};
+            bsl::discard(nanosleep(&delay, nullptr));
+
+            safe_uintmax const ns1{monotonic_ns()};
+            safe_uintmax const ticks1{timestamp_ticks(m_tsc)};
+
+            safe_uintmax const ticks_per_s{((ticks1 - ticks0) * TIMESTAMP_NS_PER_S) / (ns1 - ns0)};
+            if (ticks_per_s.is_pos()) {
+                m_ticks_per_s = ticks_per_s;
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_base = ticks1;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of whole seconds and the number of
+        ///     remaining nanoseconds since the clock was created.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sec returns the number of whole seconds
+        ///   @param mut_nsec returns the number of remaining nanoseconds
+        ///
+        void
+        now(safe_uintmax &mut_sec, safe_uintmax &mut_nsec) const noexcept
+        {
+            safe_uintmax mut_ticks{timestamp_ticks(m_tsc)};
+            if (mut_ticks < m_base) {
+                mut_ticks = m_base;
+            }
+            else {
+                bsl::touch();
+            }
+
+            mut_ticks -= m_base;
+            mut_sec = mut_ticks / m_ticks_per_s;
+            mut_nsec = ((mut_ticks % m_ticks_per_s) * TIMESTAMP_NS_PER_S) / m_ticks_per_s;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns the global timestamp clock, creating (and
+    ///     calibrating) it the first time this is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the global timestamp clock
+    ///
+    [[nodiscard]] inline auto
+    get_timestamp_clock() noexcept -> timestamp_clock const &
+    {
+        static timestamp_clock const clk{};
+        return clk;
+    }
+
+    /// <!-- description -->
+    ///   @brief Creates the global timestamp clock if ENABLE_TIMESTAMP
+    ///     is true. This is called during static initialization, so
+    ///     that the calibration is done once at startup instead of by
+    ///     the first debug statement.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns ENABLE_TIMESTAMP
+    ///
+    [[nodiscard]] inline auto
+    init_timestamp_clock() noexcept -> bool
+    {
+        if constexpr (ENABLE_TIMESTAMP) {
+            bsl::discard(get_timestamp_clock());
+        }
+
+        return ENABLE_TIMESTAMP;
+    }
+
+    /// @brief creates the global timestamp clock during static initialization
+    [[maybe_unused]] inline bool const TIMESTAMP_CLOCK_INITIALIZED{init_timestamp_clock()};
+
+    /// <!-- description -->
+    ///   @brief Outputs the current thread ID info. If ENABLE_TIMESTAMP
+    ///     is true, " [<sec>.<nsec>]" is output, which is the time since
+    ///     the program started. If ENABLE_THREAD_ID is true,
+    ///     " [<cpu>:<tid>]" is output, which is the CPU the calling thread
+    ///     is running on and its thread ID. If both are false, this
+    ///     outputs nothing and costs nothing.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of outputter provided
+    ///   @param o the outputter
+    ///
+    template<typename T>
+    constexpr void
+    print_thread_id(out<T> const o) noexcept
+    {
+        if (is_constant_evaluated()) {
+            return;
+        }
+
+        if constexpr (ENABLE_TIMESTAMP) {
+            safe_uintmax mut_sec{};
+            safe_uintmax mut_nsec{};
+            get_timestamp_clock().now(mut_sec, mut_nsec);
+
+            o << " [" << mut_sec << '.' << fmt{"09d"_fmt, mut_nsec} << ']';
+        }
+        else {
+            bsl::touch();
+        }
+
+        if constexpr (ENABLE_THREAD_ID) {
+            safe_int32 const cpu{sched_getcpu()};
+            o << " [" << cpu << ':' << thread_id() << ']';
+        }
+        else {
+            bsl::discard(o);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,120 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_START_OUT_DRAIN_THREAD_HPP
+#define BSL_DETAILS_START_OUT_DRAIN_THREAD_HPP
+
+#include "../../../../details/out_drain_result.hpp"
+#include "../../../../discard.hpp"
+#include "../../../../touch.hpp"
+
+#include <pthread.h>
+#include <time.h>
+
+namespace bsl::details
+{
+    /// @brief defines how long the drain thread sleeps when there is nothing to drain
+    constexpr long OUT_DRAIN_THREAD_SLEEP_NS{100000L};
+
+    /// <!-- description -->
+    ///   @brief Returns the drain thread's handle, which is needed to
+    ///     join the drain thread when it is stopped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the drain thread's handle
+    ///
+    [[nodiscard]] inline auto
+    get_out_drain_thread() noexcept -> pthread_t &
+    {
+        static constinit pthread_t mut_thread{};
+        return mut_thread;
+    }
+
+    /// <!-- description -->
+    ///   @brief The drain thread's entry point. Calls the provided drain
+    ///     function until it returns out_drain_result_stopped, sleeping
+    ///     whenever it has nothing to drain.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_func the drain function to call
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] inline auto
+    out_drain_thread_entry(void *const pmut_func) noexcept -> void *
+    {
+        // pthreads can only provide the drain function as a void *, so
+        // it must be converted back before it can be called.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto *const func{reinterpret_cast<out_drain_result (*)() noexcept>(pmut_func)};
+
+        constexpr timespec delay{0, OUT_DRAIN_THREAD_SLEEP_NS};
+        while (true) {
+            auto const ret{func()};
+            if (out_drain_result::out_drain_result_stopped == ret) {
+                return nullptr;
+            }
+
+            if (out_drain_result::out_drain_result_idle == ret) {
+                bsl::discard(nanosleep(&delay, nullptr));
+            }
+            else {
+                bsl::touch();
+            }
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Starts a thread that calls the provided drain function
+    ///     until it returns out_drain_result_stopped, writing committed
+    ///     output in batches so that the threads producing the output
+    ///     never block on stdio. The thread must be stopped using
+    ///     bsl::details::stop_out_drain_thread().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param func the drain function to call
+    ///   @return Returns true if the thread was started, false otherwise.
+    ///
+    [[nodiscard]] inline auto
+    start_out_drain_thread(out_drain_result (*const func)() noexcept) noexcept -> bool
+    {
+        // pthreads can only provide the drain function as a void *.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto *const pmut_arg{reinterpret_cast<void *>(func)};
+        auto *const pmut_thread{&get_out_drain_thread()};
+        return 0 == pthread_create(pmut_thread, nullptr, &out_drain_thread_entry, pmut_arg);
+    }
+
+    /// <!-- description -->
+    ///   @brief Waits for a drain thread that was started using
+    ///     bsl::details::start_out_drain_thread() to exit. The drain
+    ///     function must already be returning out_drain_result_stopped.
+    ///
+    inline void
+    stop_out_drain_thread() noexcept
+    {
+        bsl::discard(pthread_join(get_out_drain_thread(), nullptr));
+    }
+}
+
+#endif
@@ -0,0 +1,52 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_MONOTONIC_MS_HPP
+#define BSL_DETAILS_MONOTONIC_MS_HPP
+
+#include "Windows.h"
+#undef min
+#undef max
+
+#include "../../../../cstdint.hpp"
+#include "../../../../safe_integral.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Returns the number of milliseconds since some fixed
+    ///     point in the past.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the number of milliseconds since some fixed
+    ///     point in the past.
+    ///
+    [[nodiscard]] inline auto
+    monotonic_ms() noexcept -> safe_uintmax
+    {
+        return safe_uintmax{static_cast<bsl::uintmax>(GetTickCount64())};
+    }
+}
+
+#endif
@@ -0,0 +1,59 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BSL_DETAILS_START_OUT_DRAIN_THREAD_HPP
+#define BSL_DETAILS_START_OUT_DRAIN_THREAD_HPP
+
+#include "../../../../details/out_drain_result.hpp"
+#include "../../../../discard.hpp"
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Starts a thread that drains committed output in the
+    ///     background. This is not supported on Windows yet, so false is
+    ///     always returned and output is drained by the thread that
+    ///     commits it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param func the drain function to call
+    ///   @return Always returns false
+    ///
+    [[nodiscard]] inline auto
+    start_out_drain_thread(out_drain_result (*const func)() noexcept) noexcept -> bool
+    {
+        bsl::discard(func);
+        return false;
+    }
+
+    /// <!-- description -->
+    ///   @brief Does nothing, as the drain thread is never started on
+    ///     Windows.
+    ///
+    inline void
+    stop_out_drain_thread() noexcept
+    {}
+}
+
+#endif
@@ -0,0 +1,2017 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file policy_integral.hpp
+///
+
+#ifndef BSL_POLICY_INTEGRAL_HPP
+#define BSL_POLICY_INTEGRAL_HPP
+
+#include "always_false.hpp"
+#include "cstdint.hpp"
+#include "discard.hpp"
+#include "enable_if.hpp"
+#include "is_integral.hpp"
+#include "is_same.hpp"
+#include "is_signed.hpp"
+#include "is_unsigned.hpp"
+#include "numeric_limits.hpp"
+#include "safe_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::policy_integral
+    ///
+    /// <!-- description -->
+    ///   @brief Provides an integral type that has no error state, and
+    ///     whose arithmetic is implemented by the policy P. P provides
+    ///     static add, sub, mul, div, mod, shl and shr functions that
+    ///     decide what happens on overflow, underflow and wrap. This type
+    ///     is not used directly. Instead, use bsl::saturating_integral or
+    ///     bsl::wrapping_integral, which provide the policies.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///
+    template<typename T, typename P>
+    class policy_integral final
+    {
+        static_assert(bsl::is_integral<T>::value, "only integral types are supported");
+
+        /// @brief stores the value of the integral
+        T m_val;
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+        /// @brief alias for: T &
+        using pointer_type = T *;
+        /// @brief alias for: T const
+        using const_pointer_type = T const *;
+        /// @brief alias for: T &
+        using reference_type = T &;
+        /// @brief alias for: T const
+        using const_reference_type = T const &;
+
+        /// <!-- description -->
+        ///   @brief Default constructor that creates a bsl::policy_integral
+        ///     with get() == 0.
+        ///
+        constexpr policy_integral() noexcept    // --
+            : m_val{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::policy_integral given a BSL fixed width
+        ///     type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param val the value to set the bsl::policy_integral to
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        explicit constexpr policy_integral(U const val) noexcept    // --
+            : m_val{val}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::policy_integral given a bsl::safe_integral
+        ///     of the same type. Since a bsl::policy_integral has no error
+        ///     state, creating one from an invalid bsl::safe_integral is
+        ///     reported as an illegal use, resulting in a value of 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the bsl::policy_integral to
+        ///
+        explicit constexpr policy_integral(safe_integral<T> const &val) noexcept    // --
+            : m_val{val.get()}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::policy_integral
+        ///
+        constexpr ~policy_integral() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr policy_integral(policy_integral const &o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr policy_integral(policy_integral &&mut_o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(policy_integral const &o) &noexcept
+            -> policy_integral & = default;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(policy_integral &&mut_o) &noexcept
+            -> policy_integral & = default;
+
+        /// <!-- description -->
+        ///   @brief Sets the bsl::policy_integral to a BSL fixed width type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param val the value to set the bsl::policy_integral to
+        ///   @return Returns *this
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator=(U const val) &noexcept -> policy_integral<value_type, P> &
+        {
+            m_val = val;
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param val n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator=(U const val) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns the value stored by the bsl::policy_integral.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value stored by the bsl::policy_integral.
+        ///
+        [[nodiscard]] constexpr auto
+        get() const noexcept -> value_type
+        {
+            return m_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the value stored by the
+        ///     bsl::policy_integral.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the value stored by the
+        ///     bsl::policy_integral.
+        ///
+        [[nodiscard]] constexpr auto
+        data() noexcept -> pointer_type
+        {
+            return &m_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the value stored by the
+        ///     bsl::policy_integral.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the value stored by the
+        ///     bsl::policy_integral.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const noexcept -> const_pointer_type
+        {
+            return &m_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max value the bsl::policy_integral can store.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max value the bsl::policy_integral can store.
+        ///
+        [[nodiscard]] static constexpr auto
+        max() noexcept -> policy_integral<value_type, P>
+        {
+            return policy_integral<value_type, P>{numeric_limits<value_type>::max()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max of *this and other.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param other the other integral to compare with
+        ///   @return Returns the max of *this and other.
+        ///
+        [[nodiscard]] constexpr auto
+        max(policy_integral<value_type, P> const &other) const noexcept
+            -> policy_integral<value_type, P>
+        {
+            if (*this < other) {
+                return other;
+            }
+
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the min value the bsl::policy_integral can store.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the min value the bsl::policy_integral can store.
+        ///
+        [[nodiscard]] static constexpr auto
+        min() noexcept -> policy_integral<value_type, P>
+        {
+            return policy_integral<value_type, P>{numeric_limits<value_type>::min()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the min of *this and other.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param other the other integral to compare with
+        ///   @return Returns the min of *this and other.
+        ///
+        [[nodiscard]] constexpr auto
+        min(policy_integral<value_type, P> const &other) const noexcept
+            -> policy_integral<value_type, P>
+        {
+            if (*this < other) {
+                return *this;
+            }
+
+            return other;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::policy_integral is positive.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::policy_integral is positive.
+        ///
+        [[nodiscard]] constexpr auto
+        is_pos() const noexcept -> bool
+        {
+            constexpr value_type zero{static_cast<value_type>(0)};
+            return zero < *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::policy_integral is negative.
+        ///     Like bsl::safe_integral, calling this on an unsigned type
+        ///     is reported as an illegal use.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::policy_integral is negative.
+        ///
+        [[nodiscard]] constexpr auto
+        is_neg() const noexcept -> bool
+        {
+            if constexpr (is_unsigned<value_type>::value) {
+                illegal_use_of_invalid_safe_integral();
+                return false;
+            }
+
+            constexpr value_type zero{static_cast<value_type>(0)};
+            return zero > *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the bsl::policy_integral is 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the bsl::policy_integral is 0.
+        ///
+        [[nodiscard]] constexpr auto
+        is_zero() const noexcept -> bool
+        {
+            constexpr value_type zero{static_cast<value_type>(0)};
+            return zero == *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns *this += rhs. If this operation would
+        ///     overflow, underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to add to *this
+        ///   @return Returns *this += rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator+=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            m_val = P::add(m_val, rhs.m_val);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator+=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this += rhs. If this operation would
+        ///     overflow, underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to add to *this
+        ///   @return Returns *this += rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator+=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            m_val = P::add(m_val, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator+=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this -= rhs. If this operation would
+        ///     overflow, underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to subtract from *this
+        ///   @return Returns *this -= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator-=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            m_val = P::sub(m_val, rhs.m_val);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator-=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this -= rhs. If this operation would
+        ///     overflow, underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to subtract from *this
+        ///   @return Returns *this -= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator-=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            m_val = P::sub(m_val, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator-=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this *= rhs. If this operation would
+        ///     overflow, underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to multiply *this
+        ///   @return Returns *this *= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator*=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            m_val = P::mul(m_val, rhs.m_val);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator*=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this *= rhs. If this operation would
+        ///     overflow, underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to multiply *this
+        ///   @return Returns *this *= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator*=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            m_val = P::mul(m_val, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator*=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this /= rhs. See P::div
+        ///     for the corner cases.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to divide *this
+        ///   @return Returns *this /= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator/=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            m_val = P::div(m_val, rhs.m_val);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator/=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this /= rhs. See P::div
+        ///     for the corner cases.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to divide *this
+        ///   @return Returns *this /= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator/=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            m_val = P::div(m_val, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator/=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this %= rhs. See P::mod
+        ///     for the corner cases.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to mod *this
+        ///   @return Returns *this %= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator%=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            m_val = P::mod(m_val, rhs.m_val);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator%=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this %= rhs. See P::mod
+        ///     for the corner cases.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to mod *this
+        ///   @return Returns *this %= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator%=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            m_val = P::mod(m_val, rhs);
+            return *this;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator%=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this <<= rhs. See P::shl
+        ///     for how large shift amounts are handled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to shift *this
+        ///   @return Returns *this <<= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator<<=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed shift not supported");
+            }
+            else {
+                m_val = P::shl(m_val, rhs.m_val);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator<<=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this <<= rhs. See P::shl
+        ///     for how large shift amounts are handled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to shift *this
+        ///   @return Returns *this <<= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator<<=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed shift not supported");
+            }
+            else {
+                m_val = P::shl(m_val, rhs);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator<<=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this >>= rhs. See P::shr
+        ///     for how large shift amounts are handled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to shift *this
+        ///   @return Returns *this >>= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator>>=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed shift not supported");
+            }
+            else {
+                m_val = P::shr(m_val, rhs.m_val);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator>>=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this >>= rhs. See P::shr
+        ///     for how large shift amounts are handled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to shift *this
+        ///   @return Returns *this >>= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator>>=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed shift not supported");
+            }
+            else {
+                m_val = P::shr(m_val, rhs);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator>>=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this &= rhs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to and *this
+        ///   @return Returns *this &= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator&=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed and not supported");
+            }
+            else {
+                m_val = static_cast<value_type>(m_val & rhs.m_val);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator&=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this &= rhs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to and *this
+        ///   @return Returns *this &= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator&=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed and not supported");
+            }
+            else {
+                m_val = static_cast<value_type>(m_val & rhs);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator&=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this |= rhs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to or *this
+        ///   @return Returns *this |= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator|=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed or not supported");
+            }
+            else {
+                m_val = static_cast<value_type>(m_val | rhs.m_val);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator|=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this |= rhs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to or *this
+        ///   @return Returns *this |= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator|=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed or not supported");
+            }
+            else {
+                m_val = static_cast<value_type>(m_val | rhs);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator|=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this ^= rhs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs the value to xor *this
+        ///   @return Returns *this ^= rhs.
+        ///
+        [[maybe_unused]] constexpr auto
+        operator^=(policy_integral<value_type, P> const &rhs) &noexcept
+            -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed xor not supported");
+            }
+            else {
+                m_val = static_cast<value_type>(m_val ^ rhs.m_val);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto
+        operator^=(policy_integral<value_type, P> const &rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns *this ^= rhs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param rhs the value to xor *this
+        ///   @return Returns *this ^= rhs.
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto
+        operator^=(U const rhs) &noexcept -> policy_integral<value_type, P> &
+        {
+            if constexpr (is_signed<value_type>::value) {
+                static_assert(always_false<value_type>(), "signed xor not supported");
+            }
+            else {
+                m_val = static_cast<value_type>(m_val ^ rhs);
+                return *this;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U n/a
+        ///   @param rhs n/a
+        ///   @return n/a
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        [[maybe_unused]] constexpr auto operator^=(U const rhs) const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns ++(*this). If this operation would overflow,
+        ///     underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns ++(*this).
+        ///
+        [[maybe_unused]] constexpr auto
+        operator++() &noexcept -> policy_integral<value_type, P> &
+        {
+            constexpr value_type one{static_cast<value_type>(1)};
+            return *this += one;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto operator++() const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns --(*this). If this operation would overflow,
+        ///     underflow or wrap, P decides the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns --(*this).
+        ///
+        [[maybe_unused]] constexpr auto
+        operator--() &noexcept -> policy_integral<value_type, P> &
+        {
+            constexpr value_type one{static_cast<value_type>(1)};
+            return *this -= one;
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return n/a
+        ///
+        [[maybe_unused]] constexpr auto operator--() const &&noexcept
+            -> policy_integral<value_type, P> & = delete;
+    };
+
+    // -------------------------------------------------------------------------
+    // policy_integral rational operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator==(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) == static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) == static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() == rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() == rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator==(policy_integral<T, P> const &lhs, T const rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) == static_cast<bsl::intmax>(rhs);
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) == static_cast<bsl::uintmax>(rhs);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs == rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs == rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator==(T const lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs) == static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs) == static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() != rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() != rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator!=(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() != rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() != rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator!=(policy_integral<T, P> const &lhs, T const rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs != rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs != rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator!=(T const lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() < rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() < rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) < static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) < static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() < rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() < rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<(policy_integral<T, P> const &lhs, T const rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) < static_cast<bsl::intmax>(rhs);
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) < static_cast<bsl::uintmax>(rhs);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs < rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs < rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<(T const lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs) < static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs) < static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() > rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() > rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) > static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) > static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() > rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() > rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>(policy_integral<T, P> const &lhs, T const rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) > static_cast<bsl::intmax>(rhs);
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) > static_cast<bsl::uintmax>(rhs);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs > rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs > rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>(T const lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs) > static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs) > static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() <= rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() <= rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<=(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) <= static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) <= static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() <= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() <= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<=(policy_integral<T, P> const &lhs, T const rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) <= static_cast<bsl::intmax>(rhs);
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) <= static_cast<bsl::uintmax>(rhs);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs <= rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs <= rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<=(T const lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs) <= static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs) <= static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() >= rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() >= rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>=(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) >= static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) >= static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs.get() >= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs.get() >= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>=(policy_integral<T, P> const &lhs, T const rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs.get()) >= static_cast<bsl::intmax>(rhs);
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs.get()) >= static_cast<bsl::uintmax>(rhs);
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs >= rhs.get()
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs >= rhs.get()
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>=(T const lhs, policy_integral<T, P> const &rhs) noexcept -> bool
+    {
+        if constexpr (is_signed<T>::value) {
+            return static_cast<bsl::intmax>(lhs) >= static_cast<bsl::intmax>(rhs.get());
+        }
+        else {
+            return static_cast<bsl::uintmax>(lhs) >= static_cast<bsl::uintmax>(rhs.get());
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // arithmetic operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} += rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} += rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator+(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp += rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs + policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs + policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator+(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs + policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} + rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} + rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator+(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} + rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} -= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} -= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator-(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp -= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs - policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs - policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator-(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs - policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} - rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} - rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator-(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} - rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} *= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} *= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator*(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp *= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs * policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs * policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator*(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs * policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} * rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} * rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator*(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} * rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} /= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} /= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator/(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp /= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs / policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs / policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator/(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs / policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} / rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} / rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator/(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} / rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} %= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} %= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator%(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp %= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs % policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs % policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator%(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs % policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} % rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} % rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator%(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} % rhs;
+    }
+
+    // -------------------------------------------------------------------------
+    // shift operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} <<= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} <<= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<<(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp <<= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs << policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs << policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<<(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs << policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} << rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} << rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator<<(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} << rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} >>= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} >>= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>>(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp >>= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs >> policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs >> policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>>(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs >> policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} >> rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} >> rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator>>(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} >> rhs;
+    }
+
+    // -------------------------------------------------------------------------
+    // bitwise operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} &= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} &= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator&(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp &= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs & policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs & policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator&(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs & policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} & rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} & rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator&(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} & rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} |= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} |= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator|(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp |= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs | policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs | policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator|(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs | policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} | rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} | rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator|(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} | rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} ^= rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} ^= rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator^(policy_integral<T, P> const &lhs, policy_integral<T, P> const &rhs) noexcept
+        -> policy_integral<T, P>
+    {
+        policy_integral<T, P> mut_tmp{lhs};
+        return mut_tmp ^= rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs ^ policy_integral<T, P>{rhs}
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns lhs ^ policy_integral<T, P>{rhs}
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator^(policy_integral<T, P> const &lhs, T const rhs) noexcept -> policy_integral<T, P>
+    {
+        return lhs ^ policy_integral<T, P>{rhs};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns policy_integral<T, P>{lhs} ^ rhs
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param lhs the left hand side of the operator
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns policy_integral<T, P>{lhs} ^ rhs
+    ///
+    template<typename T, typename P>
+    [[nodiscard]] constexpr auto
+    operator^(T const lhs, policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>{lhs} ^ rhs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns ~rhs.
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns ~rhs.
+    ///
+    template<typename T, typename P, enable_if_t<is_unsigned<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    operator~(policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        return policy_integral<T, P>::max() ^ rhs;
+    }
+
+    // -------------------------------------------------------------------------
+    // unary operators
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns -rhs. Note that P decides the result of -min().
+    ///   @related bsl::policy_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to encapsulate.
+    ///   @tparam P the policy that implements the arithmetic
+    ///   @param rhs the right hand side of the operator
+    ///   @return Returns -rhs.
+    ///
+    template<typename T, typename P, enable_if_t<is_signed<T>::value, bool> = true>
+    [[nodiscard]] constexpr auto
+    operator-(policy_integral<T, P> const &rhs) noexcept -> policy_integral<T, P>
+    {
+        constexpr policy_integral<T, P> zero{static_cast<T>(0)};
+        return zero - rhs;
+    }
+}
+
+#endif
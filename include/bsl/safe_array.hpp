@@ -0,0 +1,289 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file safe_array.hpp
+///
+
+#ifndef BSL_SAFE_ARRAY_HPP
+#define BSL_SAFE_ARRAY_HPP
+
+#include "array.hpp"
+#include "cstdint.hpp"
+#include "is_integral.hpp"
+#include "likely.hpp"
+#include "safe_integral.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief stores the total number of error bits in each error word
+        constexpr bsl::uintmax SAFE_ARRAY_BITS_PER_WORD{static_cast<bsl::uintmax>(64)};
+        /// @brief stores the shift needed to convert an index to an error word
+        constexpr bsl::uintmax SAFE_ARRAY_WORD_SHIFT{static_cast<bsl::uintmax>(6)};
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of error words needed to store
+        ///     one error bit for each of the N elements of a safe_array.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam N the total number of elements in the safe_array
+        ///   @return Returns the total number of error words needed
+        ///
+        template<bsl::uintmax N>
+        [[nodiscard]] constexpr auto
+        safe_array_words() noexcept -> bsl::uintmax
+        {
+            constexpr bsl::uintmax one{static_cast<bsl::uintmax>(1)};
+
+            // NOLINTNEXTLINE(bsl-types-fixed-width-ints-arithmetic-check)
+            return ((N - one) >> SAFE_ARRAY_WORD_SHIFT) + one;
+        }
+    }
+
+    /// @class bsl::safe_array
+    ///
+    /// <!-- description -->
+    ///   @brief Provides a storage dense array of bsl::safe_integral<T>.
+    ///     A bsl::safe_integral<T> stores a bool next to its value, which
+    ///     (after padding) makes a bsl::array<bsl::safe_uint64, N> twice
+    ///     the size of the values it stores. A bsl::safe_array<T, N>
+    ///     instead stores the raw values contiguously, and the error
+    ///     flags in a separate bitmap (one bit per element), so that
+    ///     tables of counters and indexes use (almost) no more cache than
+    ///     the raw values do. Since an element is not stored as a
+    ///     bsl::safe_integral<T>, elements are accessed using at(), which
+    ///     returns a bsl::safe_integral<T> that is built from the value
+    ///     and its error bit, and are changed using set().
+    ///   @include example_safe_array_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type of element being stored.
+    ///   @tparam N the total number of elements in the array. Cannot be 0
+    ///
+    template<typename T, bsl::uintmax N>
+    class safe_array final
+    {
+        static_assert(bsl::is_integral<T>::value, "only integral types are supported");
+        static_assert(static_cast<bsl::uintmax>(0) != N, "arrays of size 0 are not supported");
+
+        /// @brief stores the raw values
+        array<T, N> m_data;
+        /// @brief stores one error bit for each value
+        array<bsl::uintmax, details::safe_array_words<N>()> m_errors;
+
+        /// <!-- description -->
+        ///   @brief Returns the mask of the error bit of the element at
+        ///     index "index" within its error word.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element
+        ///   @return Returns the mask of the error bit
+        ///
+        [[nodiscard]] static constexpr auto
+        error_mask(safe_uintmax const &index) noexcept -> safe_uintmax
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            constexpr safe_uintmax mask{details::SAFE_ARRAY_BITS_PER_WORD - one.get()};
+
+            return one << (index & mask);
+        }
+
+    public:
+        /// @brief alias for: safe_integral<T>
+        using value_type = safe_integral<T>;
+        /// @brief alias for: safe_uintmax
+        using size_type = safe_uintmax;
+        /// @brief alias for: T *
+        using pointer_type = T *;
+        /// @brief alias for: T const *
+        using const_pointer_type = T const *;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::safe_array where every element is set
+        ///     to a valid 0.
+        ///
+        constexpr safe_array() noexcept    // --
+            : m_data{}, m_errors{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Returns the element stored at index "index" as a
+        ///     bsl::safe_integral<T>, which is marked invalid if the
+        ///     element is invalid. If the index is out of bounds, or the
+        ///     index is invalid, bsl::safe_integral<T>::failure() is
+        ///     returned.
+        ///   @include example_safe_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to return
+        ///   @return Returns the element stored at index "index"
+        ///
+        [[nodiscard]] constexpr auto
+        at(size_type const &index) const noexcept -> value_type
+        {
+            if (unlikely(!index)) {
+                unlikely_invalid_argument_failure();
+                return value_type::failure();
+            }
+
+            if (unlikely(!(index < N))) {
+                return value_type::failure();
+            }
+
+            auto const word{*m_errors.at_if(index >> details::SAFE_ARRAY_WORD_SHIFT)};
+            return value_type{*m_data.at_if(index), (word & error_mask(index)).is_pos()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the element stored at index "index" to the
+        ///     provided value. If the value is invalid, so is the element
+        ///     (and its raw value is set to 0).
+        ///     If the index is out of bounds, or the index is invalid,
+        ///     nothing is stored and false is returned.
+        ///   @include example_safe_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the index of the element to set
+        ///   @param val the value to set the element to
+        ///   @return Returns true if the element was set, false otherwise
+        ///
+        [[maybe_unused]] constexpr auto
+        set(size_type const &index, value_type const &val) noexcept -> bool
+        {
+            if (unlikely(!index)) {
+                unlikely_invalid_argument_failure();
+                return false;
+            }
+
+            if (unlikely(!(index < N))) {
+                return false;
+            }
+
+            auto *const pmut_word{m_errors.at_if(index >> details::SAFE_ARRAY_WORD_SHIFT)};
+            if (likely(!val.invalid())) {
+                *pmut_word = (safe_uintmax{*pmut_word} & ~error_mask(index)).get();
+                *m_data.at_if(index) = val.get();
+            }
+            else {
+                *pmut_word = (safe_uintmax{*pmut_word} | error_mask(index)).get();
+                *m_data.at_if(index) = {};
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if any of the elements in the array are
+        ///     invalid. Since the error bits are stored together, this
+        ///     only has to check one word for every 64 elements.
+        ///   @include example_safe_array_overview.hpp
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if any of the elements in the array are
+        ///     invalid.
+        ///
+        [[nodiscard]] constexpr auto
+        invalid() const noexcept -> bool
+        {
+            for (safe_uintmax mut_i{}; mut_i < m_errors.size(); ++mut_i) {
+                if (static_cast<bsl::uintmax>(0) != *m_errors.at_if(mut_i)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the raw values stored in the
+        ///     array. Note that the error bits are not included, and
+        ///     changing an element using this pointer does not change
+        ///     whether or not the element is valid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the raw values stored in the
+        ///     array.
+        ///
+        [[nodiscard]] constexpr auto
+        data() &noexcept -> pointer_type
+        {
+            return m_data.data();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the raw values stored in the
+        ///     array. Note that the error bits are not included.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the raw values stored in the
+        ///     array.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const &noexcept -> const_pointer_type
+        {
+            return m_data.data();
+        }
+
+        /// <!-- description -->
+        ///   @brief The r-value version of this function is not supported
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return n/a
+        ///
+        [[nodiscard]] constexpr auto data() const &&noexcept -> const_pointer_type = delete;
+
+        /// <!-- description -->
+        ///   @brief Returns the number of elements in the array.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of elements in the array.
+        ///
+        [[nodiscard]] static constexpr auto
+        size() noexcept -> size_type
+        {
+            constexpr safe_uintmax n{static_cast<bsl::uintmax>(N)};
+            return n;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes used to store the
+        ///     raw values, not including the error bits.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns size() * sizeof(T)
+        ///
+        [[nodiscard]] static constexpr auto
+        size_bytes() noexcept -> size_type
+        {
+            return array<T, N>::size_bytes();
+        }
+    };
+}
+
+#endif
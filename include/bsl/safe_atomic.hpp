@@ -0,0 +1,347 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file safe_atomic.hpp
+///
+
+#ifndef BSL_SAFE_ATOMIC_HPP
+#define BSL_SAFE_ATOMIC_HPP
+
+#include "atomic.hpp"
+#include "enable_if.hpp"
+#include "is_same.hpp"
+#include "memory_order.hpp"
+#include "safe_integral.hpp"
+#include "touch.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::safe_atomic
+    ///
+    /// <!-- description -->
+    ///   @brief Provides a bsl::atomic whose arithmetic is checked the
+    ///     same way bsl::safe_integral's is. fetch_add and fetch_sub use
+    ///     a compare and exchange loop, so if the result would overflow,
+    ///     underflow or wrap, the stored value is left unchanged, the
+    ///     error is reported and bsl::safe_integral<T>::failure() is
+    ///     returned. Values are loaded and stored as bsl::safe_integral,
+    ///     and an invalid bsl::safe_integral is never stored.
+    ///   @include example_safe_atomic_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the type of integral to store
+    ///
+    template<typename T>
+    class safe_atomic final
+    {
+        static_assert(!is_same<T, bool>::value, "bool is not supported");
+
+        /// @brief stores the value being accessed atomically
+        atomic<T> m_val;
+
+        /// <!-- description -->
+        ///   @brief Returns val.get(), or 0 if val is invalid, in which
+        ///     case this is reported as an invalid argument.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to get
+        ///   @return Returns val.get(), or 0 if val is invalid
+        ///
+        [[nodiscard]] static constexpr auto
+        get_or_zero(safe_integral<T> const &val) noexcept -> T
+        {
+            if (unlikely(val.invalid())) {
+                unlikely_invalid_argument_failure();
+                return {};
+            }
+
+            return val.get();
+        }
+
+    public:
+        /// @brief alias for: T
+        using value_type = T;
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::safe_atomic that stores 0
+        ///
+        constexpr safe_atomic() noexcept    // --
+            : m_val{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::safe_atomic given a BSL fixed width
+        ///     type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam U Used to ensure the provided integer is the same as
+        ///     T, effectively preventing implicit conversions from being
+        ///     allowed.
+        ///   @param val the value to store
+        ///
+        template<typename U, enable_if_t<is_same<T, U>::value, bool> = true>
+        explicit constexpr safe_atomic(U const val) noexcept    // --
+            : m_val{val}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Creates a bsl::safe_atomic given a bsl::safe_integral.
+        ///     If val is invalid, this is reported as an invalid argument
+        ///     and the bsl::safe_atomic stores 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to store
+        ///
+        explicit constexpr safe_atomic(safe_integral<T> const &val) noexcept    // --
+            : m_val{get_or_zero(val)}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created bsl::safe_atomic
+        ///
+        constexpr ~safe_atomic() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr safe_atomic(safe_atomic const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr safe_atomic(safe_atomic &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(safe_atomic const &o) &noexcept
+            -> safe_atomic & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(safe_atomic &&mut_o) &noexcept
+            -> safe_atomic & = delete;
+
+        /// <!-- description -->
+        ///   @brief Atomically returns the stored value.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the memory order to use. Cannot be release or
+        ///     acq_rel.
+        ///   @return Returns the stored value
+        ///
+        [[nodiscard]] auto
+        load(memory_order const order = memory_order::seq_cst) const noexcept
+            -> safe_integral<value_type>
+        {
+            return safe_integral<value_type>{m_val.load(order)};
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically replaces the stored value with val. If val
+        ///     is invalid, this is reported as an invalid argument and the
+        ///     stored value is left unchanged.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to store
+        ///   @param order the memory order to use. Cannot be consume,
+        ///     acquire or acq_rel.
+        ///
+        void
+        store(
+            safe_integral<value_type> const &val,
+            memory_order const order = memory_order::seq_cst) noexcept
+        {
+            if (unlikely(val.invalid())) {
+                unlikely_invalid_argument_failure();
+                return;
+            }
+
+            m_val.store(val.get(), order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically replaces the stored value with val and
+        ///     returns the value that was previously stored. If val is
+        ///     invalid, this is reported as an invalid argument, the stored
+        ///     value is left unchanged and
+        ///     bsl::safe_integral<T>::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to store
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        exchange(
+            safe_integral<value_type> const &val,
+            memory_order const order = memory_order::seq_cst) noexcept
+            -> safe_integral<value_type>
+        {
+            if (unlikely(val.invalid())) {
+                unlikely_invalid_argument_failure();
+                return safe_integral<value_type>::failure();
+            }
+
+            return safe_integral<value_type>{m_val.exchange(val.get(), order)};
+        }
+
+        /// <!-- description -->
+        ///   @brief If the stored value is equal to mut_expected, it is
+        ///     replaced with desired and true is returned. Otherwise,
+        ///     mut_expected is set to the stored value and false is
+        ///     returned. If mut_expected or desired are invalid, this is
+        ///     reported as an invalid argument, the stored value is left
+        ///     unchanged and false is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_expected the value expected to be stored
+        ///   @param desired the value to store if mut_expected matches
+        ///   @param order the memory order to use
+        ///   @return Returns true if the exchange occurred
+        ///
+        [[nodiscard]] auto
+        compare_exchange_strong(
+            safe_integral<value_type> &mut_expected,
+            safe_integral<value_type> const &desired,
+            memory_order const order = memory_order::seq_cst) noexcept -> bool
+        {
+            if (unlikely(mut_expected.invalid())) {
+                unlikely_invalid_argument_failure();
+                return false;
+            }
+
+            if (unlikely(desired.invalid())) {
+                unlikely_invalid_argument_failure();
+                return false;
+            }
+
+            value_type mut_raw{mut_expected.get()};
+            bool const ret{m_val.compare_exchange_strong(mut_raw, desired.get(), order)};
+
+            mut_expected = safe_integral<value_type>{mut_raw};
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically adds val to the stored value and
+        ///     returns the value that was previously stored. If val is
+        ///     invalid, this is reported as an invalid argument. If the
+        ///     result would overflow, underflow or wrap, this is reported
+        ///     the same way bsl::safe_integral reports it. In both cases,
+        ///     the stored value is left unchanged and
+        ///     bsl::safe_integral<T>::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to add to the stored value
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        fetch_add(
+            safe_integral<value_type> const &val,
+            memory_order const order = memory_order::seq_cst) noexcept
+            -> safe_integral<value_type>
+        {
+            if (unlikely(val.invalid())) {
+                unlikely_invalid_argument_failure();
+                return safe_integral<value_type>::failure();
+            }
+
+            value_type mut_old{m_val.load(memory_order::relaxed)};
+            while (true) {
+                value_type mut_new{};
+                if (unlikely(builtin_add_overflow(mut_old, val.get(), &mut_new))) {
+                    integral_overflow_underflow_wrap_error();
+                    return safe_integral<value_type>::failure();
+                }
+
+                if (m_val.compare_exchange_weak(mut_old, mut_new, order, memory_order::relaxed)) {
+                    return safe_integral<value_type>{mut_old};
+                }
+
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically subtracts val from the stored value and
+        ///     returns the value that was previously stored. If val is
+        ///     invalid, this is reported as an invalid argument. If the
+        ///     result would overflow, underflow or wrap, this is reported
+        ///     the same way bsl::safe_integral reports it. In both cases,
+        ///     the stored value is left unchanged and
+        ///     bsl::safe_integral<T>::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to subtract from the stored value
+        ///   @param order the memory order to use
+        ///   @return Returns the value that was previously stored
+        ///
+        [[maybe_unused]] auto
+        fetch_sub(
+            safe_integral<value_type> const &val,
+            memory_order const order = memory_order::seq_cst) noexcept
+            -> safe_integral<value_type>
+        {
+            if (unlikely(val.invalid())) {
+                unlikely_invalid_argument_failure();
+                return safe_integral<value_type>::failure();
+            }
+
+            value_type mut_old{m_val.load(memory_order::relaxed)};
+            while (true) {
+                value_type mut_new{};
+                if (unlikely(builtin_sub_overflow(mut_old, val.get(), &mut_new))) {
+                    integral_overflow_underflow_wrap_error();
+                    return safe_integral<value_type>::failure();
+                }
+
+                if (m_val.compare_exchange_weak(mut_old, mut_new, order, memory_order::relaxed)) {
+                    return safe_integral<value_type>{mut_old};
+                }
+
+                bsl::touch();
+            }
+        }
+    };
+}
+
+#endif
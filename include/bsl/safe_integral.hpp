@@ -29,6 +29,7 @@
 #define BSL_SAFE_INTEGRAL_HPP
 
 #include "always_false.hpp"
+#include "conditional.hpp"
 #include "cstdint.hpp"
 #include "enable_if.hpp"
 #include "is_constant_evaluated.hpp"
@@ -42,6 +43,21 @@
 
 namespace bsl
 {
+    namespace details
+    {
+        /// @brief defines the signed type used to compare and divide a T,
+        ///   which is bsl::intmax unless T is larger (i.e., bsl::int128).
+        template<typename T>
+        using safe_integral_smax_t =
+            conditional_t<(sizeof(T) > sizeof(bsl::intmax)), bsl::int128, bsl::intmax>;
+
+        /// @brief defines the unsigned type used to compare and divide a T,
+        ///   which is bsl::uintmax unless T is larger (i.e., bsl::uint128).
+        template<typename T>
+        using safe_integral_umax_t =
+            conditional_t<(sizeof(T) > sizeof(bsl::uintmax)), bsl::uint128, bsl::uintmax>;
+    }
+
     /// <!-- description -->
     ///   @brief Used to tell the user during compile-time that an
     ///     error has occurred during an add, sub or mul operation
@@ -151,17 +167,19 @@ namespace bsl
     [[nodiscard]] constexpr auto
     builtin_div_overflow(T const lhs, T const rhs, T *const pmut_cst_res) noexcept -> bool
     {
-        constexpr bsl::intmax neg_one{static_cast<bsl::intmax>(-1)};
+        constexpr details::safe_integral_smax_t<T> neg_one{
+            static_cast<details::safe_integral_smax_t<T>>(-1)};
 
-        if (unlikely(static_cast<bsl::uintmax>(T{}) == static_cast<bsl::uintmax>(rhs))) {
+        if (unlikely(static_cast<details::safe_integral_umax_t<T>>(T{}) ==
+                     static_cast<details::safe_integral_umax_t<T>>(rhs))) {
             integral_overflow_underflow_wrap_error();
             return true;
         }
 
         if constexpr (is_signed<T>::value) {
-            if (static_cast<bsl::intmax>(numeric_limits<T>::min()) ==
-                static_cast<bsl::intmax>(lhs)) {
-                if (unlikely(neg_one == static_cast<bsl::intmax>(rhs))) {
+            if (static_cast<details::safe_integral_smax_t<T>>(numeric_limits<T>::min()) ==
+                static_cast<details::safe_integral_smax_t<T>>(lhs)) {
+                if (unlikely(neg_one == static_cast<details::safe_integral_smax_t<T>>(rhs))) {
                     integral_overflow_underflow_wrap_error();
                     return true;
                 }
@@ -174,12 +192,14 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            *pmut_cst_res =
-                static_cast<T>(static_cast<bsl::intmax>(lhs) / static_cast<bsl::intmax>(rhs));
+            *pmut_cst_res = static_cast<T>(
+                static_cast<details::safe_integral_smax_t<T>>(lhs) /
+                static_cast<details::safe_integral_smax_t<T>>(rhs));
         }
         else {
-            *pmut_cst_res =
-                static_cast<T>(static_cast<bsl::uintmax>(lhs) / static_cast<bsl::uintmax>(rhs));
+            *pmut_cst_res = static_cast<T>(
+                static_cast<details::safe_integral_umax_t<T>>(lhs) /
+                static_cast<details::safe_integral_umax_t<T>>(rhs));
         }
 
         return false;
@@ -201,17 +221,19 @@ namespace bsl
     [[nodiscard]] constexpr auto
     builtin_mod_overflow(T const lhs, T const rhs, T *const pmut_cst_res) noexcept -> bool
     {
-        constexpr bsl::intmax neg_one{static_cast<bsl::intmax>(-1)};
+        constexpr details::safe_integral_smax_t<T> neg_one{
+            static_cast<details::safe_integral_smax_t<T>>(-1)};
 
-        if (unlikely(static_cast<bsl::uintmax>(T{}) == static_cast<bsl::uintmax>(rhs))) {
+        if (unlikely(static_cast<details::safe_integral_umax_t<T>>(T{}) ==
+                     static_cast<details::safe_integral_umax_t<T>>(rhs))) {
             integral_overflow_underflow_wrap_error();
             return true;
         }
 
         if constexpr (is_signed<T>::value) {
-            if (static_cast<bsl::intmax>(numeric_limits<T>::min()) ==
-                static_cast<bsl::intmax>(lhs)) {
-                if (unlikely(neg_one == static_cast<bsl::intmax>(rhs))) {
+            if (static_cast<details::safe_integral_smax_t<T>>(numeric_limits<T>::min()) ==
+                static_cast<details::safe_integral_smax_t<T>>(lhs)) {
+                if (unlikely(neg_one == static_cast<details::safe_integral_smax_t<T>>(rhs))) {
                     integral_overflow_underflow_wrap_error();
                     return true;
                 }
@@ -224,12 +246,14 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            *pmut_cst_res =
-                static_cast<T>(static_cast<bsl::intmax>(lhs) % static_cast<bsl::intmax>(rhs));
+            *pmut_cst_res = static_cast<T>(
+                static_cast<details::safe_integral_smax_t<T>>(lhs) %
+                static_cast<details::safe_integral_smax_t<T>>(rhs));
         }
         else {
-            *pmut_cst_res =
-                static_cast<T>(static_cast<bsl::uintmax>(lhs) % static_cast<bsl::uintmax>(rhs));
+            *pmut_cst_res = static_cast<T>(
+                static_cast<details::safe_integral_umax_t<T>>(lhs) %
+                static_cast<details::safe_integral_umax_t<T>>(rhs));
         }
 
         return false;
@@ -519,14 +543,16 @@ namespace bsl
             }
 
             if constexpr (is_signed<T>::value) {
-                if (static_cast<bsl::intmax>(m_val) < static_cast<bsl::intmax>(other.m_val)) {
+                if (static_cast<details::safe_integral_smax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_smax_t<T>>(other.m_val)) {
                     return other;
                 }
 
                 return *this;
             }
             else {
-                if (static_cast<bsl::uintmax>(m_val) < static_cast<bsl::uintmax>(other.m_val)) {
+                if (static_cast<details::safe_integral_umax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_umax_t<T>>(other.m_val)) {
                     return other;
                 }
 
@@ -559,14 +585,16 @@ namespace bsl
             }
 
             if constexpr (is_signed<T>::value) {
-                if (static_cast<bsl::intmax>(m_val) < static_cast<bsl::intmax>(other)) {
+                if (static_cast<details::safe_integral_smax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_smax_t<T>>(other)) {
                     return safe_integral<value_type>{other};
                 }
 
                 return *this;
             }
             else {
-                if (static_cast<bsl::uintmax>(m_val) < static_cast<bsl::uintmax>(other)) {
+                if (static_cast<details::safe_integral_umax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_umax_t<T>>(other)) {
                     return safe_integral<value_type>{other};
                 }
 
@@ -613,14 +641,16 @@ namespace bsl
             }
 
             if constexpr (is_signed<T>::value) {
-                if (static_cast<bsl::intmax>(m_val) < static_cast<bsl::intmax>(other.m_val)) {
+                if (static_cast<details::safe_integral_smax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_smax_t<T>>(other.m_val)) {
                     return *this;
                 }
 
                 return other;
             }
             else {
-                if (static_cast<bsl::uintmax>(m_val) < static_cast<bsl::uintmax>(other.m_val)) {
+                if (static_cast<details::safe_integral_umax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_umax_t<T>>(other.m_val)) {
                     return *this;
                 }
 
@@ -653,14 +683,16 @@ namespace bsl
             }
 
             if constexpr (is_signed<T>::value) {
-                if (static_cast<bsl::intmax>(m_val) < static_cast<bsl::intmax>(other)) {
+                if (static_cast<details::safe_integral_smax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_smax_t<T>>(other)) {
                     return *this;
                 }
 
                 return safe_integral<value_type>{other};
             }
             else {
-                if (static_cast<bsl::uintmax>(m_val) < static_cast<bsl::uintmax>(other)) {
+                if (static_cast<details::safe_integral_umax_t<T>>(m_val) <
+                    static_cast<details::safe_integral_umax_t<T>>(other)) {
                     return *this;
                 }
 
@@ -1809,10 +1841,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) == static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) ==
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) == static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) ==
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -1839,10 +1873,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) == static_cast<bsl::intmax>(rhs);
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) ==
+                   static_cast<details::safe_integral_smax_t<T>>(rhs);
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) == static_cast<bsl::uintmax>(rhs);
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) ==
+                   static_cast<details::safe_integral_umax_t<T>>(rhs);
         }
     }
 
@@ -1869,10 +1905,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs) == static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs) ==
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs) == static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs) ==
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -1964,10 +2002,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) < static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) <
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) < static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) <
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -1994,10 +2034,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) < static_cast<bsl::intmax>(rhs);
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) <
+                   static_cast<details::safe_integral_smax_t<T>>(rhs);
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) < static_cast<bsl::uintmax>(rhs);
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) <
+                   static_cast<details::safe_integral_umax_t<T>>(rhs);
         }
     }
 
@@ -2024,10 +2066,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs) < static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs) <
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs) < static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs) <
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -2059,10 +2103,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) > static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) >
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) > static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) >
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -2089,10 +2135,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) > static_cast<bsl::intmax>(rhs);
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) >
+                   static_cast<details::safe_integral_smax_t<T>>(rhs);
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) > static_cast<bsl::uintmax>(rhs);
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) >
+                   static_cast<details::safe_integral_umax_t<T>>(rhs);
         }
     }
 
@@ -2119,10 +2167,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs) > static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs) >
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs) > static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs) >
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -2154,10 +2204,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) <= static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) <=
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) <= static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) <=
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -2184,10 +2236,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) <= static_cast<bsl::intmax>(rhs);
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) <=
+                   static_cast<details::safe_integral_smax_t<T>>(rhs);
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) <= static_cast<bsl::uintmax>(rhs);
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) <=
+                   static_cast<details::safe_integral_umax_t<T>>(rhs);
         }
     }
 
@@ -2214,10 +2268,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs) <= static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs) <=
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs) <= static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs) <=
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -2249,10 +2305,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) >= static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) >=
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) >= static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) >=
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -2279,10 +2337,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs.get()) >= static_cast<bsl::intmax>(rhs);
+            return static_cast<details::safe_integral_smax_t<T>>(lhs.get()) >=
+                   static_cast<details::safe_integral_smax_t<T>>(rhs);
         }
         else {
-            return static_cast<bsl::uintmax>(lhs.get()) >= static_cast<bsl::uintmax>(rhs);
+            return static_cast<details::safe_integral_umax_t<T>>(lhs.get()) >=
+                   static_cast<details::safe_integral_umax_t<T>>(rhs);
         }
     }
 
@@ -2309,10 +2369,12 @@ namespace bsl
         }
 
         if constexpr (is_signed<T>::value) {
-            return static_cast<bsl::intmax>(lhs) >= static_cast<bsl::intmax>(rhs.get());
+            return static_cast<details::safe_integral_smax_t<T>>(lhs) >=
+                   static_cast<details::safe_integral_smax_t<T>>(rhs.get());
         }
         else {
-            return static_cast<bsl::uintmax>(lhs) >= static_cast<bsl::uintmax>(rhs.get());
+            return static_cast<details::safe_integral_umax_t<T>>(lhs) >=
+                   static_cast<details::safe_integral_umax_t<T>>(rhs.get());
         }
     }
 
@@ -2952,6 +3014,8 @@ namespace bsl
     using safe_int32 = safe_integral<bsl::int32>;
     /// @brief provides the bsl::safe_integral version of bsl::int64
     using safe_int64 = safe_integral<bsl::int64>;
+    /// @brief provides the bsl::safe_integral version of bsl::int128
+    using safe_int128 = safe_integral<bsl::int128>;
     /// @brief provides the bsl::safe_integral version of bsl::int_fast8
     using safe_int_fast8 = safe_integral<bsl::int_fast8>;
     /// @brief provides the bsl::safe_integral version of bsl::int_fast16
@@ -2981,6 +3045,8 @@ namespace bsl
     using safe_uint32 = safe_integral<bsl::uint32>;
     /// @brief provides the bsl::safe_integral version of bsl::uint64
     using safe_uint64 = safe_integral<bsl::uint64>;
+    /// @brief provides the bsl::safe_integral version of bsl::uint128
+    using safe_uint128 = safe_integral<bsl::uint128>;
     /// @brief provides the bsl::safe_integral version of bsl::uint_fast8
     using safe_uint_fast8 = safe_integral<bsl::uint_fast8>;
     /// @brief provides the bsl::safe_integral version of bsl::uint_fast16
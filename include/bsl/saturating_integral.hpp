@@ -0,0 +1,107 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file saturating_integral.hpp
+///
+
+#ifndef BSL_SATURATING_INTEGRAL_HPP
+#define BSL_SATURATING_INTEGRAL_HPP
+
+#include "cstdint.hpp"
+#include "details/saturating_policy.hpp"
+#include "policy_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::saturating_integral
+    ///
+    /// <!-- description -->
+    ///   @brief Provides an integral type whose arithmetic clamps to
+    ///     numeric_limits<T>::min() and numeric_limits<T>::max() instead of
+    ///     overflowing. Unlike a bsl::safe_integral, a bsl::saturating_integral
+    ///     has no error state, so it never has to be checked and is well
+    ///     suited for statistics counters and other values that must never
+    ///     fail. The saturating operators are implemented using the
+    ///     compiler's overflow builtins and a branch-free select of the
+    ///     limit, so they compile down to a conditional move.
+    ///   @include example_saturating_integral_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type to encapsulate.
+    ///
+    template<typename T>
+    using saturating_integral = policy_integral<T, details::saturating_policy>;
+
+    // -------------------------------------------------------------------------
+    // helpers
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns saturating_integral<T>{val}
+    ///   @related bsl::saturating_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to make saturating.
+    ///   @param val the integral to make saturating
+    ///   @return Returns saturating_integral<T>{val}
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    make_saturating(T const &val) noexcept -> saturating_integral<T>
+    {
+        return saturating_integral<T>{val};
+    }
+
+    // -------------------------------------------------------------------------
+    // supported saturating_integral types
+    // -------------------------------------------------------------------------
+
+    /// @brief provides the bsl::saturating_integral version of bsl::int8
+    using saturating_int8 = saturating_integral<bsl::int8>;
+    /// @brief provides the bsl::saturating_integral version of bsl::int16
+    using saturating_int16 = saturating_integral<bsl::int16>;
+    /// @brief provides the bsl::saturating_integral version of bsl::int32
+    using saturating_int32 = saturating_integral<bsl::int32>;
+    /// @brief provides the bsl::saturating_integral version of bsl::int64
+    using saturating_int64 = saturating_integral<bsl::int64>;
+    /// @brief provides the bsl::saturating_integral version of bsl::intmax
+    using saturating_intmax = saturating_integral<bsl::intmax>;
+    /// @brief provides the bsl::saturating_integral version of bsl::intptr
+    using saturating_intptr = saturating_integral<bsl::intptr>;
+
+    /// @brief provides the bsl::saturating_integral version of bsl::uint8
+    using saturating_uint8 = saturating_integral<bsl::uint8>;
+    /// @brief provides the bsl::saturating_integral version of bsl::uint16
+    using saturating_uint16 = saturating_integral<bsl::uint16>;
+    /// @brief provides the bsl::saturating_integral version of bsl::uint32
+    using saturating_uint32 = saturating_integral<bsl::uint32>;
+    /// @brief provides the bsl::saturating_integral version of bsl::uint64
+    using saturating_uint64 = saturating_integral<bsl::uint64>;
+    /// @brief provides the bsl::saturating_integral version of bsl::uintmax
+    using saturating_uintmax = saturating_integral<bsl::uintmax>;
+    /// @brief provides the bsl::saturating_integral version of bsl::uintptr
+    using saturating_uintptr = saturating_integral<bsl::uintptr>;
+}
+
+#endif
@@ -0,0 +1,105 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file trace.hpp
+///
+
+#ifndef BSL_TRACE_HPP
+#define BSL_TRACE_HPP
+
+#include "cstdint.hpp"
+#include "details/trace_arg.hpp"
+#include "safe_integral.hpp"
+#include "trace_buffer.hpp"
+#include "trace_fmt.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Records the provided arguments into the provided
+    ///     bsl::trace_buffer without formatting them. Instead, a compact
+    ///     binary record is written containing the format string's id,
+    ///     the type of each argument and the raw bytes of each argument.
+    ///     The record is turned back into text later (and usually
+    ///     somewhere else) using bsl::trace_decode, which uses the same
+    ///     format options as bsl::fmt. Since the id and the argument types
+    ///     are known at compile-time, recording an integral is only a few
+    ///     stores. Some key points:
+    ///     - Integrals (including bsl::safe_integral), bools, pointers and
+    ///       bsl::string_view are supported. A C-style string must be
+    ///       wrapped in a bsl::string_view, and strings longer than 255
+    ///       characters are truncated.
+    ///     - The number of arguments must match the number of "{}"
+    ///       placeholders in the format string.
+    ///     - If the buffer is full, the record is dropped and counted.
+    ///     - Records are stored in little endian byte order, so they can
+    ///       be decoded on any host.
+    ///   @include example_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the total number of bytes mut_buf can hold
+    ///   @tparam ARGS the types of arguments to record
+    ///   @param mut_buf the bsl::trace_buffer to write the record to
+    ///   @param f the format string that will be used to decode the record
+    ///   @param args the arguments to record
+    ///
+    template<bsl::uintmax N, typename... ARGS>
+    constexpr void
+    trace(trace_buffer<N> &mut_buf, trace_fmt const &f, ARGS const &...args) noexcept
+    {
+        static_assert(sizeof...(ARGS) <= details::TRACE_MAX_NUM_ARGS.get());
+
+        constexpr safe_uintmax num_args{static_cast<bsl::uintmax>(sizeof...(ARGS))};
+        constexpr safe_uintmax hdr_size{details::TRACE_HEADER_SIZE + num_args};
+
+        if (unlikely(f.num_args() != num_args)) {
+            unlikely_invalid_argument_failure();
+            return;
+        }
+
+        safe_uintmax const size{(hdr_size + ... + details::trace_arg_size(args))};
+        if (unlikely(size > details::TRACE_MAX_RECORD_SIZE)) {
+            unlikely_invalid_argument_failure();
+            return;
+        }
+
+        auto *const pmut_rec{mut_buf.reserve(size)};
+        if (unlikely(nullptr == pmut_rec)) {
+            return;
+        }
+
+        details::trace_store(pmut_rec, {}, f.id().get());
+        details::trace_store(
+            pmut_rec, details::TRACE_LEN_OFFSET, static_cast<bsl::uint16>(size.get()));
+        details::trace_store(
+            pmut_rec, details::TRACE_NUM_ARGS_OFFSET, static_cast<bsl::uint8>(num_args.get()));
+
+        safe_uintmax mut_tag{details::TRACE_HEADER_SIZE};
+        safe_uintmax mut_pos{hdr_size};
+        (details::trace_arg_store(pmut_rec, mut_tag, mut_pos, args), ...);
+    }
+}
+
+#endif
@@ -0,0 +1,150 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file trace_buffer.hpp
+///
+
+#ifndef BSL_TRACE_BUFFER_HPP
+#define BSL_TRACE_BUFFER_HPP
+
+#include "array.hpp"
+#include "cstdint.hpp"
+#include "safe_integral.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    /// @class bsl::trace_buffer
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the records written by bsl::trace. Records are
+    ///     appended one after the other until the buffer is full, at which
+    ///     point any additional records are dropped (and counted) until
+    ///     the buffer is cleared. The contents of the buffer (data() and
+    ///     size()) can be copied anywhere (e.g. a shared memory log or a
+    ///     file), and then turned back into text using bsl::trace_decode.
+    ///   @include example_trace_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the total number of bytes the buffer can hold
+    ///
+    template<bsl::uintmax N>
+    class trace_buffer final
+    {
+        /// @brief stores the records
+        array<bsl::uint8, N> m_buf;
+        /// @brief stores the total number of bytes used in m_buf
+        safe_uintmax m_size;
+        /// @brief stores the total number of records that were dropped
+        safe_uintmax m_dropped;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates an empty bsl::trace_buffer
+        ///
+        constexpr trace_buffer() noexcept    // --
+            : m_buf{}, m_size{}, m_dropped{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Reserves the provided number of bytes at the end of
+        ///     the buffer for a record and returns a pointer to them. If
+        ///     there is not enough room left, the record is counted as
+        ///     dropped and a nullptr is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param size the total number of bytes to reserve
+        ///   @return Returns a pointer to the reserved bytes, or a nullptr
+        ///     if there is not enough room left.
+        ///
+        [[nodiscard]] constexpr auto
+        reserve(safe_uintmax const &size) noexcept -> bsl::uint8 *
+        {
+            constexpr safe_uintmax max_size{static_cast<bsl::uintmax>(N)};
+
+            if (unlikely(size > (max_size - m_size))) {
+                ++m_dropped;
+                return nullptr;
+            }
+
+            auto *const pmut_rec{m_buf.at_if(m_size)};
+            m_size += size;
+
+            return pmut_rec;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes all of the records from the buffer and resets
+        ///     the number of dropped records.
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            m_size = static_cast<bsl::uintmax>(0);
+            m_dropped = static_cast<bsl::uintmax>(0);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the records stored in the buffer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns a pointer to the records stored in the buffer.
+        ///
+        [[nodiscard]] constexpr auto
+        data() const noexcept -> bsl::uint8 const *
+        {
+            return m_buf.data();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of bytes used by the records
+        ///     stored in the buffer.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of bytes used by the records
+        ///     stored in the buffer.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> safe_uintmax const &
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of records that were dropped
+        ///     because the buffer was full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of records that were dropped
+        ///     because the buffer was full.
+        ///
+        [[nodiscard]] constexpr auto
+        dropped() const noexcept -> safe_uintmax const &
+        {
+            return m_dropped;
+        }
+    };
+}
+
+#endif
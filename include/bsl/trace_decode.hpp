@@ -0,0 +1,428 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file trace_decode.hpp
+///
+
+#ifndef BSL_TRACE_DECODE_HPP
+#define BSL_TRACE_DECODE_HPP
+
+#include "array.hpp"
+#include "char_type.hpp"
+#include "cstdint.hpp"
+#include "details/out.hpp"
+#include "details/trace_arg.hpp"
+#include "details/trace_tag.hpp"
+#include "fmt.hpp"
+#include "fmt_options.hpp"
+#include "safe_integral.hpp"
+#include "touch.hpp"
+#include "trace_fmt.hpp"
+#include "unlikely.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Outputs the integral stored at mut_pos in the provided
+        ///     record and advances mut_pos.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of integral to output
+        ///   @tparam U the unsigned type the integral was stored as
+        ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+        ///   @param o the instance of out<T> to output to
+        ///   @param ops the fmt options used to format the output
+        ///   @param rec the record to decode
+        ///   @param len the total number of bytes in rec
+        ///   @param mut_pos the index of the integral in rec
+        ///   @param err true if the integral was invalid when it was recorded
+        ///   @return Returns false if the record is too small, true otherwise
+        ///
+        template<typename T, typename U, typename OUT_T>
+        [[nodiscard]] constexpr auto
+        trace_decode_integral(
+            out<OUT_T> const o,
+            fmt_options const &ops,
+            bsl::uint8 const *const rec,
+            safe_uintmax const &len,
+            safe_uintmax &mut_pos,
+            bool const err) noexcept -> bool
+        {
+            constexpr safe_uintmax size{static_cast<bsl::uintmax>(sizeof(T))};
+
+            if (unlikely(size > (len - mut_pos))) {
+                return false;
+            }
+
+            auto const val{static_cast<T>(trace_load<U>(rec, mut_pos))};
+            mut_pos += size;
+
+            if (err) {
+                fmt_impl(o, ops, safe_integral<T>::failure());
+            }
+            else {
+                fmt_impl(o, ops, safe_integral<T>{val});
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the string stored at mut_pos in the provided
+        ///     record and advances mut_pos.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+        ///   @param o the instance of out<T> to output to
+        ///   @param ops the fmt options used to format the output
+        ///   @param rec the record to decode
+        ///   @param len the total number of bytes in rec
+        ///   @param mut_pos the index of the string in rec
+        ///   @return Returns false if the record is too small, true otherwise
+        ///
+        template<typename OUT_T>
+        [[nodiscard]] constexpr auto
+        trace_decode_str(
+            out<OUT_T> const o,
+            fmt_options const &ops,
+            bsl::uint8 const *const rec,
+            safe_uintmax const &len,
+            safe_uintmax &mut_pos) noexcept -> bool
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+
+            if (unlikely(one > (len - mut_pos))) {
+                return false;
+            }
+
+            safe_uintmax const str_len{
+                static_cast<bsl::uintmax>(trace_load<bsl::uint8>(rec, mut_pos))};
+            if (unlikely(str_len > ((len - mut_pos) - one))) {
+                return false;
+            }
+
+            mut_pos += one;
+
+            // The string is not '\0' terminated in the record, so each
+            // character is outputted one at a time.
+            fmt_impl_align_pre(o, ops, str_len, true);
+            for (safe_uintmax mut_i{}; mut_i < str_len; ++mut_i) {
+                o.write_to_console(static_cast<char_type>(trace_load<bsl::uint8>(rec, mut_pos)));
+                ++mut_pos;
+            }
+            fmt_impl_align_suf(o, ops, str_len, true);
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the argument stored at mut_pos in the provided
+        ///     record given its tag, and advances mut_pos.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+        ///   @param o the instance of out<T> to output to
+        ///   @param ops the fmt options used to format the output
+        ///   @param rec the record to decode
+        ///   @param len the total number of bytes in rec
+        ///   @param mut_pos the index of the argument in rec
+        ///   @param tag the argument's tag
+        ///   @return Returns false if the record is too small or the tag is
+        ///     unknown, true otherwise
+        ///
+        template<typename OUT_T>
+        [[nodiscard]] constexpr auto
+        trace_decode_arg(
+            out<OUT_T> const o,
+            fmt_options const &ops,
+            bsl::uint8 const *const rec,
+            safe_uintmax const &len,
+            safe_uintmax &mut_pos,
+            bsl::uint8 const tag) noexcept -> bool
+        {
+            constexpr auto not_error{static_cast<bsl::uint8>(~TRACE_TAG_ERROR)};
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+
+            bool const err{static_cast<bsl::uint8>(0) != (tag & TRACE_TAG_ERROR)};
+            switch (static_cast<trace_tag>(tag & not_error)) {
+                case trace_tag::trace_tag_u8: {
+                    return trace_decode_integral<bsl::uint8, bsl::uint8>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_u16: {
+                    return trace_decode_integral<bsl::uint16, bsl::uint16>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_u32: {
+                    return trace_decode_integral<bsl::uint32, bsl::uint32>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_u64: {
+                    return trace_decode_integral<bsl::uint64, bsl::uint64>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_i8: {
+                    return trace_decode_integral<bsl::int8, bsl::uint8>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_i16: {
+                    return trace_decode_integral<bsl::int16, bsl::uint16>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_i32: {
+                    return trace_decode_integral<bsl::int32, bsl::uint32>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_i64: {
+                    return trace_decode_integral<bsl::int64, bsl::uint64>(
+                        o, ops, rec, len, mut_pos, err);
+                }
+
+                case trace_tag::trace_tag_bool: {
+                    if (unlikely(one > (len - mut_pos))) {
+                        return false;
+                    }
+
+                    auto const raw{trace_load<bsl::uint8>(rec, mut_pos)};
+                    bool const val{static_cast<bsl::uint8>(0) != raw};
+                    fmt_impl(o, ops, val);
+                    mut_pos += one;
+
+                    return true;
+                }
+
+                case trace_tag::trace_tag_ptr: {
+                    if (unlikely(TRACE_PTR_SIZE > (len - mut_pos))) {
+                        return false;
+                    }
+
+                    safe_uintmax const ptr{
+                        static_cast<bsl::uintmax>(trace_load<bsl::uint64>(rec, mut_pos))};
+                    mut_pos += TRACE_PTR_SIZE;
+
+                    if (ptr.is_zero()) {
+                        o.write_to_console("nullptr");
+                    }
+                    else {
+                        fmt_impl_integral(o, ptrops, ptr);
+                    }
+
+                    return true;
+                }
+
+                case trace_tag::trace_tag_str: {
+                    return trace_decode_str(o, ops, rec, len, mut_pos);
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the bsl::trace_fmt in the provided
+        ///     catalog with the provided id, or a nullptr if the id is not
+        ///     in the catalog.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam N the total number of format strings in the catalog
+        ///   @param catalog the format strings to search
+        ///   @param id the id to search for
+        ///   @return Returns a pointer to the bsl::trace_fmt in the provided
+        ///     catalog with the provided id, or a nullptr if the id is not
+        ///     in the catalog.
+        ///
+        template<bsl::uintmax N>
+        [[nodiscard]] constexpr auto
+        trace_decode_find(array<trace_fmt, N> const &catalog, safe_uint32 const &id) noexcept
+            -> trace_fmt const *
+        {
+            for (safe_uintmax mut_i{}; mut_i < catalog.size(); ++mut_i) {
+                auto const *const f{catalog.at_if(mut_i)};
+                if (f->id() == id) {
+                    return f;
+                }
+
+                bsl::touch();
+            }
+
+            return nullptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a single record using the provided format
+        ///     string, followed by a '\n'.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+        ///   @param o the instance of out<T> to output to
+        ///   @param f the format string used to output the record
+        ///   @param rec the record to decode
+        ///   @param len the total number of bytes in rec
+        ///   @param num_args the total number of arguments in rec
+        ///   @return Returns false if the record is corrupt (including when
+        ///     num_args does not match the format string), true otherwise
+        ///
+        template<typename OUT_T>
+        [[nodiscard]] constexpr auto
+        trace_decode_record(
+            out<OUT_T> const o,
+            trace_fmt const &f,
+            bsl::uint8 const *const rec,
+            safe_uintmax const &len,
+            safe_uintmax const &num_args) noexcept -> bool
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+
+            if (unlikely(f.num_args() != num_args)) {
+                return false;
+            }
+
+            safe_uintmax mut_tag{TRACE_HEADER_SIZE};
+            safe_uintmax mut_pos{TRACE_HEADER_SIZE + num_args};
+
+            cstr_type const str{f.str()};
+            for (safe_uintmax mut_i{}; mut_i < f.length(); ++mut_i) {
+                if ('{' != str[mut_i.get()]) {
+                    o.write_to_console(str[mut_i.get()]);
+                    continue;
+                }
+
+                safe_uintmax mut_end{mut_i + one};
+                while ('}' != str[mut_end.get()]) {
+                    ++mut_end;
+                }
+
+                safe_uintmax const spec{mut_i + one};
+                fmt_options const ops{&str[spec.get()], mut_end - spec};
+                mut_i = mut_end;
+
+                auto const tag{trace_load<bsl::uint8>(rec, mut_tag)};
+                if (unlikely(!trace_decode_arg(o, ops, rec, len, mut_pos, tag))) {
+                    return false;
+                }
+
+                ++mut_tag;
+            }
+
+            o.write_to_console('\n');
+            return true;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Turns the records written by bsl::trace back into text,
+    ///     one line per record. Each record's id is looked up in the
+    ///     provided catalog, which should contain the same bsl::trace_fmt
+    ///     objects that were given to bsl::trace, and each "{}"
+    ///     placeholder is replaced with the matching argument, formatted
+    ///     the same way bsl::fmt would format it. Records with an id that
+    ///     is not in the catalog are outputted as "[unknown trace <id>]".
+    ///     If a corrupt record is found (e.g., its number of arguments
+    ///     does not match its format string), "[corrupt trace]" is
+    ///     outputted and decoding stops. Since the output is given to a
+    ///     bsl::out, the text can be written to the console, or into
+    ///     memory using bsl::format_to.
+    ///   @include example_trace_overview.hpp
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam OUT_T the type of out (i.e., debug, alert, etc)
+    ///   @tparam N the total number of format strings in the catalog
+    ///   @param o the instance of out<T> to output to
+    ///   @param buf the records to decode (e.g. bsl::trace_buffer::data())
+    ///   @param size the total number of bytes in buf
+    ///   @param catalog the format strings used to decode the records
+    ///
+    template<typename OUT_T, bsl::uintmax N>
+    constexpr void
+    trace_decode(
+        out<OUT_T> const o,
+        bsl::uint8 const *const buf,
+        safe_uintmax const &size,
+        array<trace_fmt, N> const &catalog) noexcept
+    {
+        if (unlikely(nullptr == buf)) {
+            unlikely_invalid_argument_failure();
+            return;
+        }
+
+        for (safe_uintmax mut_idx{}; mut_idx < size;) {
+            safe_uintmax const remaining{size - mut_idx};
+            if (unlikely(remaining < details::TRACE_HEADER_SIZE)) {
+                o.write_to_console("[corrupt trace]\n");
+                return;
+            }
+
+            // Each record starts where the previous record ended, and the
+            // check above ensures the header is in bounds.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto const *const rec{&buf[mut_idx.get()]};
+
+            safe_uint32 const id{details::trace_load<bsl::uint32>(rec, {})};
+            safe_uintmax const len{static_cast<bsl::uintmax>(
+                details::trace_load<bsl::uint16>(rec, details::TRACE_LEN_OFFSET))};
+            safe_uintmax const num_args{static_cast<bsl::uintmax>(
+                details::trace_load<bsl::uint8>(rec, details::TRACE_NUM_ARGS_OFFSET))};
+
+            if (unlikely(len < (details::TRACE_HEADER_SIZE + num_args))) {
+                o.write_to_console("[corrupt trace]\n");
+                return;
+            }
+
+            if (unlikely(len > remaining)) {
+                o.write_to_console("[corrupt trace]\n");
+                return;
+            }
+
+            auto const *const f{details::trace_decode_find(catalog, id)};
+            if (nullptr == f) {
+                o << "[unknown trace " << bsl::fmt{"#010x"_fmt, id} << "]\n";
+            }
+            else {
+                if (unlikely(!details::trace_decode_record(o, *f, rec, len, num_args))) {
+                    o.write_to_console("[corrupt trace]\n");
+                    return;
+                }
+
+                bsl::touch();
+            }
+
+            mut_idx += len;
+        }
+    }
+}
+
+#endif
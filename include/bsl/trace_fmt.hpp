@@ -0,0 +1,213 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file trace_fmt.hpp
+///
+
+#ifndef BSL_TRACE_FMT_HPP
+#define BSL_TRACE_FMT_HPP
+
+#include "char_type.hpp"
+#include "cstdint.hpp"
+#include "cstr_type.hpp"
+#include "fmt_options.hpp"
+#include "safe_integral.hpp"
+#include "touch.hpp"
+
+namespace bsl
+{
+    namespace details
+    {
+        /// @brief defines the FNV-1a 32bit offset basis
+        constexpr bsl::uint32 TRACE_FNV_OFFSET{static_cast<bsl::uint32>(0x811C9DC5U)};
+        /// @brief defines the FNV-1a 32bit prime
+        constexpr bsl::uint32 TRACE_FNV_PRIME{static_cast<bsl::uint32>(0x01000193U)};
+
+        /// <!-- description -->
+        ///   @brief Called by bsl::trace_fmt when it is given an invalid
+        ///     format string. This function is intentionally not a
+        ///     constexpr, which means that calling it from the
+        ///     bsl::trace_fmt constructor (which is a consteval) results
+        ///     in a compile-time error.
+        ///
+        inline void
+        trace_fmt_invalid_format_string() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief Adds the provided character to the provided FNV-1a
+        ///     hash and returns the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param hash the hash of the characters before c
+        ///   @param c the character to add to the hash
+        ///   @return Returns the hash with c added to it
+        ///
+        [[nodiscard]] constexpr auto
+        trace_fmt_hash(bsl::uint32 const hash, char_type const c) noexcept -> bsl::uint32
+        {
+            // FNV-1a relies on unsigned wrapping, which is why a
+            // bsl::safe_integral is not used here.
+            bsl::uint32 mut_hash{hash ^ static_cast<bsl::uint32>(static_cast<bsl::uint8>(c))};
+            mut_hash *= TRACE_FNV_PRIME;
+
+            return mut_hash;
+        }
+    }
+
+    /// @class bsl::trace_fmt
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a bsl::trace format string along with its id. The
+    ///     format string is made up of text and "{}" placeholders, one for
+    ///     each argument given to bsl::trace. Each placeholder can contain
+    ///     the same format options that bsl::fmt supports (e.g. "{#010x}").
+    ///     A bsl::trace_fmt can only be created at compile-time, which
+    ///     ensures the id (an FNV-1a hash of the format string) is a
+    ///     constant, and that invalid format strings (i.e., an unterminated
+    ///     placeholder or invalid format options) result in a compile-time
+    ///     error. The same bsl::trace_fmt objects should be given to
+    ///     bsl::trace_decode so that the id stored in each record can be
+    ///     turned back into its format string.
+    ///   @include example_trace_overview.hpp
+    ///
+    class trace_fmt final
+    {
+        /// @brief stores the format string
+        cstr_type m_str;
+        /// @brief stores the total number of characters in m_str
+        safe_uintmax m_len;
+        /// @brief stores the id of the format string
+        safe_uint32 m_id;
+        /// @brief stores the total number of placeholders in m_str
+        safe_uintmax m_num_args;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a bsl::trace_fmt given a format string. The
+        ///     id of the format string is calculated, and the format
+        ///     string is validated at compile-time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param str the format string
+        ///
+        explicit consteval trace_fmt(cstr_type const str) noexcept    // --
+            : m_str{str}, m_len{}, m_id{}, m_num_args{}
+        {
+            constexpr safe_uintmax one{static_cast<bsl::uintmax>(1)};
+
+            bsl::uint32 mut_hash{details::TRACE_FNV_OFFSET};
+            for (; '\0' != str[m_len.get()]; ++m_len) {
+                mut_hash = details::trace_fmt_hash(mut_hash, str[m_len.get()]);
+                if ('{' != str[m_len.get()]) {
+                    continue;
+                }
+
+                safe_uintmax mut_end{m_len + one};
+                while ('}' != str[mut_end.get()]) {
+                    if ('\0' == str[mut_end.get()]) {
+                        details::trace_fmt_invalid_format_string();
+                        return;
+                    }
+
+                    mut_hash = details::trace_fmt_hash(mut_hash, str[mut_end.get()]);
+                    ++mut_end;
+                }
+
+                mut_hash = details::trace_fmt_hash(mut_hash, str[mut_end.get()]);
+
+                safe_uintmax const spec{m_len + one};
+                if (!fmt_options::is_valid(&str[spec.get()], mut_end - spec)) {
+                    details::trace_fmt_invalid_format_string();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                // The placeholder is skipped as a whole, the same way
+                // bsl::trace_decode skips it, so that a '{' fill is not
+                // counted as another placeholder.
+                m_len = mut_end;
+                ++m_num_args;
+            }
+
+            m_id = mut_hash;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the format string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the format string.
+        ///
+        [[nodiscard]] constexpr auto
+        str() const noexcept -> cstr_type
+        {
+            return m_str;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of characters in the format
+        ///     string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of characters in the format
+        ///     string.
+        ///
+        [[nodiscard]] constexpr auto
+        length() const noexcept -> safe_uintmax const &
+        {
+            return m_len;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the id of the format string.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the id of the format string.
+        ///
+        [[nodiscard]] constexpr auto
+        id() const noexcept -> safe_uint32 const &
+        {
+            return m_id;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of "{}" placeholders in the
+        ///     format string, which is the number of arguments that must
+        ///     be given to bsl::trace.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of "{}" placeholders in the
+        ///     format string.
+        ///
+        [[nodiscard]] constexpr auto
+        num_args() const noexcept -> safe_uintmax const &
+        {
+            return m_num_args;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,105 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// @file wrapping_integral.hpp
+///
+
+#ifndef BSL_WRAPPING_INTEGRAL_HPP
+#define BSL_WRAPPING_INTEGRAL_HPP
+
+#include "cstdint.hpp"
+#include "details/wrapping_policy.hpp"
+#include "policy_integral.hpp"
+
+namespace bsl
+{
+    /// @class bsl::wrapping_integral
+    ///
+    /// <!-- description -->
+    ///   @brief Provides an integral type whose arithmetic is explicitly
+    ///     modular (i.e., it wraps on overflow, underflow and signed
+    ///     overflow using two's complement). Unlike a bsl::safe_integral,
+    ///     a bsl::wrapping_integral has no error state, so it never has to be
+    ///     checked and is well suited for ring indices, sequence numbers
+    ///     and hashes that are meant to wrap.
+    ///   @include example_wrapping_integral_overview.hpp
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam T the integral type to encapsulate.
+    ///
+    template<typename T>
+    using wrapping_integral = policy_integral<T, details::wrapping_policy>;
+
+    // -------------------------------------------------------------------------
+    // helpers
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Returns wrapping_integral<T>{val}
+    ///   @related bsl::wrapping_integral
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to make wrapping.
+    ///   @param val the integral to make wrapping
+    ///   @return Returns wrapping_integral<T>{val}
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    make_wrapping(T const &val) noexcept -> wrapping_integral<T>
+    {
+        return wrapping_integral<T>{val};
+    }
+
+    // -------------------------------------------------------------------------
+    // supported wrapping_integral types
+    // -------------------------------------------------------------------------
+
+    /// @brief provides the bsl::wrapping_integral version of bsl::int8
+    using wrapping_int8 = wrapping_integral<bsl::int8>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::int16
+    using wrapping_int16 = wrapping_integral<bsl::int16>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::int32
+    using wrapping_int32 = wrapping_integral<bsl::int32>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::int64
+    using wrapping_int64 = wrapping_integral<bsl::int64>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::intmax
+    using wrapping_intmax = wrapping_integral<bsl::intmax>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::intptr
+    using wrapping_intptr = wrapping_integral<bsl::intptr>;
+
+    /// @brief provides the bsl::wrapping_integral version of bsl::uint8
+    using wrapping_uint8 = wrapping_integral<bsl::uint8>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::uint16
+    using wrapping_uint16 = wrapping_integral<bsl::uint16>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::uint32
+    using wrapping_uint32 = wrapping_integral<bsl::uint32>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::uint64
+    using wrapping_uint64 = wrapping_integral<bsl::uint64>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::uintmax
+    using wrapping_uintmax = wrapping_integral<bsl::uintmax>;
+    /// @brief provides the bsl::wrapping_integral version of bsl::uintptr
+    using wrapping_uintptr = wrapping_integral<bsl::uintptr>;
+}
+
+#endif
@@ -0,0 +1,151 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/atomic.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/memory_order.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief the value all of the tests start with
+    constexpr bsl::uintmax INIT{static_cast<bsl::uintmax>(42)};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"default constructor"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::uintmax> const val{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(val.load() == static_cast<bsl::uintmax>(0));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"load/store"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::uintmax> mut_val{INIT};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_val.store(static_cast<bsl::uintmax>(23), bsl::memory_order_release);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_val.load(bsl::memory_order_acquire) == 23U);
+                    bsl::ut_check(mut_val.load(bsl::memory_order_relaxed) == 23U);
+                    bsl::ut_check(mut_val.load() == 23U);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"exchange"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::uintmax> mut_val{INIT};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_val.exchange(static_cast<bsl::uintmax>(23)) == INIT);
+                bsl::ut_check(mut_val.load() == 23U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"compare_exchange_strong"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::uintmax> mut_val{INIT};
+            bsl::uintmax mut_expected{static_cast<bsl::uintmax>(23)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(!mut_val.compare_exchange_strong(mut_expected, 1U));
+                bsl::ut_check(mut_expected == INIT);
+                bsl::ut_check(mut_val.compare_exchange_strong(
+                    mut_expected, 1U, bsl::memory_order_acq_rel));
+                bsl::ut_check(mut_val.load() == 1U);
+                bsl::ut_check(!mut_val.compare_exchange_strong(
+                    mut_expected, 2U, bsl::memory_order_release, bsl::memory_order_relaxed));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"compare_exchange_weak"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::uintmax> mut_val{INIT};
+            bsl::uintmax mut_expected{INIT};
+            bsl::ut_then{} = [&]() noexcept {
+                while (!mut_val.compare_exchange_weak(mut_expected, 1U)) {
+                    bsl::ut_check(mut_expected == INIT);
+                }
+                bsl::ut_check(mut_val.load() == 1U);
+                bsl::ut_check(!mut_val.compare_exchange_weak(
+                    mut_expected, 2U, bsl::memory_order_seq_cst, bsl::memory_order_seq_cst));
+                bsl::ut_check(mut_expected == 1U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"fetch operations"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::uintmax> mut_val{static_cast<bsl::uintmax>(0xF0)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_val.fetch_add(0x0FU) == 0xF0U);
+                bsl::ut_check(mut_val.fetch_sub(0x01U, bsl::memory_order_relaxed) == 0xFFU);
+                bsl::ut_check(mut_val.fetch_and(0x0FU) == 0xFEU);
+                bsl::ut_check(mut_val.fetch_or(0xF0U) == 0x0EU);
+                bsl::ut_check(mut_val.fetch_xor(0xFFU) == 0xFEU);
+                bsl::ut_check(mut_val.load() == 0x01U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"fetch_add wraps"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::uint8> mut_val{bsl::numeric_limits<bsl::uint8>::max()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_val.fetch_add(static_cast<bsl::uint8>(1)) == 0xFFU);
+                bsl::ut_check(mut_val.load() == static_cast<bsl::uint8>(0));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"signed and bool"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::atomic<bsl::int32> mut_val{static_cast<bsl::int32>(-1)};
+            bsl::atomic<bool> mut_flag{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_val.fetch_add(static_cast<bsl::int32>(2)) == -1);
+                bsl::ut_check(mut_val.load() == 1);
+                bsl::ut_check(!mut_flag.exchange(true, bsl::memory_order_acquire));
+                bsl::ut_check(mut_flag.load());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/atomic.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::atomic<bsl::uintmax> mut_val{};
+            bsl::uintmax mut_expected{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(bsl::atomic<bsl::uintmax>{}));
+                static_assert(noexcept(bsl::atomic<bsl::uintmax>{mut_expected}));
+                static_assert(noexcept(mut_val.load()));
+                static_assert(noexcept(mut_val.store(mut_expected)));
+                static_assert(noexcept(mut_val.exchange(mut_expected)));
+                static_assert(noexcept(mut_val.compare_exchange_weak(mut_expected, {})));
+                static_assert(noexcept(mut_val.compare_exchange_strong(mut_expected, {})));
+                static_assert(noexcept(mut_val.fetch_add(mut_expected)));
+                static_assert(noexcept(mut_val.fetch_sub(mut_expected)));
+                static_assert(noexcept(mut_val.fetch_and(mut_expected)));
+                static_assert(noexcept(mut_val.fetch_or(mut_expected)));
+                static_assert(noexcept(mut_val.fetch_xor(mut_expected)));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,223 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bit.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    tests_bit() noexcept -> bsl::exit_code
+    {
+        constexpr T zero{static_cast<T>(0)};
+        constexpr T one{static_cast<T>(1)};
+        constexpr T two{static_cast<T>(2)};
+        constexpr T max{numeric_limits<T>::max()};
+        constexpr T digits{static_cast<T>(sizeof(T) * static_cast<bsl::uintmax>(8))};
+        constexpr T last{static_cast<T>(digits - one)};
+        constexpr T high{static_cast<T>(one << last)};
+
+        bsl::ut_scenario{"popcount"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(popcount(zero) == zero);
+                    bsl::ut_check(popcount(one) == one);
+                    bsl::ut_check(popcount(static_cast<T>(0x5A)) == static_cast<T>(4));
+                    bsl::ut_check(popcount(high) == one);
+                    bsl::ut_check(popcount(max) == digits);
+                    bsl::ut_check(popcount(safe_integral<T>{max}) == digits);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"countl_zero"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(countl_zero(zero) == digits);
+                    bsl::ut_check(countl_zero(one) == last);
+                    bsl::ut_check(countl_zero(high) == zero);
+                    bsl::ut_check(countl_zero(max) == zero);
+                    bsl::ut_check(countl_zero(safe_integral<T>{one}) == last);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"countr_zero"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(countr_zero(zero) == digits);
+                    bsl::ut_check(countr_zero(one) == zero);
+                    bsl::ut_check(countr_zero(static_cast<T>(0x50)) == static_cast<T>(4));
+                    bsl::ut_check(countr_zero(high) == last);
+                    bsl::ut_check(countr_zero(safe_integral<T>{high}) == last);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"rotl/rotr"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(rotl(high, one) == one);
+                    bsl::ut_check(rotr(one, one) == high);
+                    bsl::ut_check(rotl(one, digits) == one);
+                    bsl::ut_check(rotr(one, digits) == one);
+                    bsl::ut_check(rotl(one, zero) == one);
+                    bsl::ut_check(rotr(one, zero) == one);
+                    bsl::ut_check(rotl(static_cast<T>(0x21), two) == static_cast<T>(0x84));
+                    bsl::ut_check(rotr(static_cast<T>(0x84), two) == static_cast<T>(0x21));
+                    bsl::ut_check(rotl(max, static_cast<T>(digits + one)) == max);
+                    bsl::ut_check(
+                        rotl(safe_integral<T>{high}, safe_integral<T>{two}) == two);
+                    bsl::ut_check(
+                        rotr(safe_integral<T>{two}, safe_integral<T>{two}) == high);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bit_width"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bit_width(zero) == zero);
+                    bsl::ut_check(bit_width(one) == one);
+                    bsl::ut_check(bit_width(static_cast<T>(5)) == static_cast<T>(3));
+                    bsl::ut_check(bit_width(max) == digits);
+                    bsl::ut_check(bit_width(safe_integral<T>{max}) == digits);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bit_floor"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bit_floor(zero) == zero);
+                    bsl::ut_check(bit_floor(one) == one);
+                    bsl::ut_check(bit_floor(static_cast<T>(5)) == static_cast<T>(4));
+                    bsl::ut_check(bit_floor(max) == high);
+                    bsl::ut_check(bit_floor(safe_integral<T>{max}) == high);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bit_ceil"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bit_ceil(zero) == one);
+                    bsl::ut_check(bit_ceil(one) == one);
+                    bsl::ut_check(bit_ceil(two) == two);
+                    bsl::ut_check(bit_ceil(static_cast<T>(5)) == static_cast<T>(8));
+                    bsl::ut_check(bit_ceil(high) == high);
+                    bsl::ut_check(bit_ceil(static_cast<T>(high + one)) == zero);
+                    bsl::ut_check(bit_ceil(max) == zero);
+                    bsl::ut_check(
+                        bit_ceil(safe_integral<T>{static_cast<T>(5)}) == static_cast<T>(8));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"has_single_bit"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(!has_single_bit(zero));
+                    bsl::ut_check(has_single_bit(one));
+                    bsl::ut_check(has_single_bit(high));
+                    bsl::ut_check(!has_single_bit(static_cast<T>(3)));
+                    bsl::ut_check(!has_single_bit(max));
+                    bsl::ut_check(has_single_bit(safe_integral<T>{two}));
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_bit<bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_bit<bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_bit<bsl::uint32>() == bsl::ut_success());
+    static_assert(bsl::tests_bit<bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_bit<bsl::uintmax>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_bit<bsl::uint8>());
+    bsl::discard(bsl::tests_bit<bsl::uint16>());
+    bsl::discard(bsl::tests_bit<bsl::uint32>());
+    bsl::discard(bsl::tests_bit<bsl::uint64>());
+    bsl::discard(bsl::tests_bit<bsl::uintmax>());
+
+    bsl::ut_scenario{"invalid operands"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(42)};
+            bsl::safe_uintmax const err{bsl::safe_uintmax::failure()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::popcount(err).invalid());
+                bsl::ut_check(bsl::countl_zero(err).invalid());
+                bsl::ut_check(bsl::countr_zero(err).invalid());
+                bsl::ut_check(bsl::rotl(err, val).invalid());
+                bsl::ut_check(bsl::rotl(val, err).invalid());
+                bsl::ut_check(bsl::rotr(err, val).invalid());
+                bsl::ut_check(bsl::rotr(val, err).invalid());
+                bsl::ut_check(bsl::bit_width(err).invalid());
+                bsl::ut_check(bsl::bit_floor(err).invalid());
+                bsl::ut_check(bsl::bit_ceil(err).invalid());
+                bsl::ut_check(!bsl::has_single_bit(err));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"bit_ceil overflow"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const max{bsl::safe_uintmax::max()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::bit_ceil(max).invalid());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
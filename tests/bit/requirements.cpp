@@ -0,0 +1,87 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bit.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::uintmax const raw{};
+            bsl::safe_uintmax const val{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(bsl::popcount(raw)));
+                static_assert(noexcept(bsl::countl_zero(raw)));
+                static_assert(noexcept(bsl::countr_zero(raw)));
+                static_assert(noexcept(bsl::rotl(raw, raw)));
+                static_assert(noexcept(bsl::rotr(raw, raw)));
+                static_assert(noexcept(bsl::bit_width(raw)));
+                static_assert(noexcept(bsl::bit_floor(raw)));
+                static_assert(noexcept(bsl::bit_ceil(raw)));
+                static_assert(noexcept(bsl::has_single_bit(raw)));
+                static_assert(noexcept(bsl::popcount(val)));
+                static_assert(noexcept(bsl::countl_zero(val)));
+                static_assert(noexcept(bsl::countr_zero(val)));
+                static_assert(noexcept(bsl::rotl(val, val)));
+                static_assert(noexcept(bsl::rotr(val, val)));
+                static_assert(noexcept(bsl::bit_width(val)));
+                static_assert(noexcept(bsl::bit_floor(val)));
+                static_assert(noexcept(bsl::bit_ceil(val)));
+                static_assert(noexcept(bsl::has_single_bit(val)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            constexpr bsl::safe_uintmax val{static_cast<bsl::uintmax>(42)};
+            constexpr bsl::safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(bsl::popcount(val) == static_cast<bsl::uintmax>(3));
+                static_assert(bsl::countl_zero(val) == static_cast<bsl::uintmax>(58));
+                static_assert(bsl::countr_zero(val) == static_cast<bsl::uintmax>(1));
+                static_assert(bsl::rotl(val, one) == static_cast<bsl::uintmax>(84));
+                static_assert(bsl::rotr(val, one) == static_cast<bsl::uintmax>(21));
+                static_assert(bsl::bit_width(val) == static_cast<bsl::uintmax>(6));
+                static_assert(bsl::bit_floor(val) == static_cast<bsl::uintmax>(32));
+                static_assert(bsl::bit_ceil(val) == static_cast<bsl::uintmax>(64));
+                static_assert(!bsl::has_single_bit(val));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
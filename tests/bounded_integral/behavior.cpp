@@ -0,0 +1,214 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bounded_integral.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/is_same.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines a type for interrupt vectors
+    using vector_type = bsl::bounded_uint16<0, 255>;
+    /// @brief defines a type for page offsets
+    using offset_type = bsl::bounded_uint64<0, 0xFFF>;
+    /// @brief defines a type that covers all of bsl::uint64
+    using any_u64_type = bsl::bounded_uint64<0, bsl::numeric_limits<bsl::uint64>::max()>;
+    /// @brief defines a signed type for testing
+    using small_i8_type = bsl::bounded_int8<-100, 100>;
+    /// @brief defines a signed type for testing
+    using any_i8_type = bsl::bounded_int8<-128, 127>;
+    /// @brief defines a signed type for testing
+    using neg_i8_type = bsl::bounded_int8<-2, -1>;
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"result ranges"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(bsl::is_same<
+                              decltype(vector_type{} + vector_type{}),
+                              bsl::bounded_uint16<0, 510>>::value);
+                static_assert(
+                    bsl::is_same<decltype(vector_type{} - vector_type{}), bsl::safe_uint16>::value);
+                static_assert(bsl::is_same<
+                              decltype(vector_type{} * vector_type{}),
+                              bsl::bounded_uint16<0, 65025>>::value);
+                static_assert(bsl::is_same<
+                              decltype(vector_type{} * bsl::bounded_uint16<0, 258>{}),
+                              bsl::safe_uint16>::value);
+                static_assert(
+                    bsl::is_same<decltype(vector_type{} / vector_type{}), bsl::safe_uint16>::value);
+                static_assert(bsl::is_same<
+                              decltype(vector_type{} / bsl::bounded_uint16<2, 4>{}),
+                              bsl::bounded_uint16<0, 127>>::value);
+                static_assert(bsl::is_same<
+                              decltype(vector_type{} % bsl::bounded_uint16<1, 16>{}),
+                              bsl::bounded_uint16<0, 15>>::value);
+                static_assert(bsl::is_same<
+                              decltype(any_u64_type{} & offset_type{}),
+                              bsl::bounded_uint64<0, 0xFFF>>::value);
+                static_assert(bsl::is_same<
+                              decltype(small_i8_type{} - small_i8_type{}),
+                              bsl::safe_int8>::value);
+                static_assert(bsl::is_same<
+                              decltype(small_i8_type{} / neg_i8_type{}),
+                              bsl::bounded_int8<-100, 100>>::value);
+                static_assert(bsl::is_same<
+                              decltype(any_i8_type{} / neg_i8_type{}),
+                              bsl::safe_int8>::value);
+                static_assert(bsl::is_same<
+                              decltype(small_i8_type{} % neg_i8_type{}),
+                              bsl::safe_int8>::value);
+                static_assert(bsl::is_same<
+                              decltype(neg_i8_type{} * neg_i8_type{}),
+                              bsl::bounded_int8<1, 4>>::value);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"arithmetic"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            vector_type const val1{static_cast<bsl::uint16>(200)};
+            vector_type const val2{static_cast<bsl::uint16>(100)};
+            neg_i8_type const val3{static_cast<bsl::int8>(-2)};
+            small_i8_type const val4{static_cast<bsl::int8>(-100)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(val1 + val2 == static_cast<bsl::uint16>(300));
+                bsl::ut_check(val1 - val2 == static_cast<bsl::uint16>(100));
+                bsl::ut_check(val1 * val2 == static_cast<bsl::uint16>(20000));
+                bsl::ut_check(
+                    val1 / bsl::bounded_constant<static_cast<bsl::uint16>(3)>() ==
+                    static_cast<bsl::uint16>(66));
+                bsl::ut_check(
+                    val1 % bsl::bounded_constant<static_cast<bsl::uint16>(16)>() ==
+                    static_cast<bsl::uint16>(8));
+                bsl::ut_check(val4 / val3 == static_cast<bsl::int8>(50));
+                bsl::ut_check(val3 * val3 == static_cast<bsl::int8>(4));
+                bsl::ut_check((val4 - val4).is_zero());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            any_i8_type const val1{bsl::numeric_limits<bsl::int8>::min()};
+            neg_i8_type const val2{static_cast<bsl::int8>(-1)};
+            vector_type const val3{static_cast<bsl::uint16>(100)};
+            vector_type const val4{static_cast<bsl::uint16>(200)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check((val1 / val2).invalid());
+                bsl::ut_check((val3 - val4).invalid());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"masking"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            any_u64_type const addr{static_cast<bsl::uint64>(0x1234)};
+            bsl::ut_then{} = [&]() noexcept {
+                auto const offset{addr & bsl::bounded_constant<static_cast<bsl::uint64>(0xFFF)>()};
+                bsl::ut_check(offset == static_cast<bsl::uint64>(0x234));
+                bsl::ut_check(offset.max() == static_cast<bsl::uint64>(0xFFF));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"rational"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            vector_type const val1{static_cast<bsl::uint16>(42)};
+            bsl::bounded_uint16<0, 42> const val2{static_cast<bsl::uint16>(42)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(val1 == val2);
+                bsl::ut_check(!(val1 != val2));
+                bsl::ut_check(val1 <= val2);
+                bsl::ut_check(val1 >= val2);
+                bsl::ut_check(!(val1 < val2));
+                bsl::ut_check(!(val1 > val2));
+                bsl::ut_check(static_cast<bsl::uint16>(42) == val1);
+                bsl::ut_check(val1 != static_cast<bsl::uint16>(43));
+                bsl::ut_check(val1 < static_cast<bsl::uint16>(43));
+                bsl::ut_check(static_cast<bsl::uint16>(43) > val1);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"members"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::bounded_uint16<10, 20> mut_val{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_val == static_cast<bsl::uint16>(10));
+                bsl::ut_check(mut_val.min() == static_cast<bsl::uint16>(10));
+                bsl::ut_check(mut_val.max() == static_cast<bsl::uint16>(20));
+                mut_val = bsl::bounded_uint16<10, 20>{static_cast<bsl::uint16>(15)};
+                bsl::ut_check(mut_val.get() == static_cast<bsl::uint16>(15));
+                bsl::ut_check(mut_val.to_safe() == static_cast<bsl::uint16>(15));
+                bsl::ut_check(bsl::bounded_uint16<10, 20>{mut_val.to_safe()} == mut_val);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                vector_type const val1{static_cast<bsl::uint16>(256)};
+                small_i8_type const val2{static_cast<bsl::int8>(-101)};
+                vector_type const val3{bsl::safe_uint16::failure()};
+                bsl::ut_check(val1 == static_cast<bsl::uint16>(255));
+                bsl::ut_check(val2 == static_cast<bsl::int8>(-100));
+                bsl::ut_check(val3 == static_cast<bsl::uint16>(0));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"convert"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            vector_type const val1{static_cast<bsl::uint16>(255)};
+            small_i8_type const val2{static_cast<bsl::int8>(-100)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::convert<bsl::uint8>(val1) == static_cast<bsl::uint8>(255));
+                bsl::ut_check(bsl::convert<bsl::int64>(val2) == static_cast<bsl::int64>(-100));
+                bsl::ut_check(bsl::convert<bsl::uint64>(val1) == static_cast<bsl::uint64>(255));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            small_i8_type const val{static_cast<bsl::int8>(-100)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::convert<bsl::uint8>(val).invalid());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,98 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/bounded_integral.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines a type for interrupt vectors
+    using vector_type = bsl::bounded_uint16<0, 255>;
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            vector_type const val{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(vector_type{}));
+                static_assert(noexcept(vector_type{static_cast<bsl::uint16>(42)}));
+                static_assert(noexcept(vector_type{bsl::safe_uint16{}}));
+                static_assert(noexcept(val.get()));
+                static_assert(noexcept(val.to_safe()));
+                static_assert(noexcept(vector_type::min()));
+                static_assert(noexcept(vector_type::max()));
+                static_assert(noexcept(val == val));
+                static_assert(noexcept(val != val));
+                static_assert(noexcept(val < val));
+                static_assert(noexcept(val > val));
+                static_assert(noexcept(val <= val));
+                static_assert(noexcept(val >= val));
+                static_assert(noexcept(val + val));
+                static_assert(noexcept(val - val));
+                static_assert(noexcept(val * val));
+                static_assert(noexcept(val / val));
+                static_assert(noexcept(val % val));
+                static_assert(noexcept(val & val));
+                static_assert(noexcept(bsl::bounded_constant<static_cast<bsl::uint16>(42)>()));
+                static_assert(noexcept(bsl::convert<bsl::uint8>(val)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            constexpr vector_type val{static_cast<bsl::uint16>(42)};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(val.get() == static_cast<bsl::uint16>(42));
+                static_assert(val.to_safe() == static_cast<bsl::uint16>(42));
+                static_assert(val == val);
+                static_assert(!(val != val));
+                static_assert(!(val < val));
+                static_assert(!(val > val));
+                static_assert(val <= val);
+                static_assert(val >= val);
+                static_assert(val + val == static_cast<bsl::uint16>(84));
+                static_assert(val * val == static_cast<bsl::uint16>(1764));
+                static_assert((val & val) == static_cast<bsl::uint16>(42));
+                static_assert(bsl::convert<bsl::uint8>(val) == static_cast<bsl::uint8>(42));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
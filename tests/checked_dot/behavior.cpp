@@ -0,0 +1,207 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/checked_dot.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the arrays used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(200)};
+
+    /// <!-- description -->
+    ///   @brief Returns the dot product of the provided elements,
+    ///     calculated one element at a time using bsl::safe_integral.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being multiplied
+    ///   @param lhs the left hand side elements
+    ///   @param rhs the right hand side elements
+    ///   @return Returns the dot product of the provided elements
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    scalar_dot(
+        bsl::span<bsl::safe_integral<T> const> const &lhs,
+        bsl::span<bsl::safe_integral<T> const> const &rhs) noexcept -> bsl::safe_integral<T>
+    {
+        bsl::safe_integral<T> mut_sum{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < lhs.size(); ++mut_i) {
+            mut_sum += *lhs.at_if(mut_i) * *rhs.at_if(mut_i);
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if bsl::checked_dot and scalar_dot return
+    ///     the same result for the provided arrays.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being multiplied
+    ///   @param lhs the left hand side array
+    ///   @param rhs the right hand side array
+    ///   @return Returns true if both dot products are the same
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    same_dot(
+        bsl::array<bsl::safe_integral<T>, TEST_SIZE> const &lhs,
+        bsl::array<bsl::safe_integral<T>, TEST_SIZE> const &rhs) noexcept -> bool
+    {
+        bsl::span<bsl::safe_integral<T> const> const l{lhs};
+        bsl::span<bsl::safe_integral<T> const> const r{rhs};
+        auto const expected{scalar_dot(l, r)};
+        auto const actual{bsl::checked_dot(l, r)};
+
+        if (!expected) {
+            return !actual;
+        }
+
+        if (!actual) {
+            return false;
+        }
+
+        return expected == actual;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns an array where each element is set to the provided
+    ///     value.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to store
+    ///   @param val the value to set each element to
+    ///   @return Returns the resulting array
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    make_arr(bsl::safe_integral<T> const &val) noexcept
+        -> bsl::array<bsl::safe_integral<T>, TEST_SIZE>
+    {
+        bsl::array<bsl::safe_integral<T>, TEST_SIZE> mut_arr{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < mut_arr.size(); ++mut_i) {
+            *mut_arr.at_if(mut_i) = val;
+        }
+
+        return mut_arr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"invalid arguments"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto const arr{make_arr(1_u64)};
+            bsl::span<bsl::safe_uint64 const> const all{arr};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(!bsl::checked_dot(all, all.first(1_umax)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"empty"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::span<bsl::safe_uint64 const> const vals{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::checked_dot(vals, vals) == 0_u64);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"matches the scalar loop"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(same_dot(make_arr(1_u8), make_arr(1_u8)));
+                static_assert(same_dot(make_arr(3_u16), make_arr(14_u16)));
+                static_assert(same_dot(make_arr(3_u32), make_arr(14_u32)));
+                static_assert(same_dot(make_arr(3_u64), make_arr(14_u64)));
+                static_assert(same_dot(make_arr(0_i8), make_arr(-1_i8)));
+                static_assert(same_dot(make_arr(-3_i16), make_arr(14_i16)));
+                static_assert(same_dot(make_arr(-3_i32), make_arr(14_i32)));
+                static_assert(same_dot(make_arr(-3_i64), make_arr(14_i64)));
+                static_assert(
+                    bsl::checked_dot(bsl::span{make_arr(3_u16)}, bsl::span{make_arr(14_u16)}) ==
+                    8400_u16);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(same_dot(make_arr(16_u8), make_arr(16_u8)));
+                bsl::ut_check(same_dot(make_arr(0x10000_u32), make_arr(0x10000_u32)));
+                bsl::ut_check(same_dot(make_arr(0x10000_u32), make_arr(0xFFFF_u32)));
+                bsl::ut_check(same_dot(make_arr(bsl::safe_uint64::max()), make_arr(1_u64)));
+                bsl::ut_check(same_dot(make_arr(bsl::safe_int32::min()), make_arr(-1_i32)));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_lhs{make_arr(0_u16)};
+            auto const rhs{make_arr(1_u16)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_lhs.at_if(150_umax) = bsl::safe_uint16::failure();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::checked_dot(
+                        bsl::span<bsl::safe_uint16 const>{mut_lhs},
+                        bsl::span<bsl::safe_uint16 const>{rhs}));
+                    bsl::ut_check(same_dot(mut_lhs, rhs));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"32 bit products use 64 bit blocks"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            constexpr auto big{0xFFFF_u32};
+            constexpr auto max{bsl::safe_uint32::max()};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(bsl::details::checked_use_blocked<bsl::uint32, 2U>());
+                static_assert(!bsl::details::checked_use_blocked<bsl::uint64, 2U>());
+                bsl::ut_check(same_dot(make_arr(big), make_arr(big)));
+                bsl::ut_check(same_dot(make_arr(max), make_arr(1_u32)));
+                bsl::ut_check(
+                    !bsl::checked_dot(bsl::span{make_arr(max)}, bsl::span{make_arr(1_u32)}));
+                bsl::ut_check(same_dot(make_arr(max), make_arr(max)));
+                bsl::ut_check(same_dot(make_arr(0x10000_u32), make_arr(0x10000_u32)));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,212 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/checked_inclusive_scan.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the arrays used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(100)};
+
+    /// <!-- description -->
+    ///   @brief Returns true if bsl::checked_inclusive_scan stores the
+    ///     same prefix sums as adding each element to a
+    ///     bsl::safe_integral<T> one at a time.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being summed
+    ///   @param arr the array to scan
+    ///   @return Returns true if the prefix sums are the same
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    same_scan(bsl::array<bsl::safe_integral<T>, TEST_SIZE> const &arr) noexcept -> bool
+    {
+        bsl::array<bsl::safe_integral<T>, TEST_SIZE> mut_res{};
+        auto const total{bsl::checked_inclusive_scan(
+            bsl::span<bsl::safe_integral<T> const>{arr}, bsl::span{mut_res})};
+
+        bsl::safe_integral<T> mut_sum{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < arr.size(); ++mut_i) {
+            mut_sum += *arr.at_if(mut_i);
+            auto const &res{*mut_res.at_if(mut_i)};
+
+            if (!mut_sum) {
+                if (res) {
+                    return false;
+                }
+
+                continue;
+            }
+
+            if (!res) {
+                return false;
+            }
+
+            if (mut_sum != res) {
+                return false;
+            }
+        }
+
+        if (!mut_sum) {
+            return !total;
+        }
+
+        return mut_sum == total;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns an array where each element is set to the provided
+    ///     value.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to store
+    ///   @param val the value to set each element to
+    ///   @return Returns the resulting array
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    make_arr(bsl::safe_integral<T> const &val) noexcept
+        -> bsl::array<bsl::safe_integral<T>, TEST_SIZE>
+    {
+        bsl::array<bsl::safe_integral<T>, TEST_SIZE> mut_arr{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < mut_arr.size(); ++mut_i) {
+            *mut_arr.at_if(mut_i) = val;
+        }
+
+        return mut_arr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"invalid arguments"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(1_u64)};
+            bsl::span mut_all{mut_arr};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(!bsl::checked_inclusive_scan(mut_all, mut_all.first(1_umax)));
+                bsl::ut_check(*mut_arr.at_if(0_umax) == 1_u64);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"in place"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(1_u64)};
+            bsl::span mut_all{mut_arr};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::checked_inclusive_scan(mut_all, mut_all) == 100_u64);
+                bsl::ut_check(*mut_arr.at_if(0_umax) == 1_u64);
+                bsl::ut_check(*mut_arr.at_if(49_umax) == 50_u64);
+                bsl::ut_check(*mut_arr.at_if(99_umax) == 100_u64);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"matches the scalar loop"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(same_scan(make_arr(1_u8)));
+                static_assert(same_scan(make_arr(42_u32)));
+                static_assert(same_scan(make_arr(-1_i8)));
+                static_assert(same_scan(make_arr(-42_i64)));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(same_scan(make_arr(3_u8)));
+                bsl::ut_check(same_scan(make_arr(-2_i8)));
+                bsl::ut_check(same_scan(make_arr(bsl::safe_uint64::max())));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(0_i32)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(10_umax) = bsl::safe_int32::max();
+                *mut_arr.at_if(11_umax) = 1_i32;
+                *mut_arr.at_if(12_umax) = -1_i32;
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(same_scan(mut_arr));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(1_u16)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(50_umax) = bsl::safe_uint16::failure();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(same_scan(mut_arr));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"blocks"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(1_u64)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(70_umax) = bsl::safe_uint64::max();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(same_scan(mut_arr));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(1_u64)};
+            bsl::span mut_all{mut_arr};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(70_umax) = bsl::safe_uint64::max();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::checked_inclusive_scan(mut_all, mut_all));
+                    bsl::ut_check(*mut_arr.at_if(63_umax) == 64_u64);
+                    bsl::ut_check(*mut_arr.at_if(69_umax) == 70_u64);
+                    bsl::ut_check(mut_arr.at_if(70_umax)->invalid());
+                    bsl::ut_check(mut_arr.at_if(99_umax)->invalid());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,232 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/checked_sum.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the arrays used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(200)};
+
+    /// <!-- description -->
+    ///   @brief Returns the sum of the provided elements, calculated one
+    ///     element at a time using bsl::safe_integral.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being summed
+    ///   @param vals the elements to sum
+    ///   @return Returns the sum of the provided elements
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    scalar_sum(bsl::span<bsl::safe_integral<T> const> const &vals) noexcept
+        -> bsl::safe_integral<T>
+    {
+        bsl::safe_integral<T> mut_sum{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < vals.size(); ++mut_i) {
+            mut_sum += *vals.at_if(mut_i);
+        }
+
+        return mut_sum;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if bsl::checked_sum and scalar_sum return
+    ///     the same result for the provided array.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral being summed
+    ///   @param arr the array to sum
+    ///   @return Returns true if both sums are the same
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    same_sum(bsl::array<bsl::safe_integral<T>, TEST_SIZE> const &arr) noexcept -> bool
+    {
+        bsl::span<bsl::safe_integral<T> const> const vals{arr};
+        auto const expected{scalar_sum(vals)};
+        auto const actual{bsl::checked_sum(vals)};
+
+        if (!expected) {
+            return !actual;
+        }
+
+        if (!actual) {
+            return false;
+        }
+
+        return expected == actual;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns an array where each element is set to the provided
+    ///     value.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of integral to store
+    ///   @param val the value to set each element to
+    ///   @return Returns the resulting array
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    make_arr(bsl::safe_integral<T> const &val) noexcept
+        -> bsl::array<bsl::safe_integral<T>, TEST_SIZE>
+    {
+        bsl::array<bsl::safe_integral<T>, TEST_SIZE> mut_arr{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < mut_arr.size(); ++mut_i) {
+            *mut_arr.at_if(mut_i) = val;
+        }
+
+        return mut_arr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"empty"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::span<bsl::safe_uint64 const> const vals{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::checked_sum(vals) == 0_u64);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"matches the scalar loop"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(same_sum(make_arr(1_u8)));
+                static_assert(same_sum(make_arr(42_u16)));
+                static_assert(same_sum(make_arr(42_u32)));
+                static_assert(same_sum(make_arr(42_u64)));
+                static_assert(same_sum(make_arr(0_i8)));
+                static_assert(same_sum(make_arr(-42_i16)));
+                static_assert(same_sum(make_arr(-42_i32)));
+                static_assert(same_sum(make_arr(-42_i64)));
+                static_assert(bsl::checked_sum(bsl::span{make_arr(42_u16)}) == 8400_u16);
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(same_sum(make_arr(42_u8)));
+                bsl::ut_check(same_sum(make_arr(bsl::safe_uint32::max())));
+                bsl::ut_check(same_sum(make_arr(bsl::safe_uint64::max())));
+                bsl::ut_check(same_sum(make_arr(bsl::safe_int8::max())));
+                bsl::ut_check(same_sum(make_arr(bsl::safe_int64::min())));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(0_i32)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(70_umax) = bsl::safe_int32::max();
+                *mut_arr.at_if(71_umax) = 1_i32;
+                *mut_arr.at_if(72_umax) = -1_i32;
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::checked_sum(bsl::span{mut_arr}));
+                    bsl::ut_check(same_sum(mut_arr));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(1_u64)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(199_umax) = bsl::safe_uint64::failure();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::checked_sum(bsl::span{mut_arr}));
+                    bsl::ut_check(same_sum(mut_arr));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(0_u8)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(0_umax) = 200_u8;
+                *mut_arr.at_if(199_umax) = 56_u8;
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::checked_sum(bsl::span{mut_arr}));
+                    bsl::ut_check(same_sum(mut_arr));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"64 bit blocks count their carries"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            constexpr auto fits{bsl::safe_uint64::max() / bsl::to_u64(TEST_SIZE)};
+            constexpr auto wraps{bsl::safe_uint64::max() / bsl::to_u64(TEST_SIZE - 1U)};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(bsl::details::checked_use_blocked<bsl::uint64, 1U>());
+                bsl::ut_check(same_sum(make_arr(fits)));
+                bsl::ut_check(bsl::checked_sum(bsl::span{make_arr(fits)}) == fits * 200_u64);
+                bsl::ut_check(same_sum(make_arr(wraps)));
+                bsl::ut_check(!bsl::checked_sum(bsl::span{make_arr(wraps)}));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(0_u64)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(3_umax) = bsl::safe_uint64::max();
+                *mut_arr.at_if(4_umax) = bsl::safe_uint64::max();
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::checked_sum(bsl::span{mut_arr}));
+                    bsl::ut_check(same_sum(mut_arr));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            auto mut_arr{make_arr(0_u64)};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_arr.at_if(63_umax) = bsl::safe_uint64::max();
+                *mut_arr.at_if(64_umax) = 1_u64;
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::checked_sum(bsl::span{mut_arr}));
+                    bsl::ut_check(same_sum(mut_arr));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,204 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert_all.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace bsl
+{
+    /// @brief the total number of elements used by the tests (a few blocks)
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(200)};
+    /// @brief the index of the element used to test failures
+    constexpr safe_uintmax TEST_BAD_IDX{static_cast<bsl::uintmax>(130)};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to convert to
+    ///   @tparam F the integral type to convert from
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T, typename F>
+    [[nodiscard]] constexpr auto
+    tests_convert_all() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"converts every element"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr safe_uintmax max{static_cast<bsl::uintmax>(100)};
+                bsl::array<F, TEST_SIZE> mut_src{};
+                bsl::array<T, TEST_SIZE> mut_dst{};
+                for (safe_uintmax mut_i{}; mut_i < mut_src.size(); ++mut_i) {
+                    *mut_src.at_if(mut_i) = static_cast<F>((mut_i % max).get());
+                }
+                bsl::ut_when{} = [&]() noexcept {
+                    span<F const> const src{mut_src};
+                    span<T> const dst{mut_dst};
+                    safe_uintmax const ret{convert_all(src, dst)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret == mut_src.size());
+                        for (safe_uintmax mut_i{}; mut_i < mut_src.size(); ++mut_i) {
+                            T const val{static_cast<T>(*mut_src.at_if(mut_i))};
+                            bsl::ut_check(*mut_dst.at_if(mut_i) == val);
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"non-const source"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<F, TEST_SIZE> mut_src{};
+                bsl::array<T, TEST_SIZE> mut_dst{};
+                bsl::ut_when{} = [&]() noexcept {
+                    span<F> const src{mut_src};
+                    span<T> const dst{mut_dst};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(convert_all(src, dst) == mut_src.size());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"empty source"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                span<F const> const src{};
+                span<T> const dst{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(convert_all(src, dst).is_zero());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_convert_all<bsl::uint32, bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_convert_all<bsl::uint8, bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_convert_all<bsl::int8, bsl::int32>() == bsl::ut_success());
+    static_assert(bsl::tests_convert_all<bsl::uint8, bsl::int64>() == bsl::ut_success());
+    static_assert(bsl::tests_convert_all<bsl::int16, bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_convert_all<bsl::uint64, bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_convert_all<bsl::int32, bsl::int32>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_convert_all<bsl::uint32, bsl::uint64>());
+    bsl::discard(bsl::tests_convert_all<bsl::uint8, bsl::uint16>());
+    bsl::discard(bsl::tests_convert_all<bsl::int8, bsl::int32>());
+    bsl::discard(bsl::tests_convert_all<bsl::uint8, bsl::int64>());
+    bsl::discard(bsl::tests_convert_all<bsl::int16, bsl::uint16>());
+    bsl::discard(bsl::tests_convert_all<bsl::uint64, bsl::uint8>());
+    bsl::discard(bsl::tests_convert_all<bsl::int32, bsl::int32>());
+
+    bsl::ut_scenario{"too large"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::uint64, bsl::TEST_SIZE> mut_src{};
+            bsl::array<bsl::uint32, bsl::TEST_SIZE> mut_dst{};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_src.at_if(bsl::TEST_BAD_IDX) = bsl::numeric_limits<bsl::uint64>::max();
+                bsl::span<bsl::uint64 const> const src{mut_src};
+                bsl::span<bsl::uint32> const dst{mut_dst};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::convert_all(src, dst) == bsl::TEST_BAD_IDX);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"too small"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::int32, bsl::TEST_SIZE> mut_src{};
+            bsl::array<bsl::int8, bsl::TEST_SIZE> mut_dst{};
+            bsl::ut_when{} = [&]() noexcept {
+                for (bsl::safe_uintmax mut_i{}; mut_i < mut_src.size(); ++mut_i) {
+                    *mut_src.at_if(mut_i) = static_cast<bsl::int32>(-1);
+                }
+                *mut_src.at_if(bsl::TEST_BAD_IDX) = static_cast<bsl::int32>(-129);
+                bsl::span<bsl::int32 const> const src{mut_src};
+                bsl::span<bsl::int8> const dst{mut_dst};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::convert_all(src, dst) == bsl::TEST_BAD_IDX);
+                    for (bsl::safe_uintmax mut_i{}; mut_i < bsl::TEST_BAD_IDX; ++mut_i) {
+                        bsl::ut_check(*mut_dst.at_if(mut_i) == static_cast<bsl::int8>(-1));
+                    }
+                    for (auto mut_i{bsl::TEST_BAD_IDX}; mut_i < mut_dst.size(); ++mut_i) {
+                        bsl::ut_check(*mut_dst.at_if(mut_i) == static_cast<bsl::int8>(0));
+                    }
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"negative to unsigned"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            constexpr bsl::safe_uintmax one{static_cast<bsl::uintmax>(1)};
+            bsl::array<bsl::int64, bsl::TEST_SIZE> mut_src{};
+            bsl::array<bsl::uint16, bsl::TEST_SIZE> mut_dst{};
+            bsl::ut_when{} = [&]() noexcept {
+                *mut_src.at_if(one) = static_cast<bsl::int64>(-1);
+                bsl::span<bsl::int64 const> const src{mut_src};
+                bsl::span<bsl::uint16> const dst{mut_dst};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::convert_all(src, dst) == one);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"destination too small"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::uint16, bsl::TEST_SIZE> mut_src{};
+            bsl::array<bsl::uint8, static_cast<bsl::uintmax>(1)> mut_dst{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::span<bsl::uint16 const> const src{mut_src};
+                bsl::span<bsl::uint8> const dst{mut_dst};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::convert_all(src, dst).invalid());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
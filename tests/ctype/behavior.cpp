@@ -0,0 +1,155 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/ctype.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"isspace"} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::isspace(' '));
+                bsl::ut_check(bsl::isspace('\t'));
+                bsl::ut_check(bsl::isspace('\n'));
+                bsl::ut_check(bsl::isspace('\v'));
+                bsl::ut_check(bsl::isspace('\f'));
+                bsl::ut_check(bsl::isspace('\r'));
+                bsl::ut_check(!bsl::isspace('\0'));
+                bsl::ut_check(!bsl::isspace('a'));
+                bsl::ut_check(!bsl::isspace(static_cast<bsl::char_type>(0xA0)));
+            };
+        };
+
+        bsl::ut_scenario{"isdigit"} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::isdigit('0'));
+                bsl::ut_check(bsl::isdigit('9'));
+                bsl::ut_check(!bsl::isdigit('/'));
+                bsl::ut_check(!bsl::isdigit(':'));
+                bsl::ut_check(!bsl::isdigit('a'));
+            };
+        };
+
+        bsl::ut_scenario{"isxdigit"} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::isxdigit('0'));
+                bsl::ut_check(bsl::isxdigit('9'));
+                bsl::ut_check(bsl::isxdigit('a'));
+                bsl::ut_check(bsl::isxdigit('f'));
+                bsl::ut_check(bsl::isxdigit('A'));
+                bsl::ut_check(bsl::isxdigit('F'));
+                bsl::ut_check(!bsl::isxdigit('g'));
+                bsl::ut_check(!bsl::isxdigit('G'));
+                bsl::ut_check(!bsl::isxdigit('@'));
+                bsl::ut_check(!bsl::isxdigit('`'));
+            };
+        };
+
+        bsl::ut_scenario{"isalpha"} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::isalpha('a'));
+                bsl::ut_check(bsl::isalpha('z'));
+                bsl::ut_check(bsl::isalpha('A'));
+                bsl::ut_check(bsl::isalpha('Z'));
+                bsl::ut_check(!bsl::isalpha('0'));
+                bsl::ut_check(!bsl::isalpha('['));
+                bsl::ut_check(!bsl::isalpha('{'));
+            };
+        };
+
+        bsl::ut_scenario{"isalnum"} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::isalnum('a'));
+                bsl::ut_check(bsl::isalnum('Z'));
+                bsl::ut_check(bsl::isalnum('5'));
+                bsl::ut_check(!bsl::isalnum('_'));
+                bsl::ut_check(!bsl::isalnum(' '));
+            };
+        };
+
+        bsl::ut_scenario{"ispunct"} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::ispunct('!'));
+                bsl::ut_check(bsl::ispunct('/'));
+                bsl::ut_check(bsl::ispunct(':'));
+                bsl::ut_check(bsl::ispunct('@'));
+                bsl::ut_check(bsl::ispunct('['));
+                bsl::ut_check(bsl::ispunct('`'));
+                bsl::ut_check(bsl::ispunct('{'));
+                bsl::ut_check(bsl::ispunct('~'));
+                bsl::ut_check(!bsl::ispunct(' '));
+                bsl::ut_check(!bsl::ispunct('a'));
+                bsl::ut_check(!bsl::ispunct('0'));
+                bsl::ut_check(!bsl::ispunct(static_cast<bsl::char_type>(0x7F)));
+            };
+        };
+
+        bsl::ut_scenario{"digit_value"} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::digit_value('0') == 0_u8);
+                bsl::ut_check(bsl::digit_value('9') == 9_u8);
+                bsl::ut_check(bsl::digit_value('a') == 10_u8);
+                bsl::ut_check(bsl::digit_value('A') == 10_u8);
+                bsl::ut_check(bsl::digit_value('f') == 15_u8);
+                bsl::ut_check(bsl::digit_value('F') == 15_u8);
+                bsl::ut_check(bsl::digit_value('z') == 35_u8);
+                bsl::ut_check(bsl::digit_value('Z') == 35_u8);
+                bsl::ut_check(bsl::digit_value(' ') == 0xFF_u8);
+                bsl::ut_check(bsl::digit_value('/') == 0xFF_u8);
+                bsl::ut_check(bsl::digit_value(':') == 0xFF_u8);
+                bsl::ut_check(bsl::digit_value(static_cast<bsl::char_type>(0xFF)) == 0xFF_u8);
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
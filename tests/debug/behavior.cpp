@@ -160,6 +160,51 @@ namespace
             };
         };
 
+        bsl::ut_scenario{"lazy statements from constexpr"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_uintmax mut_calls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::print<bsl::V>([&](auto const o) noexcept {
+                        o << ++mut_calls << '\n';
+                    });
+                    bsl::debug<bsl::V>([&](auto const o) noexcept {
+                        o << ++mut_calls << '\n';
+                    });
+                    bsl::alert<bsl::V>([&](auto const o) noexcept {
+                        o << ++mut_calls << '\n';
+                    });
+                    bsl::ut_then{} = [&]() noexcept {
+                        if (bsl::debug_level_is_at_least_v()) {
+                            bsl::ut_check(mut_calls == static_cast<bsl::uintmax>(3));
+                        }
+                        else {
+                            bsl::ut_check(mut_calls.is_zero());
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"disabled lazy statements from constexpr"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_uintmax mut_calls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::print<42>([&](auto const o) noexcept {
+                        o << ++mut_calls << '\n';
+                    });
+                    bsl::debug<42>([&](auto const o) noexcept {
+                        o << ++mut_calls << '\n';
+                    });
+                    bsl::alert<42>([&](auto const o) noexcept {
+                        o << ++mut_calls << '\n';
+                    });
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_calls.is_zero());
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -76,6 +76,11 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(bsl::alert<42>() << 42));
                 static_assert(noexcept(bsl::alert<42>() << nullptr));
                 static_assert(noexcept(bsl::alert<42>() << &val));
+                static_assert(noexcept(bsl::print([](auto const) noexcept {})));
+                static_assert(noexcept(bsl::debug([](auto const) noexcept {})));
+                static_assert(noexcept(bsl::alert([](auto const) noexcept {})));
+                static_assert(noexcept(bsl::debug<42>([](auto const) noexcept {})));
+                static_assert(noexcept(bsl::alert<42>([](auto const) noexcept {})));
             };
         };
     };
@@ -0,0 +1,168 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/fast_divisor.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Returns true if dividing val by div using a
+    ///     bsl::fast_divisor results in the same quotient and remainder as
+    ///     the bsl::safe_integral operators.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///   @param val the dividend
+    ///   @param div the divisor
+    ///   @return Returns true if the results are the same
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    same_as_safe(safe_integral<T> const &val, safe_integral<T> const &div) noexcept -> bool
+    {
+        fast_divisor<T> const fdiv{div};
+        if (val / fdiv != val / div) {
+            return false;
+        }
+
+        return val % fdiv == val % div;
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    tests_fast_divisor() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"small divisors"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr T num{static_cast<T>(100)};
+                bsl::ut_then{} = [&]() noexcept {
+                    for (T mut_div{static_cast<T>(1)}; mut_div < num; ++mut_div) {
+                        for (T mut_val{}; mut_val < num; ++mut_val) {
+                            bsl::ut_check(same_as_safe(
+                                safe_integral<T>{mut_val}, safe_integral<T>{mut_div}));
+                        }
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"large values"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr T max{numeric_limits<T>::max()};
+                constexpr T half{static_cast<T>(max >> static_cast<T>(1))};
+                constexpr T seven{static_cast<T>(7)};
+                constexpr T one{static_cast<T>(1)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::array const vals{
+                        safe_integral<T>{max},
+                        safe_integral<T>{static_cast<T>(max - one)},
+                        safe_integral<T>{half},
+                        safe_integral<T>{static_cast<T>(half + one)},
+                        safe_integral<T>{seven}};
+
+                    for (auto const &val : vals) {
+                        for (auto const &div : vals) {
+                            bsl::ut_check(same_as_safe(*val.data, *div.data));
+                        }
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"get"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                fast_divisor<T> const fdiv{static_cast<T>(42)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(fdiv.get() == static_cast<T>(42));
+                    bsl::ut_check(!fdiv.invalid());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_fast_divisor<bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_fast_divisor<bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_fast_divisor<bsl::uint32>() == bsl::ut_success());
+    static_assert(bsl::tests_fast_divisor<bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_fast_divisor<bsl::uintmax>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_fast_divisor<bsl::uint8>());
+    bsl::discard(bsl::tests_fast_divisor<bsl::uint16>());
+    bsl::discard(bsl::tests_fast_divisor<bsl::uint32>());
+    bsl::discard(bsl::tests_fast_divisor<bsl::uint64>());
+    bsl::discard(bsl::tests_fast_divisor<bsl::uintmax>());
+
+    bsl::ut_scenario{"invalid divisors"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::fast_divisor<bsl::uintmax> const fdiv1{};
+            bsl::fast_divisor<bsl::uintmax> const fdiv2{static_cast<bsl::uintmax>(0)};
+            bsl::fast_divisor<bsl::uintmax> const fdiv3{bsl::safe_uintmax::failure()};
+            bsl::fast_divisor<bsl::uintmax> const fdiv4{static_cast<bsl::uintmax>(3)};
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(42)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(fdiv1.invalid());
+                bsl::ut_check(fdiv2.invalid());
+                bsl::ut_check(fdiv3.invalid());
+                bsl::ut_check(fdiv1.get().invalid());
+                bsl::ut_check((val / fdiv1).invalid());
+                bsl::ut_check((val % fdiv2).invalid());
+                bsl::ut_check((val / fdiv3).invalid());
+                bsl::ut_check((bsl::safe_uintmax::failure() / fdiv4).invalid());
+                bsl::ut_check((bsl::safe_uintmax::failure() % fdiv4).invalid());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,75 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/fast_divisor.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::fast_divisor<bsl::uintmax> const fdiv{};
+            bsl::safe_uintmax const val{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(bsl::fast_divisor<bsl::uintmax>{}));
+                static_assert(noexcept(bsl::fast_divisor<bsl::uintmax>{val}));
+                static_assert(noexcept(bsl::fast_divisor<bsl::uintmax>{val.get()}));
+                static_assert(noexcept(fdiv.get()));
+                static_assert(noexcept(fdiv.invalid()));
+                static_assert(noexcept(fdiv.div(val)));
+                static_assert(noexcept(fdiv.mod(val)));
+                static_assert(noexcept(val / fdiv));
+                static_assert(noexcept(val % fdiv));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            constexpr bsl::fast_divisor<bsl::uintmax> fdiv{static_cast<bsl::uintmax>(7)};
+            constexpr bsl::safe_uintmax val{static_cast<bsl::uintmax>(100)};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(fdiv.get() == static_cast<bsl::uintmax>(7));
+                static_assert(!fdiv.invalid());
+                static_assert(fdiv.div(val) == static_cast<bsl::uintmax>(14));
+                static_assert(fdiv.mod(val) == static_cast<bsl::uintmax>(2));
+                static_assert(val / fdiv == static_cast<bsl::uintmax>(14));
+                static_assert(val % fdiv == static_cast<bsl::uintmax>(2));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -426,6 +426,53 @@ namespace
             };
         };
 
+        bsl::ut_scenario{"is_valid"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bsl::fmt_options::is_valid("", bsl::to_umax(0)));
+                    bsl::ut_check(bsl::fmt_options::is_valid("x", bsl::to_umax(1)));
+                    bsl::ut_check(bsl::fmt_options::is_valid("<", bsl::to_umax(1)));
+                    bsl::ut_check(bsl::fmt_options::is_valid("#010x", bsl::to_umax(5)));
+                    bsl::ut_check(bsl::fmt_options::is_valid("*^+#0999d", bsl::to_umax(9)));
+                    bsl::ut_check(bsl::fmt_options::is_valid("<<", bsl::to_umax(2)));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(!bsl::fmt_options::is_valid("Hello World", bsl::to_umax(11)));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("1000", bsl::to_umax(4)));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("xx", bsl::to_umax(2)));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("0#x", bsl::to_umax(3)));
+                    bsl::ut_check(!bsl::fmt_options::is_valid("o", bsl::to_umax(1)));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"literal"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr auto ops{"#<+#010d"_fmt};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check('#' == ops.fill());
+                    bsl::ut_check(bsl::fmt_align::fmt_align_left == ops.align());
+                    bsl::ut_check(bsl::fmt_sign::fmt_sign_pos_neg == ops.sign());
+                    bsl::ut_check(ops.alternate_form());
+                    bsl::ut_check(ops.sign_aware());
+                    bsl::ut_check(ops.width() == bsl::to_umax(10));
+                    bsl::ut_check(bsl::fmt_type::fmt_type_d == ops.type());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                constexpr auto ops{""_fmt};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(bsl::fmt_align::fmt_align_default == ops.align());
+                    bsl::ut_check(ops.width() == bsl::to_umax(0));
+                    bsl::ut_check(bsl::fmt_type::fmt_type_default == ops.type());
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
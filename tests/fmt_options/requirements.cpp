@@ -52,6 +52,9 @@ main() noexcept -> bsl::exit_code
             bsl::fmt_options const ops{""};
             bsl::ut_then{} = []() noexcept {
                 static_assert(noexcept(bsl::fmt_options{""}));
+                static_assert(noexcept(bsl::fmt_options{"", bsl::to_umax(0)}));
+                static_assert(noexcept(bsl::fmt_options::is_valid("", bsl::to_umax(0))));
+                static_assert(noexcept("#010x"_fmt));
 
                 static_assert(noexcept(mut_ops.fill()));
                 static_assert(noexcept(mut_ops.set_fill(' ')));
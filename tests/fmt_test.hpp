@@ -27,6 +27,7 @@
 
 #define BSL_DETAILS_PUTC_STDOUT_HPP
 #define BSL_DETAILS_PUTS_STDOUT_HPP
+#define BSL_DETAILS_WRITE_STDOUT_HPP
 
 #include <bsl/array.hpp>
 #include <bsl/char_type.hpp>
@@ -129,6 +130,22 @@ namespace bsl::details
             putc_stdout(str[mut_i.get()]);
         }
     }
+
+    /// <!-- description -->
+    ///   @brief Outputs "len" characters from the provided buffer to
+    ///     stdout.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters to output to stdout
+    ///   @param len the total number of characters in buf to output
+    ///
+    inline void
+    write_stdout(bsl::char_type const *const buf, bsl::safe_uintmax const &len) noexcept
+    {
+        for (bsl::safe_uintmax mut_i{}; mut_i < len; ++mut_i) {
+            putc_stdout(buf[mut_i.get()]);
+        }
+    }
 }
 
 #endif
@@ -0,0 +1,290 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstring.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/fmt.hpp>
+#include <bsl/format_to.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the buffers used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(32)};
+    /// @brief defines the size of the small buffers used for testing
+    constexpr bsl::uintmax SMALL_SIZE{static_cast<bsl::uintmax>(4)};
+    /// @brief defines the size of the buffers used to test fills
+    constexpr bsl::uintmax FILL_SIZE{static_cast<bsl::uintmax>(256)};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided buffer starts with the
+    ///     provided string, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the buffer to compare
+    ///   @param str the string to compare with
+    ///   @return Returns true if the provided buffer starts with the
+    ///     provided string, false otherwise.
+    ///
+    [[nodiscard]] auto
+    buf_starts_with(bsl::char_type const *const buf, bsl::cstr_type const str) noexcept -> bool
+    {
+        return bsl::string_view{buf}.starts_with(str);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided buffer contains "count"
+    ///     copies of the provided character starting at "pos", false
+    ///     otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the buffer to check
+    ///   @param pos the position in the buffer to start checking from
+    ///   @param count the total number of characters to check
+    ///   @param c the character to check for
+    ///   @return Returns true if the provided buffer contains "count"
+    ///     copies of the provided character starting at "pos", false
+    ///     otherwise.
+    ///
+    [[nodiscard]] auto
+    buf_fill_is(
+        bsl::array<bsl::char_type, FILL_SIZE> const &buf,
+        bsl::safe_uintmax const &pos,
+        bsl::safe_uintmax const &count,
+        bsl::char_type const c) noexcept -> bool
+    {
+        for (bsl::safe_uintmax mut_i{pos}; mut_i < pos + count; ++mut_i) {
+            if (c != *buf.at_if(mut_i)) {
+                return false;
+            }
+
+            bsl::touch();
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the buffer to compare
+    ///   @param str the string to compare with
+    ///   @return Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    [[nodiscard]] auto
+    buf_is(bsl::char_type const *const buf, bsl::cstr_type const str) noexcept -> bool
+    {
+        return bsl::string_view{buf} == str;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"format into an array"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << "val: " << bsl::fmt{"#06x", 0x2A_u32} << ' ' << -42_i32;
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 15_umax);
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(mut_buf.data(), "val: 0x002A -42"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << true << ',' << bsl::string_view{"sv"} << ',' << bsl::errc_failure << ','
+                      << nullptr;
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(mut_buf.data(), "true,sv,-1,nullptr"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"format into a pointer and size"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(
+                    mut_buf.data(), mut_buf.size(), [](auto const o) noexcept {
+                        o << bsl::fmt{">5", 42_u8};
+                    })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 5_umax);
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(mut_buf.data(), "   42"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"truncation"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, SMALL_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << "hello";
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 3_umax);
+                    bsl::ut_check(ret.truncated);
+                    bsl::ut_check(buf_is(mut_buf.data(), "hel"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, SMALL_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << 123_u32;
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 3_umax);
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(mut_buf.data(), "123"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"wide fills"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, FILL_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << bsl::fmt{"*^150", 42_u8};
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 150_umax);
+                    bsl::ut_check(buf_fill_is(mut_buf, 0_umax, 74_umax, '*'));
+                    bsl::ut_check(buf_starts_with(mut_buf.at_if(74_umax), "42*"));
+                    bsl::ut_check(buf_fill_is(mut_buf, 76_umax, 74_umax, '*'));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, FILL_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << bsl::fmt{"#0150x", 0x2A_u32};
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 150_umax);
+                    bsl::ut_check(buf_starts_with(mut_buf.data(), "0x0"));
+                    bsl::ut_check(buf_fill_is(mut_buf, 2_umax, 146_umax, '0'));
+                    bsl::ut_check(buf_is(mut_buf.at_if(148_umax), "2A"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, FILL_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << bsl::fmt{"<128", "x"} << '|';
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 129_umax);
+                    bsl::ut_check(buf_starts_with(mut_buf.data(), "x "));
+                    bsl::ut_check(buf_fill_is(mut_buf, 1_umax, 127_umax, ' '));
+                    bsl::ut_check(buf_is(mut_buf.at_if(128_umax), "|"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"nested calls"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_outer{};
+            bsl::array<bsl::char_type, TEST_SIZE> mut_inner{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_outer, [&mut_inner](auto const o) noexcept {
+                    o << "a";
+                    bsl::discard(bsl::format_to(mut_inner, [](auto const o2) noexcept {
+                        o2 << "b";
+                    }));
+                    o << "c";
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count == 2_umax);
+                    bsl::ut_check(buf_is(mut_outer.data(), "ac"));
+                    bsl::ut_check(buf_is(mut_inner.data(), "b"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"invalid arguments"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_then{} = [&]() noexcept {
+                auto const ret1{bsl::format_to(nullptr, 1_umax, [](auto const o) noexcept {
+                    o << "x";
+                })};
+                bsl::ut_check(ret1.truncated);
+
+                auto const ret2{bsl::format_to(mut_buf.data(), 0_umax, [](auto const o) noexcept {
+                    o << "x";
+                })};
+                bsl::ut_check(ret2.truncated);
+
+                auto const ret3{bsl::format_to(
+                    mut_buf.data(), bsl::safe_uintmax::failure(), [](auto const o) noexcept {
+                        o << "x";
+                    })};
+                bsl::ut_check(ret3.truncated);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,181 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/fused_integral.hpp>
+#include <bsl/is_signed.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    tests_fused() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"chains"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                safe_integral<T> const base{static_cast<T>(10)};
+                safe_integral<T> const idx{static_cast<T>(3)};
+                safe_integral<T> const stride{static_cast<T>(4)};
+                safe_integral<T> const off{static_cast<T>(2)};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const res1{(make_fused(base) + idx * make_fused(stride) + off).to_safe()};
+                    bsl::ut_check(res1 == base + idx * stride + off);
+                    auto const res2{(make_fused(base) - idx - stride + off * off).to_safe()};
+                    bsl::ut_check(res2 == static_cast<T>(7));
+                    auto const res3{
+                        (static_cast<T>(2) * make_fused(idx) - static_cast<T>(1)).to_safe()};
+                    bsl::ut_check(res3 == static_cast<T>(5));
+                    auto const res4{(make_fused(static_cast<T>(1)) + make_fused(idx)).to_safe()};
+                    bsl::ut_check(res4 == static_cast<T>(4));
+                    bsl::ut_check(fused_integral<T>{}.to_safe() == static_cast<T>(0));
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                fused_integral<T> mut_val{static_cast<T>(1)};
+                safe_integral<T> const two{static_cast<T>(2)};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_val += two;
+                    mut_val *= static_cast<T>(3);
+                    mut_val -= make_fused(two);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_val.to_safe() == static_cast<T>(7));
+                    };
+                };
+            };
+        };
+
+        if constexpr (bsl::is_signed<T>::value) {
+            bsl::ut_scenario{"signed chains"} = []() noexcept {
+                bsl::ut_given{} = []() noexcept {
+                    safe_integral<T> const val{static_cast<T>(-3)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const res{(make_fused(val) * val - static_cast<T>(10)).to_safe()};
+                        bsl::ut_check(res == static_cast<T>(-1));
+                    };
+                };
+            };
+        }
+
+        return bsl::ut_success();
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the checks that result in an error, which
+    ///     can only be done at run-time. Each chain results in the same
+    ///     bsl::safe_integral as the unfused version of the chain.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///
+    template<typename T>
+    constexpr void
+    tests_fused_errors() noexcept
+    {
+        bsl::ut_scenario{"errors"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                safe_integral<T> const max{numeric_limits<T>::max()};
+                safe_integral<T> const min{numeric_limits<T>::min()};
+                safe_integral<T> const one{static_cast<T>(1)};
+                safe_integral<T> const zero{static_cast<T>(0)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check((make_fused(max) + one).to_safe().invalid());
+                    bsl::ut_check((make_fused(min) - one).to_safe().invalid());
+                    bsl::ut_check((make_fused(max) * max).to_safe().invalid());
+                    bsl::ut_check((make_fused(max) + one - one).to_safe().invalid());
+                    bsl::ut_check((make_fused(min) - one + one).to_safe().invalid());
+                    bsl::ut_check((make_fused(max) * max * zero).to_safe().invalid());
+                    bsl::ut_check((max + one - one).invalid());
+                    bsl::ut_check((max * max * zero).invalid());
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                safe_integral<T> const bad{safe_integral<T>::failure()};
+                safe_integral<T> const one{static_cast<T>(1)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(make_fused(bad).to_safe().invalid());
+                    bsl::ut_check((make_fused(one) + bad).to_safe().invalid());
+                    bsl::ut_check((bad * make_fused(one)).to_safe().invalid());
+                    bsl::ut_check((make_fused(bad) * static_cast<T>(0)).to_safe().invalid());
+                };
+            };
+        };
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_fused<bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::uint32>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::uintmax>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::int8>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::int16>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::int32>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::int64>() == bsl::ut_success());
+    static_assert(bsl::tests_fused<bsl::intmax>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_fused<bsl::uint8>());
+    bsl::discard(bsl::tests_fused<bsl::uint16>());
+    bsl::discard(bsl::tests_fused<bsl::uint32>());
+    bsl::discard(bsl::tests_fused<bsl::uint64>());
+    bsl::discard(bsl::tests_fused<bsl::uintmax>());
+    bsl::discard(bsl::tests_fused<bsl::int8>());
+    bsl::discard(bsl::tests_fused<bsl::int16>());
+    bsl::discard(bsl::tests_fused<bsl::int32>());
+    bsl::discard(bsl::tests_fused<bsl::int64>());
+    bsl::discard(bsl::tests_fused<bsl::intmax>());
+
+    bsl::tests_fused_errors<bsl::uint8>();
+    bsl::tests_fused_errors<bsl::uintmax>();
+    bsl::tests_fused_errors<bsl::int8>();
+    bsl::tests_fused_errors<bsl::intmax>();
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,78 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/fused_integral.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::fused_uintmax mut_val{};
+            bsl::fused_uintmax const val{};
+            bsl::safe_uintmax const safe{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(bsl::fused_uintmax{}));
+                static_assert(noexcept(bsl::fused_uintmax{static_cast<bsl::uintmax>(42)}));
+                static_assert(noexcept(bsl::fused_uintmax{safe}));
+                static_assert(noexcept(val.to_safe()));
+                static_assert(noexcept(mut_val += val));
+                static_assert(noexcept(mut_val += safe));
+                static_assert(noexcept(mut_val += static_cast<bsl::uintmax>(42)));
+                static_assert(noexcept(mut_val -= val));
+                static_assert(noexcept(mut_val *= val));
+                static_assert(noexcept(val + val));
+                static_assert(noexcept(val + safe));
+                static_assert(noexcept(safe + val));
+                static_assert(noexcept(val - static_cast<bsl::uintmax>(42)));
+                static_assert(noexcept(static_cast<bsl::uintmax>(42) * val));
+                static_assert(noexcept(bsl::make_fused(safe)));
+                static_assert(noexcept(bsl::make_fused(static_cast<bsl::uintmax>(42))));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            constexpr bsl::fused_uintmax val{static_cast<bsl::uintmax>(42)};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(val.to_safe() == static_cast<bsl::uintmax>(42));
+                static_assert((val + val).to_safe() == static_cast<bsl::uintmax>(84));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,216 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/format_to.hpp>
+#include <bsl/hexdump.hpp>
+#include <bsl/span.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the output buffers used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(512)};
+    /// @brief defines the total number of bytes dumped by the tests
+    constexpr bsl::uintmax NUM_BYTES{static_cast<bsl::uintmax>(20)};
+
+    /// <!-- description -->
+    ///   @brief Returns an array of bytes where each byte is its own
+    ///     index plus the provided offset.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param offset the value of the first byte
+    ///   @return Returns the resulting array
+    ///
+    [[nodiscard]] constexpr auto
+    make_bytes(bsl::uint8 const offset) noexcept -> bsl::array<bsl::uint8, NUM_BYTES>
+    {
+        bsl::array<bsl::uint8, NUM_BYTES> mut_bytes{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < mut_bytes.size(); ++mut_i) {
+            *mut_bytes.at_if(mut_i) = static_cast<bsl::uint8>(mut_i.get() + offset);
+        }
+
+        return mut_bytes;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the buffer to compare
+    ///   @param str the string to compare with
+    ///   @return Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    [[nodiscard]] auto
+    buf_is(bsl::char_type const *const buf, bsl::cstr_type const str) noexcept -> bool
+    {
+        return bsl::string_view{buf} == str;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"hexdump"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            auto const bytes{make_bytes(static_cast<bsl::uint8>(0))};
+            bsl::hexdump const dump{bsl::span<bsl::uint8 const>{bytes}, 0x1000_umax};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(dump.buf().data() == bytes.data());
+                bsl::ut_check(dump.buf().size() == NUM_BYTES);
+                bsl::ut_check(dump.base() == 0x1000_umax);
+            };
+        };
+
+        bsl::ut_given{} = []() noexcept {
+            constexpr bsl::hexdump dump{bsl::span<bsl::uint8 const>{}};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(dump.buf().empty());
+                static_assert(dump.base().is_zero());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"hexdump_printable"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(
+                    '.' == bsl::details::hexdump_printable(static_cast<bsl::uint8>(0x00)));
+                static_assert(
+                    '.' == bsl::details::hexdump_printable(static_cast<bsl::uint8>(0x1F)));
+                static_assert(
+                    ' ' == bsl::details::hexdump_printable(static_cast<bsl::uint8>(0x20)));
+                static_assert(
+                    'A' == bsl::details::hexdump_printable(static_cast<bsl::uint8>(0x41)));
+                static_assert(
+                    '~' == bsl::details::hexdump_printable(static_cast<bsl::uint8>(0x7E)));
+                static_assert(
+                    '.' == bsl::details::hexdump_printable(static_cast<bsl::uint8>(0x7F)));
+                static_assert(
+                    '.' == bsl::details::hexdump_printable(static_cast<bsl::uint8>(0xFF)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"output"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    o << bsl::hexdump{bsl::span<bsl::uint8 const>{}, 0x1000_umax};
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count.is_zero());
+                    bsl::ut_check(buf_is(mut_buf.data(), ""));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    constexpr auto bytes{make_bytes(static_cast<bsl::uint8>(0x38))};
+                    o << bsl::hexdump{bsl::span<bsl::uint8 const>{bytes}, 0xFFFF8000000010F0_umax};
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(
+                        mut_buf.data(),
+                        "FFFF8000000010F0  38 39 3A 3B 3C 3D 3E 3F  40 41 42 43 44 45 46 47  "
+                        "|89:;<=>?@ABCDEFG|\n"
+                        "FFFF800000001100  48 49 4A 4B                                       "
+                        "|HIJK            |\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    constexpr auto bytes{make_bytes(static_cast<bsl::uint8>(0xF0))};
+                    bsl::span<bsl::uint8 const> const all{bytes};
+                    o << bsl::hexdump{all.first(16_umax)};
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(
+                        mut_buf.data(),
+                        "0000000000000000  F0 F1 F2 F3 F4 F5 F6 F7  F8 F9 FA FB FC FD FE FF  "
+                        "|................|\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    constexpr auto bytes{make_bytes(static_cast<bsl::uint8>(0x38))};
+                    o << bsl::hexdump{bsl::span<bsl::uint8 const>{bytes}, 0xFFFFFFFFFFFFFFF8_umax};
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(
+                        mut_buf.data(),
+                        "FFFFFFFFFFFFFFF8  38 39 3A 3B 3C 3D 3E 3F  40 41 42 43 44 45 46 47  "
+                        "|89:;<=>?@ABCDEFG|\n"
+                        "0000000000000008  48 49 4A 4B                                       "
+                        "|HIJK            |\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    constexpr auto bytes{make_bytes(static_cast<bsl::uint8>(0x38))};
+                    o << bsl::hexdump{bsl::span<bsl::uint8 const>{bytes}, bsl::safe_uintmax::failure()};
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count.is_zero());
+                    bsl::ut_check(buf_is(mut_buf.data(), ""));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,200 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/details/out_type_buffer.hpp>
+#include <bsl/format_to.hpp>
+#include <bsl/json.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/source_location.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the output buffers used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(256)};
+
+    /// @brief defines the type of record used for testing
+    using record_type = bsl::json_record<bsl::details::out_type_buffer>;
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the buffer to compare
+    ///   @param str the string to compare with
+    ///   @return Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    [[nodiscard]] auto
+    buf_is(bsl::char_type const *const buf, bsl::cstr_type const str) noexcept -> bool
+    {
+        return bsl::string_view{buf} == str;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"kv"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            auto const val{42_i32};
+            auto const pair{bsl::kv("answer", val)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::string_view{pair.key()} == "answer");
+                bsl::ut_check(&pair.val() == &val);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"json_escape_char"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::array<bsl::char_type, bsl::details::JSON_ESCAPE_SIZE.get()> mut_esc{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::details::json_escape_char('a', mut_esc).is_zero());
+                bsl::ut_check(bsl::details::json_escape_char(' ', mut_esc).is_zero());
+                bsl::ut_check(bsl::details::json_escape_char('\x7F', mut_esc).is_zero());
+                bsl::ut_check(bsl::details::json_escape_char('\x80', mut_esc).is_zero());
+                bsl::ut_check(bsl::details::json_escape_char('"', mut_esc) == 2_umax);
+                bsl::ut_check(*mut_esc.at_if(1_umax) == '"');
+                bsl::ut_check(bsl::details::json_escape_char('\\', mut_esc) == 2_umax);
+                bsl::ut_check(*mut_esc.at_if(1_umax) == '\\');
+                bsl::ut_check(bsl::details::json_escape_char('\f', mut_esc) == 2_umax);
+                bsl::ut_check(*mut_esc.at_if(1_umax) == 'f');
+                bsl::ut_check(bsl::details::json_escape_char('\x1B', mut_esc) == 6_umax);
+                bsl::ut_check(*mut_esc.at_if(4_umax) == '1');
+                bsl::ut_check(*mut_esc.at_if(5_umax) == 'B');
+            };
+        };
+    };
+
+    bsl::ut_scenario{"record"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    bsl::discard(o);
+                    record_type const rec{"test", bsl::source_location{}};
+                    bsl::discard(rec);
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(
+                        buf_is(mut_buf.data(), "{\"lvl\":\"test\",\"file\":\"unknown\",\"line\":-1}\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    bsl::discard(o);
+                    record_type{"test", bsl::source_location{}}         // --
+                        << bsl::kv("u", 42_u32)                           // --
+                        << bsl::kv("i", static_cast<bsl::int32>(-42))    // --
+                        << bsl::kv("err", bsl::safe_uintmax::failure())  // --
+                        << bsl::kv("b", true)                            // --
+                        << bsl::kv("c", 'x')                             // --
+                        << bsl::kv("n", nullptr);
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(
+                        mut_buf.data(),
+                        "{\"lvl\":\"test\",\"file\":\"unknown\",\"line\":-1,"
+                        "\"u\":42,\"i\":-42,\"err\":null,\"b\":true,\"c\":\"x\",\"n\":null}\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    bsl::discard(o);
+                    bsl::cstr_type const null_str{};
+                    record_type{"test", bsl::source_location{}}                 // --
+                        << bsl::kv("s", "plain")                                  // --
+                        << bsl::kv("e", "a\"b\\c\nd\te\x01")                      // --
+                        << bsl::kv("sv", bsl::string_view{"\"quoted\""})         // --
+                        << bsl::kv("c", '\n')                                     // --
+                        << bsl::kv("null", null_str)                              // --
+                        << bsl::kv("k\"", "");
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!ret.truncated);
+                    bsl::ut_check(buf_is(
+                        mut_buf.data(),
+                        "{\"lvl\":\"test\",\"file\":\"unknown\",\"line\":-1,"
+                        "\"s\":\"plain\",\"e\":\"a\\\"b\\\\c\\nd\\te\\u0001\","
+                        "\"sv\":\"\\\"quoted\\\"\",\"c\":\"\\n\",\"null\":null,\"k\\\"\":\"\"}\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+                    bsl::discard(o);
+                    bsl::json_record<bsl::details::out_type_empty>{"test", bsl::here()}
+                        << bsl::kv("u", 42_u32);
+                })};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(ret.count.is_zero());
+                    bsl::ut_check(buf_is(mut_buf.data(), ""));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"factories"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::print_json() << bsl::kv("test", "print_json");
+                bsl::debug_json() << bsl::kv("test", "debug_json");
+                bsl::alert_json() << bsl::kv("test", "alert_json");
+                bsl::error_json() << bsl::kv("test", "error_json");
+                bsl::debug_json<bsl::VVV>() << bsl::kv("test", "debug_json<VVV>");
+                bsl::alert_json<bsl::VVV>() << bsl::kv("test", "alert_json<VVV>");
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,264 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/log_category.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines a category used for testing
+    constexpr bsl::log_category CAT_A{static_cast<bsl::uintmax>(0), "cat_a"};
+    /// @brief defines a category used for testing
+    constexpr bsl::log_category CAT_B{static_cast<bsl::uintmax>(63), "cat_b"};
+
+    /// @brief defines the list of categories used for testing
+    constexpr auto CATS{bsl::make_log_categories(CAT_A, CAT_B)};
+
+    /// @brief stores the total number of times count() was called
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit bsl::safe_uintmax g_mut_calls{};
+
+    /// <!-- description -->
+    ///   @brief Counts the total number of times this function is called
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of times this function was called
+    ///
+    [[nodiscard]] auto
+    count() noexcept -> bsl::safe_uintmax
+    {
+        ++g_mut_calls;
+        return g_mut_calls;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"log_category"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(CAT_A.id() == 0_umax);
+                static_assert(CAT_B.id() == 63_umax);
+                static_assert(bsl::string_view{CAT_A.name()} == "cat_a");
+                static_assert(!CAT_A.is_enabled<bsl::CRITICAL_ONLY>());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"categories start at BSL_DEBUG_LEVEL"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::log_level(CAT_A) == bsl::to_umax(BSL_DEBUG_LEVEL));
+                bsl::ut_check(bsl::log_level(CAT_B) == bsl::to_umax(BSL_DEBUG_LEVEL));
+                bsl::ut_check(CAT_A.is_enabled<BSL_DEBUG_LEVEL>());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"set_log_level"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::VV));
+                bsl::set_log_level(CAT_B, bsl::to_umax(bsl::CRITICAL_ONLY));
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bsl::log_level(CAT_A) == bsl::to_umax(bsl::VV));
+                    bsl::ut_check(CAT_A.is_enabled<bsl::V>());
+                    bsl::ut_check(CAT_A.is_enabled<bsl::VV>());
+                    bsl::ut_check(!CAT_A.is_enabled<bsl::VVV>());
+                    bsl::ut_check(CAT_B.is_enabled<bsl::CRITICAL_ONLY>());
+                    bsl::ut_check(!CAT_B.is_enabled<bsl::V>());
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bsl::set_log_level(CAT_A, bsl::to_umax(bsl::V)));
+                    bsl::ut_check(!bsl::set_log_level(CAT_A, bsl::to_umax(4)));
+                    bsl::ut_check(!bsl::set_log_level(CAT_A, bsl::safe_uintmax::failure()));
+                    bsl::ut_check(bsl::log_level(CAT_A) == bsl::to_umax(bsl::V));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bsl::set_log_level(CATS, "cat_b", bsl::to_umax(bsl::VVV)));
+                    bsl::ut_check(bsl::log_level(CAT_B) == bsl::to_umax(bsl::VVV));
+                    bsl::ut_check(!bsl::set_log_level(CATS, "cat_c", bsl::to_umax(bsl::V)));
+                    bsl::ut_check(!bsl::set_log_level(CATS, "cat_b", bsl::to_umax(7)));
+                    bsl::ut_check(bsl::log_level(CAT_B) == bsl::to_umax(bsl::VVV));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"disabled statements do not evaluate their arguments"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::V));
+                g_mut_calls = static_cast<bsl::uintmax>(0);
+
+                if (auto const o{bsl::debug<bsl::VV>(CAT_A)}) {
+                    o << count() << bsl::endl;
+                }
+
+                if (auto const o{bsl::alert<bsl::VVV>(CAT_A)}) {
+                    o << count() << bsl::endl;
+                }
+
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_calls.is_zero());
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::V));
+                g_mut_calls = static_cast<bsl::uintmax>(0);
+
+                if (auto const o{bsl::debug<bsl::V>(CAT_A)}) {
+                    o << count() << bsl::endl;
+                }
+
+                bsl::alert<bsl::V>(CAT_A) << count() << bsl::endl;
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_calls == 2_umax);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"deferred arguments are only evaluated if enabled"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::V));
+                g_mut_calls = static_cast<bsl::uintmax>(0);
+
+                bsl::debug<bsl::VV>(CAT_A) << []() noexcept {
+                    return count();
+                } << bsl::endl;
+
+                bsl::alert<bsl::VVV>(CAT_A) << []() noexcept {
+                    return count();
+                } << bsl::endl;
+
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_calls.is_zero());
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::V));
+                g_mut_calls = static_cast<bsl::uintmax>(0);
+
+                bsl::debug<bsl::V>(CAT_A) << []() noexcept {
+                    return count();
+                } << bsl::endl;
+
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_calls == 1_umax);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"statements above BSL_LOG_MAX_LEVEL are removed"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::VVV));
+                bsl::ut_then{} = []() noexcept {
+                    constexpr bool expected{bsl::VVV <= BSL_LOG_MAX_LEVEL};
+                    if (auto const o{bsl::debug<bsl::VVV>(CAT_A)}) {
+                        o << bsl::endl;
+                        bsl::ut_check(expected);
+                    }
+                    else {
+                        bsl::ut_check(!expected);
+                    }
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"lazy statements only evaluate their arguments if enabled"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::V));
+                g_mut_calls = static_cast<bsl::uintmax>(0);
+
+                bsl::debug<bsl::VV>(CAT_A, [](auto const o) noexcept {
+                    o << count() << bsl::endl;
+                });
+
+                bsl::alert<bsl::VVV>(CAT_A, [](auto const o) noexcept {
+                    o << count() << bsl::endl;
+                });
+
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_calls.is_zero());
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                bsl::set_log_level(CAT_A, bsl::to_umax(bsl::V));
+                g_mut_calls = static_cast<bsl::uintmax>(0);
+
+                bsl::debug<bsl::V>(CAT_A, [](auto const o) noexcept {
+                    o << count() << bsl::endl;
+                });
+
+                bsl::alert<bsl::V>(CAT_A, [](auto const o) noexcept {
+                    o << count() << bsl::endl;
+                });
+
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_calls == 2_umax);
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,75 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/log_category.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines a category used for testing
+    constexpr bsl::log_category CAT{static_cast<bsl::uintmax>(0), "cat"};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::out_if<bsl::details::out_type_debug> const o{false};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(CAT.id()));
+                static_assert(noexcept(CAT.name()));
+                static_assert(noexcept(CAT.is_enabled<bsl::V>()));
+                static_assert(noexcept(bsl::log_level(CAT)));
+                static_assert(noexcept(bsl::set_log_level(CAT, 1_umax)));
+                static_assert(noexcept(bsl::debug<bsl::V>(CAT)));
+                static_assert(noexcept(bsl::alert<bsl::V>(CAT)));
+                static_assert(noexcept(static_cast<bool>(o)));
+                static_assert(noexcept(o << 42));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::out_if<bsl::details::out_type_empty> const o{true};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(!o);
+                bsl::ut_check(CAT.id() == 0_umax);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,241 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/details/log_limit.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/source_location.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines a number of milliseconds that will never pass during a test
+    constexpr bsl::uintmax NEVER_MS{static_cast<bsl::uintmax>(0xFFFFFFFFFFFF)};
+    /// @brief defines the maximum number of attempts before giving up on a refill
+    constexpr bsl::safe_uintmax MAX_ATTEMPTS{static_cast<bsl::uintmax>(0xFFFFFFFF)};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"claim"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::details::log_limit_site mut_site{};
+            bsl::source_location const sloc1{bsl::here()};
+            bsl::source_location const sloc2{bsl::here()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_site.claim(sloc1));
+                bsl::ut_check(mut_site.claim(sloc1));
+                bsl::ut_check(!mut_site.claim(sloc2));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::source_location const sloc1{bsl::here()};
+            bsl::source_location const sloc2{bsl::here()};
+            bsl::ut_then{} = [&]() noexcept {
+                auto const *const site1{&bsl::details::log_limit_find(sloc1)};
+                auto const *const site2{&bsl::details::log_limit_find(sloc2)};
+                bsl::ut_check(site1 != site2);
+                bsl::ut_check(site1 == &bsl::details::log_limit_find(sloc1));
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            constexpr auto first{100000_umax};
+            constexpr auto last{first + bsl::details::LOG_LIMIT_MAX_SITES};
+            bsl::ut_when{} = [&]() noexcept {
+                for (bsl::safe_uintmax mut_i{first}; mut_i <= last; ++mut_i) {
+                    auto const line{bsl::to_i32(mut_i)};
+                    bsl::discard(bsl::details::log_limit_find(
+                        bsl::source_location::current("overflow", "overflow", line.get())));
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const overflow{bsl::source_location::current("overflow", "overflow", 42)};
+                    auto const *const site{&bsl::details::log_limit_find(overflow)};
+                    bsl::ut_check(site == &bsl::details::get_log_limit_overflow_site());
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"limit"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::details::log_limit_site mut_site{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_site.limit<2U, NEVER_MS>());
+                bsl::ut_check(mut_site.limit<2U, NEVER_MS>());
+                bsl::ut_check(!mut_site.limit<2U, NEVER_MS>());
+                bsl::ut_check(!mut_site.limit<2U, NEVER_MS>());
+                bsl::ut_check(mut_site.suppressed() == 2_umax);
+                bsl::ut_check(mut_site.suppressed().is_zero());
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::details::log_limit_site mut_site{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::ut_required_step(mut_site.limit<1U, 1U>());
+
+                bsl::safe_uintmax mut_i{};
+                while (mut_i < MAX_ATTEMPTS) {
+                    if (mut_site.limit<1U, 1U>()) {
+                        break;
+                    }
+
+                    ++mut_i;
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_i < MAX_ATTEMPTS);
+                    bsl::ut_check(mut_site.suppressed() == mut_i);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"tokens are refilled once the interval has passed"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::details::log_limit_site mut_site{};
+            constexpr auto wait_ms{2_umax};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::ut_required_step(mut_site.limit<1U, 1U>());
+                bsl::ut_required_step(!mut_site.limit<1U, 1U>());
+
+                auto const start{bsl::details::monotonic_ms()};
+                while (bsl::details::monotonic_ms() < (start + wait_ms)) {
+                    bsl::touch();
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_site.limit<1U, 1U>());
+                    bsl::ut_check(mut_site.suppressed() == 1_umax);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a flood only delays the refill by a few statements"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::details::log_limit_site mut_site{};
+            constexpr auto flood{64_umax};
+            constexpr auto wait_ms{2_umax};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::ut_required_step(mut_site.limit<1U, 1U>());
+                for (bsl::safe_uintmax mut_i{}; mut_i < flood; ++mut_i) {
+                    bsl::discard(mut_site.limit<1U, 1U>());
+                }
+
+                auto const start{bsl::details::monotonic_ms()};
+                while (bsl::details::monotonic_ms() < (start + wait_ms)) {
+                    bsl::touch();
+                }
+
+                bsl::safe_uintmax mut_i{};
+                while (mut_i <= bsl::details::LOG_LIMIT_MAX_BACKOFF) {
+                    if (mut_site.limit<1U, 1U>()) {
+                        break;
+                    }
+
+                    ++mut_i;
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_i <= bsl::details::LOG_LIMIT_MAX_BACKOFF);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"sample"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::details::log_limit_site mut_site{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_site.sample<3U>());
+                bsl::ut_check(!mut_site.sample<3U>());
+                bsl::ut_check(!mut_site.sample<3U>());
+                bsl::ut_check(mut_site.sample<3U>());
+                bsl::ut_check(!mut_site.sample<3U>());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"limited and sampled statements"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            constexpr auto max{100_umax};
+            bsl::safe_uintmax mut_limited{};
+            bsl::safe_uintmax mut_sampled{};
+            bsl::ut_when{} = [&]() noexcept {
+                for (bsl::safe_uintmax mut_i{}; mut_i < max; ++mut_i) {
+                    if (auto const o{bsl::alert_limited()}) {
+                        o << "limited: " << mut_i << bsl::endl;
+                        ++mut_limited;
+                    }
+
+                    if (auto const o{bsl::alert_sampled<bsl::CRITICAL_ONLY, 25U>()}) {
+                        o << "sampled: " << mut_i << bsl::endl;
+                        ++mut_sampled;
+                    }
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_limited >= bsl::details::LOG_LIMIT_BURST);
+                    bsl::ut_check(mut_limited < max);
+                    bsl::ut_check(mut_sampled == 4_umax);
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax mut_calls{};
+            bsl::ut_when{} = [&]() noexcept {
+                if (auto const o{bsl::debug_limited<42>()}) {
+                    ++mut_calls;
+                }
+
+                if (auto const o{bsl::debug_sampled<42>()}) {
+                    ++mut_calls;
+                }
+
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_calls.is_zero());
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,196 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/is_signed.hpp>
+#include <bsl/mul_div.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    tests_mul_div() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"products that fit"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                safe_integral<T> const lhs{static_cast<T>(10)};
+                safe_integral<T> const rhs{static_cast<T>(12)};
+                safe_integral<T> const div{static_cast<T>(7)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mul_div(lhs, rhs, div) == static_cast<T>(17));
+                    bsl::ut_check(mul_div(rhs, lhs, div) == static_cast<T>(17));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"products that do not fit"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr T max{numeric_limits<T>::max()};
+                safe_integral<T> const lhs{max};
+                safe_integral<T> const rhs{static_cast<T>(3)};
+                safe_integral<T> const div{static_cast<T>(4)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mul_div(lhs, rhs, rhs) == max);
+                    bsl::ut_check(mul_div(lhs, lhs, lhs) == max);
+                    bsl::ut_check(mul_div(lhs, rhs, div) == static_cast<T>((max / 4) * 3 + 2));
+                    if constexpr (is_signed<T>::value) {
+                        bsl::ut_check(mul_div(-lhs, rhs, rhs) == -lhs);
+                        bsl::ut_check(mul_div(-lhs, lhs, -lhs) == lhs);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"64bit products"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr T res{static_cast<T>(0x61172283C444A43)};
+                safe_integral<T> const lhs{static_cast<T>(0x123456789ABCDEF0)};
+                safe_integral<T> const rhs{static_cast<T>(1000000000)};
+                safe_integral<T> const div{static_cast<T>(2999999999)};
+                bsl::ut_then{} = [&]() noexcept {
+                    if constexpr (sizeof(T) == sizeof(bsl::uint64)) {
+                        bsl::ut_check(mul_div(lhs, rhs, div) == res);
+                        if constexpr (is_signed<T>::value) {
+                            constexpr T min{numeric_limits<T>::min()};
+                            safe_integral<T> const two{static_cast<T>(2)};
+                            bsl::ut_check(mul_div(-lhs, rhs, div) == -res);
+                            bsl::ut_check(mul_div(lhs, -rhs, -div) == res);
+                            bsl::ut_check(mul_div(safe_integral<T>{min}, two, two) == min);
+                        }
+                        else {
+                            constexpr T big_res{static_cast<T>(0xFEA788CEF1376D07)};
+                            safe_integral<T> const big{static_cast<T>(0xFEDCBA9876543210)};
+                            safe_integral<T> const mask{static_cast<T>(0xF0F0F0F0F0F0F0F0)};
+                            safe_integral<T> const top{static_cast<T>(0xF123456789ABCDEF)};
+                            safe_integral<T> const top_div{static_cast<T>(0xE3236D88FE5618CD)};
+                            bsl::ut_check(mul_div(big, mask, top) == big_res);
+                            bsl::ut_check(mul_div(top, top, top_div) == numeric_limits<T>::max());
+                        }
+                    }
+                    else {
+                        bsl::discard(res);
+                        bsl::discard(lhs);
+                        bsl::discard(rhs);
+                        bsl::discard(div);
+                    }
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_mul_div<bsl::int8>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::int16>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::int32>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::int64>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::uint32>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_div<bsl::uintmax>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_mul_div<bsl::int8>());
+    bsl::discard(bsl::tests_mul_div<bsl::int16>());
+    bsl::discard(bsl::tests_mul_div<bsl::int32>());
+    bsl::discard(bsl::tests_mul_div<bsl::int64>());
+    bsl::discard(bsl::tests_mul_div<bsl::uint8>());
+    bsl::discard(bsl::tests_mul_div<bsl::uint16>());
+    bsl::discard(bsl::tests_mul_div<bsl::uint32>());
+    bsl::discard(bsl::tests_mul_div<bsl::uint64>());
+    bsl::discard(bsl::tests_mul_div<bsl::uintmax>());
+
+    bsl::ut_scenario{"invalid operands"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(42)};
+            bsl::safe_uintmax const err{bsl::safe_uintmax::failure()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::mul_div(err, val, val).invalid());
+                bsl::ut_check(bsl::mul_div(val, err, val).invalid());
+                bsl::ut_check(bsl::mul_div(val, val, err).invalid());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"divide by zero"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(42)};
+            bsl::safe_uintmax const zero{static_cast<bsl::uintmax>(0)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::mul_div(val, val, zero).invalid());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"result does not fit"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const max{bsl::safe_uintmax::max()};
+            bsl::safe_uintmax const two{static_cast<bsl::uintmax>(2)};
+            bsl::safe_int64 const smax{bsl::safe_int64::max()};
+            bsl::safe_int64 const stwo{static_cast<bsl::int64>(2)};
+            bsl::safe_int64 const smin{bsl::safe_int64::min()};
+            bsl::safe_uintmax const top{static_cast<bsl::uintmax>(0xF123456789ABCDEF)};
+            bsl::safe_uintmax const top_hi{static_cast<bsl::uintmax>(0xE3236D88FE5618CC)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::mul_div(max, max, two).invalid());
+                bsl::ut_check(bsl::mul_div(smax, smax, stwo).invalid());
+                bsl::ut_check(bsl::mul_div(-smax, smax, stwo).invalid());
+                bsl::ut_check(bsl::mul_div(smin, stwo, -stwo).invalid());
+                bsl::ut_check(bsl::mul_div(smin, -stwo, stwo).invalid());
+                bsl::ut_check(bsl::mul_div(top, top, top_hi).invalid());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
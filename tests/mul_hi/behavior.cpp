@@ -0,0 +1,126 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/is_signed.hpp>
+#include <bsl/mul_hi.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    tests_mul_hi() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"products that fit"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                safe_integral<T> const lhs{static_cast<T>(10)};
+                safe_integral<T> const rhs{static_cast<T>(12)};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mul_hi(lhs, rhs) == static_cast<T>(0));
+                    bsl::ut_check(mul_hi(rhs, lhs) == static_cast<T>(0));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"products that do not fit"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                constexpr T max{numeric_limits<T>::max()};
+                safe_integral<T> const lhs{max};
+                safe_integral<T> const rhs{static_cast<T>(2)};
+                safe_integral<T> const two{static_cast<T>(2)};
+                bsl::ut_then{} = [&]() noexcept {
+                    if constexpr (is_signed<T>::value) {
+                        bsl::ut_check(mul_hi(lhs, rhs) == static_cast<T>(0));
+                        bsl::ut_check(mul_hi(lhs, lhs) == static_cast<T>(max >> 1));
+                        bsl::ut_check(mul_hi(-lhs, two) == static_cast<T>(-1));
+                    }
+                    else {
+                        bsl::ut_check(mul_hi(lhs, rhs) == static_cast<T>(1));
+                        bsl::ut_check(mul_hi(lhs, lhs) == static_cast<T>(max - 1));
+                    }
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_mul_hi<bsl::int8>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::int16>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::int32>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::int64>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::uint32>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_mul_hi<bsl::uintmax>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_mul_hi<bsl::int8>());
+    bsl::discard(bsl::tests_mul_hi<bsl::int16>());
+    bsl::discard(bsl::tests_mul_hi<bsl::int32>());
+    bsl::discard(bsl::tests_mul_hi<bsl::int64>());
+    bsl::discard(bsl::tests_mul_hi<bsl::uint8>());
+    bsl::discard(bsl::tests_mul_hi<bsl::uint16>());
+    bsl::discard(bsl::tests_mul_hi<bsl::uint32>());
+    bsl::discard(bsl::tests_mul_hi<bsl::uint64>());
+    bsl::discard(bsl::tests_mul_hi<bsl::uintmax>());
+
+    bsl::ut_scenario{"invalid operands"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(42)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(bsl::mul_hi(bsl::safe_uintmax::failure(), val).invalid());
+                bsl::ut_check(bsl::mul_hi(val, bsl::safe_uintmax::failure()).invalid());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,305 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+// This test always commits lines to the per-thread output rings, no
+// matter how the rest of the tests are configured.
+#undef BSL_OUT_BUFFER_SIZE
+#define BSL_OUT_BUFFER_SIZE 256
+#undef BSL_OUT_RING_SIZE
+#define BSL_OUT_RING_SIZE 4096
+
+#define BSL_DETAILS_WRITE_STDOUT_HPP
+#define BSL_DETAILS_WRITE_STDERR_HPP
+
+#include <bsl/char_type.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstdio.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace
+{
+    /// @brief stores the total number of test lines that have been written
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit bsl::uintmax g_mut_lines{};
+
+    /// <!-- description -->
+    ///   @brief Counts the total number of test lines in a single write.
+    ///     Each test line starts with a '#', which nothing else writes.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters being written
+    ///   @param len the total number of characters in buf
+    ///
+    void
+    capture(bsl::char_type const *const buf, bsl::safe_uintmax const &len) noexcept
+    {
+        bsl::uintmax mut_lines{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < len; ++mut_i) {
+            if ('#' == buf[mut_i.get()]) {
+                ++mut_lines;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        bsl::discard(__atomic_add_fetch(&g_mut_lines, mut_lines, __ATOMIC_RELAXED));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the total number of test lines that have been
+    ///     written.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the total number of test lines that have been
+    ///     written.
+    ///
+    [[nodiscard]] auto
+    lines() noexcept -> bsl::safe_uintmax
+    {
+        return bsl::safe_uintmax{__atomic_load_n(&g_mut_lines, __ATOMIC_RELAXED)};
+    }
+}
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Outputs "len" characters from the provided buffer to
+    ///     stdout using a single write.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters to output to stdout
+    ///   @param len the total number of characters in buf to output
+    ///
+    inline void
+    write_stdout(bsl::char_type const *const buf, bsl::safe_uintmax const &len) noexcept
+    {
+        capture(buf, len);
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs "len" characters from the provided buffer to
+    ///     stderr using a single write.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters to output to stderr
+    ///   @param len the total number of characters in buf to output
+    ///
+    inline void
+    write_stderr(bsl::char_type const *const buf, bsl::safe_uintmax const &len) noexcept
+    {
+        capture(buf, len);
+    }
+}
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/details/out_ring.hpp>
+#include <bsl/ut.hpp>
+
+#include <pthread.h>
+
+namespace
+{
+    /// @brief defines the total number of threads that write lines
+    constexpr bsl::safe_uintmax NUM_THREADS{static_cast<bsl::uintmax>(4)};
+    /// @brief defines the total number of lines each thread writes
+    constexpr bsl::safe_uintmax NUM_LINES{static_cast<bsl::uintmax>(200)};
+    /// @brief defines the total number of lines written to a file (all fit in one ring)
+    constexpr bsl::safe_uintmax NUM_FILE_LINES{static_cast<bsl::uintmax>(20)};
+    /// @brief defines the size of the buffer used to read back the file
+    constexpr bsl::uintmax FILE_BUF_SIZE{static_cast<bsl::uintmax>(4096)};
+    /// @brief defines a line that is long enough to fill the rings
+    constexpr bsl::cstr_type LINE{
+        "# the quick brown fox jumps over the lazy dog, "
+        "the quick brown fox jumps over the lazy dog: "};
+
+    /// <!-- description -->
+    ///   @brief Writes NUM_LINES lines to stdout, and then exits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    writer(void *const pmut_arg) noexcept -> void *
+    {
+        bsl::discard(pmut_arg);
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_LINES; ++mut_i) {
+            bsl::print() << LINE << mut_i << bsl::endl;
+        }
+
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes NUM_LINES errors to stderr, and then exits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    error_writer(void *const pmut_arg) noexcept -> void *
+    {
+        bsl::discard(pmut_arg);
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_LINES; ++mut_i) {
+            bsl::error() << LINE << mut_i << bsl::endl;
+        }
+
+        return nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs NUM_THREADS threads that each call the provided
+    ///     function, and waits for all of them to exit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param func the function each thread calls
+    ///
+    void
+    run_threads(void *(*const func)(void *) noexcept) noexcept
+    {
+        bsl::array<pthread_t, NUM_THREADS.get()> mut_threads{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+            bsl::ut_check(0 == pthread_create(mut_threads.at_if(mut_i), nullptr, func, nullptr));
+        }
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+            bsl::ut_check(0 == pthread_join(*mut_threads.at_if(mut_i), nullptr));
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the total number of test lines in the provided
+    ///     file.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_file the file to read
+    ///   @return Returns the total number of test lines in the file
+    ///
+    [[nodiscard]] auto
+    file_lines(FILE *const pmut_file) noexcept -> bsl::safe_uintmax
+    {
+        bsl::array<bsl::char_type, FILE_BUF_SIZE> mut_buf{};
+
+        rewind(pmut_file);
+        bsl::safe_uintmax const len{fread(mut_buf.data(), 1U, mut_buf.size().get(), pmut_file)};
+
+        bsl::safe_uintmax mut_lines{};
+        for (bsl::safe_uintmax mut_i{}; mut_i < len; ++mut_i) {
+            if ('#' == *mut_buf.at_if(mut_i)) {
+                ++mut_lines;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        return mut_lines;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"lines from a full ring are dropped and counted"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_when{} = []() noexcept {
+                run_threads(&writer);
+                bsl::print().flush();
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(bsl::details::out_ring_threaded());
+                    bsl::ut_check(
+                        lines() + bsl::details::out_ring_dropped() == NUM_THREADS * NUM_LINES);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"errors are never dropped"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const before{lines()};
+            bsl::safe_uintmax const dropped{bsl::details::out_ring_dropped()};
+            bsl::ut_when{} = [&]() noexcept {
+                run_threads(&error_writer);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(lines() == before + (NUM_THREADS * NUM_LINES));
+                    bsl::ut_check(bsl::details::out_ring_dropped() == dropped);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"lines can be drained to a file"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const before{lines()};
+            FILE *const pmut_file{tmpfile()};
+            bsl::ut_check(nullptr != pmut_file);
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::print().set_file(pmut_file);
+                for (bsl::safe_uintmax mut_i{}; mut_i < NUM_FILE_LINES; ++mut_i) {
+                    bsl::print() << LINE << mut_i << bsl::endl;
+                }
+
+                bsl::print().set_file(nullptr);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(file_lines(pmut_file) == NUM_FILE_LINES);
+                    bsl::ut_check(lines() == before);
+                    bsl::ut_check(0 == fclose(pmut_file));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"lines are written synchronously once stopped"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_uintmax const before{lines()};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::details::out_ring_stop();
+                bsl::print() << LINE << bsl::endl;
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!bsl::details::out_ring_threaded());
+                    bsl::ut_check(lines() == before + static_cast<bsl::uintmax>(1));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,258 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// This test captures each write as it is made, so the line buffers must
+// write synchronously, no matter how the rest of the tests are configured.
+#undef BSL_OUT_RING_SIZE
+#define BSL_OUT_RING_SIZE 0
+
+#define BSL_DETAILS_WRITE_STDOUT_HPP
+#define BSL_DETAILS_WRITE_STDERR_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstring.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace
+{
+    /// @brief stores the total number of chars that can be captured
+    constexpr bsl::safe_uintmax TEST_BUF_SIZE{static_cast<bsl::uintmax>(64)};
+
+    /// @brief stores the total number of writes that have been made
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit bsl::safe_uintmax g_mut_writes{};
+    /// @brief stores the total number of chars that have been written
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit bsl::safe_uintmax g_mut_num{};
+    /// @brief stores the chars that have been written
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit bsl::array<bsl::char_type, TEST_BUF_SIZE.get()> g_mut_buf{};
+
+    /// <!-- description -->
+    ///   @brief Resets the captured output.
+    ///
+    void
+    reset() noexcept
+    {
+        g_mut_writes = static_cast<bsl::uintmax>(0);
+        g_mut_num = static_cast<bsl::uintmax>(0);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if what was written matches the provided
+    ///     string, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the string to compare with
+    ///   @return Returns true if what was written matches the provided
+    ///     string, false otherwise.
+    ///
+    [[nodiscard]] auto
+    was_this_written(bsl::cstr_type const str) noexcept -> bool
+    {
+        if (bsl::builtin_strlen(str) != g_mut_num) {
+            return false;
+        }
+
+        return 0 == __builtin_memcmp(g_mut_buf.data(), str, g_mut_num.get());
+    }
+
+    /// <!-- description -->
+    ///   @brief Captures a single write.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters being written
+    ///   @param len the total number of characters in buf
+    ///
+    void
+    capture(bsl::char_type const *const buf, bsl::safe_uintmax const &len) noexcept
+    {
+        for (bsl::safe_uintmax mut_i{}; mut_i < len; ++mut_i) {
+            *g_mut_buf.at_if(g_mut_num) = buf[mut_i.get()];
+            ++g_mut_num;
+        }
+
+        ++g_mut_writes;
+    }
+}
+
+namespace bsl::details
+{
+    /// <!-- description -->
+    ///   @brief Outputs "len" characters from the provided buffer to
+    ///     stdout using a single write.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters to output to stdout
+    ///   @param len the total number of characters in buf to output
+    ///
+    inline void
+    write_stdout(bsl::char_type const *const buf, bsl::safe_uintmax const &len) noexcept
+    {
+        capture(buf, len);
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs "len" characters from the provided buffer to
+    ///     stderr using a single write.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the characters to output to stderr
+    ///   @param len the total number of characters in buf to output
+    ///
+    inline void
+    write_stderr(bsl::char_type const *const buf, bsl::safe_uintmax const &len) noexcept
+    {
+        capture(buf, len);
+    }
+}
+
+#include <bsl/details/out_line_buffer.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the line buffer used for testing
+    constexpr bsl::uintmax LINE_SIZE{static_cast<bsl::uintmax>(8)};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"a line is written once on newline"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            reset();
+            bsl::details::out_line_buffer<false, LINE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_buf.puts("abc");
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes.is_zero());
+                };
+
+                mut_buf.putc('\n');
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes == 1_umax);
+                    bsl::ut_check(was_this_written("abc\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            reset();
+            bsl::details::out_line_buffer<true, LINE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_buf.puts("ab\ncd\n");
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes == 2_umax);
+                    bsl::ut_check(was_this_written("ab\ncd\n"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a full buffer is written"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            reset();
+            bsl::details::out_line_buffer<false, LINE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_buf.puts("0123456789");
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes == 1_umax);
+                    bsl::ut_check(was_this_written("01234567"));
+                };
+
+                mut_buf.flush();
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes == 2_umax);
+                    bsl::ut_check(was_this_written("0123456789"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a line that fills the buffer"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            reset();
+            bsl::details::out_line_buffer<false, LINE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_buf.puts("0123456\n");
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes == 1_umax);
+                    bsl::ut_check(was_this_written("0123456\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            reset();
+            bsl::details::out_line_buffer<false, LINE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_buf.putc('*');
+                mut_buf.puts("0123456789\n");
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes == 2_umax);
+                    bsl::ut_check(was_this_written("*0123456789\n"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"flush"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            reset();
+            bsl::details::out_line_buffer<false, LINE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                mut_buf.flush();
+                bsl::ut_then{} = []() noexcept {
+                    bsl::ut_check(g_mut_writes.is_zero());
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            reset();
+            {
+                bsl::details::out_line_buffer<false, LINE_SIZE> mut_buf{};
+                mut_buf.putc('*');
+            }
+
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(g_mut_writes == 1_umax);
+                bsl::ut_check(was_this_written("*"));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
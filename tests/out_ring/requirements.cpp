@@ -0,0 +1,77 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/details/out.hpp>
+#include <bsl/details/out_ring.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the ring used for testing
+    constexpr bsl::uintmax RING_SIZE{static_cast<bsl::uintmax>(8)};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::details::out_ring<false, RING_SIZE> mut_ring{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(bsl::details::out_ring<false, RING_SIZE>{}));
+                static_assert(noexcept(mut_ring.claim()));
+                static_assert(noexcept(mut_ring.release()));
+                static_assert(noexcept(mut_ring.fits(1_umax)));
+                static_assert(noexcept(mut_ring.push("*", 1_umax)));
+                static_assert(noexcept(mut_ring.drain()));
+                static_assert(noexcept(mut_ring.dropped()));
+                static_assert(noexcept(bsl::details::out_drain_all()));
+                static_assert(noexcept(bsl::details::out_drain_thread_func()));
+                static_assert(noexcept(bsl::details::out_ring_stop()));
+                static_assert(noexcept(bsl::details::out_ring_dropped()));
+                static_assert(noexcept(bsl::out<bsl::details::out_type_print>::dropped()));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::details::out_ring<false, RING_SIZE> const ring{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(ring.dropped()));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,321 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/npos.hpp>
+#include <bsl/parse_list.hpp>
+#include <bsl/span.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the arrays used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(4)};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"empty list"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_uint32, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint32> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint32>("", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 0_umax);
+                    bsl::ut_check(ret.bad_field == bsl::npos);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dec list"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_int32, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_int32> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::int32>("1,-2, 3", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 3_umax);
+                    bsl::ut_check(ret.bad_field == bsl::npos);
+                    bsl::ut_check(*mut_arr.at_if(0_umax) == 1_i32);
+                    bsl::ut_check(*mut_arr.at_if(1_umax) == -2_i32);
+                    bsl::ut_check(*mut_arr.at_if(2_umax) == 3_i32);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_int32, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_int32> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::int32>("1,2;3 4", ",; ", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 4_umax);
+                    bsl::ut_check(ret.bad_field == bsl::npos);
+                    bsl::ut_check(*mut_arr.at_if(3_umax) == 4_i32);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"hex list"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_uint64, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint64> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{
+                        bsl::parse_list<bsl::uint64>("1000\nff\nABC", "\n", mut_list, 16_i32)};
+                    bsl::ut_check(ret.count == 3_umax);
+                    bsl::ut_check(ret.bad_field == bsl::npos);
+                    bsl::ut_check(*mut_arr.at_if(0_umax) == 0x1000_u64);
+                    bsl::ut_check(*mut_arr.at_if(1_umax) == 0xFF_u64);
+                    bsl::ut_check(*mut_arr.at_if(2_umax) == 0xABC_u64);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bad fields"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_uint8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint8> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint8>("1,2,x,4", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 2_umax);
+                    bsl::ut_check(ret.bad_field == 2_umax);
+                    bsl::ut_check(!*mut_arr.at_if(2_umax));
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_uint8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint8> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint8>("1,256", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 1_umax);
+                    bsl::ut_check(ret.bad_field == 1_umax);
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_uint8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint8> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint8>("1,,3", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 1_umax);
+                    bsl::ut_check(ret.bad_field == 1_umax);
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_uint8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint8> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint8>("1,2,", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 2_umax);
+                    bsl::ut_check(ret.bad_field == 2_umax);
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_int8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_int8> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::int8>("1,2", ",", mut_list, 16_i32)};
+                    bsl::ut_check(ret.count == 0_umax);
+                    bsl::ut_check(ret.bad_field == 0_umax);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"field rules"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_int8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_int8> const list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::int8>(" -128,127,\t-0", ",", list, 10_i32)};
+                    bsl::ut_check(ret.count == 3_umax);
+                    bsl::ut_check(ret.bad_field == bsl::npos);
+                    bsl::ut_check(*mut_arr.at_if(0_umax) == bsl::safe_int8::min());
+                    bsl::ut_check(*mut_arr.at_if(1_umax) == bsl::safe_int8::max());
+                    bsl::ut_check(*mut_arr.at_if(2_umax) == 0_i8);
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_int8, TEST_SIZE> mut_arr{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::int8>("1,-129", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(!*mut_arr.at_if(1_umax));
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::int8>("1,-", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::int8>("1,2-", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::int8>("1,2 ", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::int8>("1,a", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_uint8, TEST_SIZE> mut_arr{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::uint8>("1,-1", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::uint8>("1,g", ",", bsl::span{mut_arr}, 16_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::uint8>("1", ",", bsl::span{mut_arr}, 8_i32)
+                            .bad_field == 0_umax);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"64bit limits"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_int64, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_int64> const list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::int64>(
+                        "-9223372036854775808,9223372036854775807", ",", list, 10_i32)};
+                    bsl::ut_check(ret.count == 2_umax);
+                    bsl::ut_check(ret.bad_field == bsl::npos);
+                    bsl::ut_check(*mut_arr.at_if(0_umax) == bsl::safe_int64::min());
+                    bsl::ut_check(*mut_arr.at_if(1_umax) == bsl::safe_int64::max());
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_uint64, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint64> const list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint64>(
+                        "18446744073709551615", ",", list, 10_i32)};
+                    bsl::ut_check(ret.count == 1_umax);
+                    bsl::ut_check(*mut_arr.at_if(0_umax) == bsl::safe_uint64::max());
+                    auto const hex{
+                        bsl::parse_list<bsl::uint64>("FFFFFFFFFFFFFFFF", ",", list, 16_i32)};
+                    bsl::ut_check(hex.count == 1_umax);
+                    bsl::ut_check(*mut_arr.at_if(0_umax) == bsl::safe_uint64::max());
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_int64, TEST_SIZE> mut_arr{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::int64>(
+                            "1,-9223372036854775809", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(!*mut_arr.at_if(1_umax));
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::int64>(
+                            "1,9223372036854775808", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::array<bsl::safe_uint64, TEST_SIZE> mut_arr{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::uint64>(
+                            "1,18446744073709551616", ",", bsl::span{mut_arr}, 10_i32)
+                            .bad_field == 1_umax);
+                    bsl::ut_check(
+                        bsl::parse_list<bsl::uint64>(
+                            "1,10000000000000000", ",", bsl::span{mut_arr}, 16_i32)
+                            .bad_field == 1_umax);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"delimiters only apply to their own call"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_uint8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint8> const list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const spaces{bsl::parse_list<bsl::uint8>("1 2;3", " ;", list, 10_i32)};
+                    bsl::ut_check(spaces.count == 3_umax);
+                    bsl::ut_check(spaces.bad_field == bsl::npos);
+                    bsl::ut_check(*mut_arr.at_if(2_umax) == 3_u8);
+                    auto const commas{bsl::parse_list<bsl::uint8>("1, 2;3", ",", list, 10_i32)};
+                    bsl::ut_check(commas.count == 1_umax);
+                    bsl::ut_check(commas.bad_field == 1_umax);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"not enough room"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::array<bsl::safe_uint8, TEST_SIZE> mut_arr{};
+                bsl::span<bsl::safe_uint8> mut_list{mut_arr};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint8>("1,2,3,4,5", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 4_umax);
+                    bsl::ut_check(ret.bad_field == 4_umax);
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::span<bsl::safe_uint8> mut_list{};
+                bsl::ut_then{} = [&]() noexcept {
+                    auto const ret{bsl::parse_list<bsl::uint8>("1", ",", mut_list, 10_i32)};
+                    bsl::ut_check(ret.count == 0_umax);
+                    bsl::ut_check(ret.bad_field == 0_umax);
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(tests() == bsl::ut_success());
+    return tests();
+}
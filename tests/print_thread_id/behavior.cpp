@@ -0,0 +1,172 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// This test always prints the timestamp and thread ID, no matter how the
+// rest of the tests are configured.
+#undef ENABLE_THREAD_ID
+#define ENABLE_THREAD_ID true
+#undef ENABLE_TIMESTAMP
+#define ENABLE_TIMESTAMP true
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/ctype.hpp>
+#include <bsl/details/print_thread_id.hpp>
+#include <bsl/format_to.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief stores the size of the buffer the label is formatted into
+    constexpr bsl::uintmax TEST_BUF_SIZE{static_cast<bsl::uintmax>(128)};
+    /// @brief stores the total number of digits printed for nanoseconds
+    constexpr bsl::safe_uintmax TEST_NSEC_DIGITS{static_cast<bsl::uintmax>(9)};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the character at mut_idx is c, in which
+    ///     case mut_idx is moved past it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the label being checked
+    ///   @param mut_idx the index of the character to check
+    ///   @param c the expected character
+    ///   @return Returns true if the character at mut_idx is c
+    ///
+    [[nodiscard]] auto
+    expect(bsl::string_view const &str, bsl::safe_uintmax &mut_idx, bsl::char_type const c) noexcept
+        -> bool
+    {
+        auto const *const elem{str.at_if(mut_idx)};
+        if (nullptr == elem) {
+            return false;
+        }
+
+        if (c != *elem) {
+            return false;
+        }
+
+        ++mut_idx;
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Moves mut_idx past the decimal digits that start at
+    ///     mut_idx, and returns the total number of digits skipped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param str the label being checked
+    ///   @param mut_idx the index of the first digit
+    ///   @return Returns the total number of digits skipped
+    ///
+    [[nodiscard]] auto
+    digits(bsl::string_view const &str, bsl::safe_uintmax &mut_idx) noexcept -> bsl::safe_uintmax
+    {
+        bsl::safe_uintmax mut_num{};
+        for (; mut_idx < str.length(); ++mut_idx) {
+            if (!bsl::isdigit(*str.at_if(mut_idx))) {
+                break;
+            }
+
+            ++mut_num;
+        }
+
+        return mut_num;
+    }
+
+    /// <!-- description -->
+    ///   @brief Formats the label into mut_buf and returns it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_buf the buffer to format the label into
+    ///   @return Returns the label that was formatted
+    ///
+    [[nodiscard]] auto
+    label(bsl::array<bsl::char_type, TEST_BUF_SIZE> &mut_buf) noexcept -> bsl::string_view
+    {
+        auto const ret{bsl::format_to(mut_buf, [](auto const o) noexcept {
+            bsl::details::print_thread_id(o);
+        })};
+
+        return bsl::string_view{mut_buf.data(), ret.count};
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"label format"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_BUF_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                auto const str{label(mut_buf)};
+                bsl::safe_uintmax mut_idx{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(expect(str, mut_idx, ' '));
+                    bsl::ut_check(expect(str, mut_idx, '['));
+                    bsl::ut_check(digits(str, mut_idx).is_pos());
+                    bsl::ut_check(expect(str, mut_idx, '.'));
+                    bsl::ut_check(digits(str, mut_idx) == TEST_NSEC_DIGITS);
+                    bsl::ut_check(expect(str, mut_idx, ']'));
+                    bsl::ut_check(expect(str, mut_idx, ' '));
+                    bsl::ut_check(expect(str, mut_idx, '['));
+                    bsl::ut_check(digits(str, mut_idx).is_pos());
+                    bsl::ut_check(expect(str, mut_idx, ':'));
+                    bsl::ut_check(digits(str, mut_idx).is_pos());
+                    bsl::ut_check(expect(str, mut_idx, ']'));
+                    bsl::ut_check(str.length() == mut_idx);
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"the thread id is cached"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::details::thread_id() == bsl::details::thread_id());
+                bsl::ut_check(bsl::details::thread_id().is_pos());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"the timestamp clock is created at startup"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(bsl::details::TIMESTAMP_CLOCK_INITIALIZED);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
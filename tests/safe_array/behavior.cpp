@@ -0,0 +1,128 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_array.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the arrays used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(130)};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"storage"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(bsl::details::safe_array_words<1>() == 1U);
+                static_assert(bsl::details::safe_array_words<64>() == 1U);
+                static_assert(bsl::details::safe_array_words<65>() == 2U);
+                static_assert(bsl::details::safe_array_words<TEST_SIZE>() == 3U);
+                static_assert(sizeof(bsl::safe_array<bsl::uint64, 64>) == 520U);
+                static_assert(sizeof(bsl::safe_array<bsl::uint8, 64>) == 72U);
+                static_assert(bsl::safe_array<bsl::uint64, TEST_SIZE>::size() == TEST_SIZE);
+                static_assert(
+                    bsl::safe_array<bsl::uint64, TEST_SIZE>::size_bytes() == TEST_SIZE * 8U);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"at"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::safe_array<bsl::uint64, TEST_SIZE> const arr{};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(arr.at(0_umax) == 0_u64);
+                bsl::ut_check(arr.at(129_umax) == 0_u64);
+                bsl::ut_check(!arr.at(130_umax));
+                bsl::ut_check(!arr.at(bsl::safe_uintmax::failure()));
+                bsl::ut_check(!arr.invalid());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"set"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::safe_array<bsl::uint64, TEST_SIZE> mut_arr{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::ut_check(mut_arr.set(0_umax, 42_u64));
+                bsl::ut_check(mut_arr.set(63_umax, 63_u64));
+                bsl::ut_check(mut_arr.set(64_umax, bsl::safe_uint64::failure()));
+                bsl::ut_check(mut_arr.set(129_umax, bsl::safe_uint64::max() + 1_u64));
+                bsl::ut_check(!mut_arr.set(130_umax, 42_u64));
+                bsl::ut_check(!mut_arr.set(bsl::safe_uintmax::failure(), 42_u64));
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_arr.at(0_umax) == 42_u64);
+                    bsl::ut_check(mut_arr.at(63_umax) == 63_u64);
+                    bsl::ut_check(!mut_arr.at(64_umax));
+                    bsl::ut_check(mut_arr.at(65_umax) == 0_u64);
+                    bsl::ut_check(!mut_arr.at(129_umax));
+                    bsl::ut_check(*mut_arr.data() == 42U);
+                    bsl::ut_check(mut_arr.invalid());
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() noexcept {
+            bsl::safe_array<bsl::uint8, TEST_SIZE> mut_arr{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::ut_check(mut_arr.set(64_umax, bsl::safe_uint8::failure()));
+                bsl::ut_check(mut_arr.set(64_umax, 42_u8));
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_arr.at(64_umax) == 42_u8);
+                    bsl::ut_check(!mut_arr.invalid());
+                };
+            };
+        };
+
+        bsl::ut_given{} = []() noexcept {
+            constexpr auto arr{[]() noexcept {
+                bsl::safe_array<bsl::int32, TEST_SIZE> mut_arr{};
+                bsl::discard(mut_arr.set(1_umax, -42_i32));
+                bsl::discard(mut_arr.set(2_umax, bsl::safe_int32::failure()));
+                return mut_arr;
+            }()};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(arr.at(1_umax) == -42_i32);
+                static_assert(!arr.at(2_umax));
+                static_assert(arr.invalid());
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
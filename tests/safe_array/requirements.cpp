@@ -0,0 +1,83 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_array.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    constinit bsl::safe_array<bsl::uint64, static_cast<bsl::uintmax>(42)> const
+        g_verify_constinit{};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify supports constinit"} = []() noexcept {
+        bsl::discard(g_verify_constinit);
+    };
+
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::safe_array<bsl::uint64, static_cast<bsl::uintmax>(42)> mut_arr{};
+            bsl::safe_array<bsl::uint64, static_cast<bsl::uintmax>(42)> const arr{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(bsl::safe_array<bsl::uint64, 42>{}));
+                static_assert(noexcept(mut_arr.at(0_umax)));
+                static_assert(noexcept(mut_arr.set(0_umax, 42_u64)));
+                static_assert(noexcept(mut_arr.invalid()));
+                static_assert(noexcept(mut_arr.data()));
+                static_assert(noexcept(mut_arr.size()));
+                static_assert(noexcept(mut_arr.size_bytes()));
+                static_assert(noexcept(arr.at(0_umax)));
+                static_assert(noexcept(arr.invalid()));
+                static_assert(noexcept(arr.data()));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            constexpr bsl::safe_array<bsl::uint64, static_cast<bsl::uintmax>(42)> arr{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(arr.at(0_umax) == 0_u64);
+                static_assert(!arr.invalid());
+                static_assert(arr.size() == 42_umax);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,190 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/memory_order.hpp>
+#include <bsl/safe_atomic.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/ut.hpp>
+
+#include <pthread.h>
+
+namespace
+{
+    /// @brief the value all of the tests start with
+    constexpr bsl::safe_uintmax INIT{static_cast<bsl::uintmax>(42)};
+    /// @brief defines the total number of threads that update the counter
+    constexpr bsl::safe_uintmax NUM_THREADS{static_cast<bsl::uintmax>(4)};
+    /// @brief defines the total number of times each thread updates the counter
+    constexpr bsl::safe_uintmax NUM_UPDATES{static_cast<bsl::uintmax>(10000)};
+
+    /// @brief stores the counter that is updated by every thread
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    constinit bsl::safe_atomic<bsl::uintmax> g_mut_counter{};
+
+    /// <!-- description -->
+    ///   @brief Increments g_mut_counter NUM_UPDATES times using a
+    ///     compare_exchange_strong loop, and NUM_UPDATES times using
+    ///     fetch_add, and then exits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_arg ignored
+    ///   @return Always returns a nullptr
+    ///
+    [[nodiscard]] auto
+    updater(void *const pmut_arg) noexcept -> void *
+    {
+        constexpr bsl::safe_uintmax one{static_cast<bsl::uintmax>(1)};
+        bsl::discard(pmut_arg);
+
+        for (bsl::safe_uintmax mut_i{}; mut_i < NUM_UPDATES; ++mut_i) {
+            auto mut_expected{g_mut_counter.load(bsl::memory_order_relaxed)};
+            while (!g_mut_counter.compare_exchange_strong(mut_expected, mut_expected + one)) {
+                bsl::touch();
+            }
+
+            bsl::discard(g_mut_counter.fetch_add(one));
+        }
+
+        return nullptr;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"constructors"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_atomic<bsl::uintmax> const val1{};
+            bsl::safe_atomic<bsl::uintmax> const val2{INIT.get()};
+            bsl::safe_atomic<bsl::uintmax> const val3{INIT};
+            bsl::safe_atomic<bsl::uintmax> const val4{bsl::safe_uintmax::failure()};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(val1.load() == static_cast<bsl::uintmax>(0));
+                bsl::ut_check(val2.load() == INIT);
+                bsl::ut_check(val3.load(bsl::memory_order_relaxed) == INIT);
+                bsl::ut_check(val4.load() == static_cast<bsl::uintmax>(0));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"store/exchange"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_atomic<bsl::uintmax> mut_val{INIT};
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(23)};
+            bsl::ut_then{} = [&]() noexcept {
+                mut_val.store(bsl::safe_uintmax::failure());
+                bsl::ut_check(mut_val.load() == INIT);
+                bsl::ut_check(mut_val.exchange(bsl::safe_uintmax::failure()).invalid());
+                bsl::ut_check(mut_val.load() == INIT);
+                bsl::ut_check(mut_val.exchange(val) == INIT);
+                mut_val.store(INIT, bsl::memory_order_release);
+                bsl::ut_check(mut_val.load(bsl::memory_order_acquire) == INIT);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"compare_exchange_strong"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_atomic<bsl::uintmax> mut_val{INIT};
+            bsl::safe_uintmax mut_expected{static_cast<bsl::uintmax>(23)};
+            bsl::safe_uintmax mut_err{bsl::safe_uintmax::failure()};
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(1)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(!mut_val.compare_exchange_strong(mut_expected, val));
+                bsl::ut_check(mut_expected == INIT);
+                bsl::ut_check(!mut_val.compare_exchange_strong(mut_err, val));
+                bsl::ut_check(!mut_val.compare_exchange_strong(
+                    mut_expected, bsl::safe_uintmax::failure()));
+                bsl::ut_check(mut_val.compare_exchange_strong(mut_expected, val));
+                bsl::ut_check(mut_val.load() == val);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"fetch_add/fetch_sub"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_atomic<bsl::uintmax> mut_val{INIT};
+            bsl::safe_uintmax const val{static_cast<bsl::uintmax>(8)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_val.fetch_add(val) == INIT);
+                bsl::ut_check(mut_val.fetch_sub(val, bsl::memory_order_relaxed) == INIT + val);
+                bsl::ut_check(mut_val.load() == INIT);
+            };
+        };
+    };
+
+    bsl::ut_scenario{"fetch_add/fetch_sub overflow"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::safe_atomic<bsl::uint8> mut_val{bsl::safe_uint8::max()};
+            bsl::safe_atomic<bsl::int8> mut_sval{bsl::safe_int8::min()};
+            bsl::safe_uint8 const one{static_cast<bsl::uint8>(1)};
+            bsl::safe_int8 const sone{static_cast<bsl::int8>(1)};
+            bsl::ut_then{} = [&]() noexcept {
+                bsl::ut_check(mut_val.fetch_add(one).invalid());
+                bsl::ut_check(mut_val.load() == bsl::safe_uint8::max());
+                bsl::ut_check(mut_val.fetch_add(bsl::safe_uint8::failure()).invalid());
+                bsl::ut_check(mut_val.load() == bsl::safe_uint8::max());
+                bsl::ut_check(mut_sval.fetch_sub(sone).invalid());
+                bsl::ut_check(mut_sval.load() == bsl::safe_int8::min());
+                bsl::ut_check(mut_sval.fetch_sub(bsl::safe_int8::failure()).invalid());
+                bsl::ut_check(mut_sval.fetch_add(sone) == bsl::safe_int8::min());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"updates from many threads are never lost"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<pthread_t, NUM_THREADS.get()> mut_threads{};
+            bsl::ut_when{} = [&]() noexcept {
+                for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                    auto *const pmut_thread{mut_threads.at_if(mut_i)};
+                    bsl::ut_check(0 == pthread_create(pmut_thread, nullptr, &updater, nullptr));
+                }
+
+                for (bsl::safe_uintmax mut_i{}; mut_i < NUM_THREADS; ++mut_i) {
+                    bsl::ut_check(0 == pthread_join(*mut_threads.at_if(mut_i), nullptr));
+                }
+
+                bsl::ut_then{} = []() noexcept {
+                    constexpr bsl::safe_uintmax two{static_cast<bsl::uintmax>(2)};
+                    bsl::ut_check(g_mut_counter.load() == NUM_THREADS * NUM_UPDATES * two);
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -804,22 +804,26 @@ main() noexcept -> bsl::exit_code
     static_assert(bsl::tests_arithmetic<bsl::uint32>() == bsl::ut_success());
     static_assert(bsl::tests_arithmetic<bsl::uint64>() == bsl::ut_success());
     static_assert(bsl::tests_arithmetic<bsl::uintmax>() == bsl::ut_success());
+    static_assert(bsl::tests_arithmetic<bsl::uint128>() == bsl::ut_success());
     static_assert(bsl::tests_arithmetic<bsl::int8>() == bsl::ut_success());
     static_assert(bsl::tests_arithmetic<bsl::int16>() == bsl::ut_success());
     static_assert(bsl::tests_arithmetic<bsl::int32>() == bsl::ut_success());
     static_assert(bsl::tests_arithmetic<bsl::int64>() == bsl::ut_success());
     static_assert(bsl::tests_arithmetic<bsl::intmax>() == bsl::ut_success());
+    static_assert(bsl::tests_arithmetic<bsl::int128>() == bsl::ut_success());
 
     bsl::discard(bsl::tests_arithmetic<bsl::uint8>());
     bsl::discard(bsl::tests_arithmetic<bsl::uint16>());
     bsl::discard(bsl::tests_arithmetic<bsl::uint32>());
     bsl::discard(bsl::tests_arithmetic<bsl::uint64>());
     bsl::discard(bsl::tests_arithmetic<bsl::uintmax>());
+    bsl::discard(bsl::tests_arithmetic<bsl::uint128>());
     bsl::discard(bsl::tests_arithmetic<bsl::int8>());
     bsl::discard(bsl::tests_arithmetic<bsl::int16>());
     bsl::discard(bsl::tests_arithmetic<bsl::int32>());
     bsl::discard(bsl::tests_arithmetic<bsl::int64>());
     bsl::discard(bsl::tests_arithmetic<bsl::intmax>());
+    bsl::discard(bsl::tests_arithmetic<bsl::int128>());
 
     return bsl::ut_success();
 }
@@ -474,12 +474,14 @@ main() noexcept -> bsl::exit_code
     static_assert(bsl::tests_binary<bsl::uint32>() == bsl::ut_success());
     static_assert(bsl::tests_binary<bsl::uint64>() == bsl::ut_success());
     static_assert(bsl::tests_binary<bsl::uintmax>() == bsl::ut_success());
+    static_assert(bsl::tests_binary<bsl::uint128>() == bsl::ut_success());
 
     bsl::discard(bsl::tests_binary<bsl::uint8>());
     bsl::discard(bsl::tests_binary<bsl::uint16>());
     bsl::discard(bsl::tests_binary<bsl::uint32>());
     bsl::discard(bsl::tests_binary<bsl::uint64>());
     bsl::discard(bsl::tests_binary<bsl::uintmax>());
+    bsl::discard(bsl::tests_binary<bsl::uint128>());
 
     return bsl::ut_success();
 }
@@ -1705,22 +1705,26 @@ main() noexcept -> bsl::exit_code
     static_assert(bsl::tests_members<bsl::uint32>() == bsl::ut_success());
     static_assert(bsl::tests_members<bsl::uint64>() == bsl::ut_success());
     static_assert(bsl::tests_members<bsl::uintmax>() == bsl::ut_success());
+    static_assert(bsl::tests_members<bsl::uint128>() == bsl::ut_success());
     static_assert(bsl::tests_members<bsl::int8>() == bsl::ut_success());
     static_assert(bsl::tests_members<bsl::int16>() == bsl::ut_success());
     static_assert(bsl::tests_members<bsl::int32>() == bsl::ut_success());
     static_assert(bsl::tests_members<bsl::int64>() == bsl::ut_success());
     static_assert(bsl::tests_members<bsl::intmax>() == bsl::ut_success());
+    static_assert(bsl::tests_members<bsl::int128>() == bsl::ut_success());
 
     bsl::discard(bsl::tests_members<bsl::uint8>());
     bsl::discard(bsl::tests_members<bsl::uint16>());
     bsl::discard(bsl::tests_members<bsl::uint32>());
     bsl::discard(bsl::tests_members<bsl::uint64>());
     bsl::discard(bsl::tests_members<bsl::uintmax>());
+    bsl::discard(bsl::tests_members<bsl::uint128>());
     bsl::discard(bsl::tests_members<bsl::int8>());
     bsl::discard(bsl::tests_members<bsl::int16>());
     bsl::discard(bsl::tests_members<bsl::int32>());
     bsl::discard(bsl::tests_members<bsl::int64>());
     bsl::discard(bsl::tests_members<bsl::intmax>());
+    bsl::discard(bsl::tests_members<bsl::int128>());
 
     return bsl::ut_success();
 }
@@ -1128,22 +1128,26 @@ main() noexcept -> bsl::exit_code
     static_assert(bsl::tests_rational<bsl::uint32>() == bsl::ut_success());
     static_assert(bsl::tests_rational<bsl::uint64>() == bsl::ut_success());
     static_assert(bsl::tests_rational<bsl::uintmax>() == bsl::ut_success());
+    static_assert(bsl::tests_rational<bsl::uint128>() == bsl::ut_success());
     static_assert(bsl::tests_rational<bsl::int8>() == bsl::ut_success());
     static_assert(bsl::tests_rational<bsl::int16>() == bsl::ut_success());
     static_assert(bsl::tests_rational<bsl::int32>() == bsl::ut_success());
     static_assert(bsl::tests_rational<bsl::int64>() == bsl::ut_success());
     static_assert(bsl::tests_rational<bsl::intmax>() == bsl::ut_success());
+    static_assert(bsl::tests_rational<bsl::int128>() == bsl::ut_success());
 
     bsl::discard(bsl::tests_rational<bsl::uint8>());
     bsl::discard(bsl::tests_rational<bsl::uint16>());
     bsl::discard(bsl::tests_rational<bsl::uint32>());
     bsl::discard(bsl::tests_rational<bsl::uint64>());
     bsl::discard(bsl::tests_rational<bsl::uintmax>());
+    bsl::discard(bsl::tests_rational<bsl::uint128>());
     bsl::discard(bsl::tests_rational<bsl::int8>());
     bsl::discard(bsl::tests_rational<bsl::int16>());
     bsl::discard(bsl::tests_rational<bsl::int32>());
     bsl::discard(bsl::tests_rational<bsl::int64>());
     bsl::discard(bsl::tests_rational<bsl::intmax>());
+    bsl::discard(bsl::tests_rational<bsl::int128>());
 
     return bsl::ut_success();
 }
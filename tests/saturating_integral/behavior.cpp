@@ -0,0 +1,339 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/fmt.hpp>
+#include <bsl/format_to.hpp>
+#include <bsl/is_signed.hpp>
+#include <bsl/is_unsigned.hpp>
+#include <bsl/numeric_limits.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/saturating_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the buffers used for testing
+    constexpr bsl::uintmax TEST_SIZE{static_cast<bsl::uintmax>(32)};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the buffer to compare
+    ///   @param str the string to compare with
+    ///   @return Returns true if the provided buffer contains the provided
+    ///     string, false otherwise.
+    ///
+    [[nodiscard]] auto
+    buf_is(bsl::char_type const *const buf, bsl::cstr_type const str) noexcept -> bool
+    {
+        return bsl::string_view{buf} == str;
+    }
+}
+
+namespace bsl
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the integral type to test
+    ///   @return Always returns bsl::exit_success.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    tests_saturating() noexcept -> bsl::exit_code
+    {
+        constexpr T min{bsl::numeric_limits<T>::min()};
+        constexpr T max{bsl::numeric_limits<T>::max()};
+        constexpr T zero{static_cast<T>(0)};
+        constexpr T one{static_cast<T>(1)};
+        constexpr T two{static_cast<T>(2)};
+        constexpr T fortytwo{static_cast<T>(42)};
+
+        bsl::ut_scenario{"add"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::saturating_integral<T> const val{fortytwo};
+                bsl::saturating_integral<T> const maxval{max};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val + val == static_cast<T>(84));
+                    bsl::ut_check(val + one == static_cast<T>(43));
+                    bsl::ut_check(one + val == static_cast<T>(43));
+                    bsl::ut_check(maxval + one == max);
+                    bsl::ut_check(maxval + maxval == max);
+                    if constexpr (bsl::is_signed<T>::value) {
+                        bsl::saturating_integral<T> const minval{min};
+                        bsl::ut_check(minval + static_cast<T>(-1) == min);
+                        bsl::ut_check(minval + minval == min);
+                        bsl::ut_check(maxval + minval == static_cast<T>(-1));
+                    }
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::saturating_integral<T> mut_val{max};
+                bsl::ut_when{} = [&]() noexcept {
+                    ++mut_val;
+                    mut_val += one;
+                    mut_val += mut_val;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_val == max);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sub"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::saturating_integral<T> const val{fortytwo};
+                bsl::saturating_integral<T> const minval{min};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val - val == zero);
+                    bsl::ut_check(val - one == static_cast<T>(41));
+                    bsl::ut_check(minval - one == min);
+                    if constexpr (bsl::is_signed<T>::value) {
+                        bsl::saturating_integral<T> const maxval{max};
+                        bsl::ut_check(one - val == static_cast<T>(-41));
+                        bsl::ut_check(maxval - static_cast<T>(-1) == max);
+                        bsl::ut_check(minval - maxval == min);
+                        bsl::ut_check(-minval == max);
+                        bsl::ut_check(-val == static_cast<T>(-42));
+                    }
+                    else {
+                        bsl::ut_check(one - val == zero);
+                    }
+                };
+            };
+
+            bsl::ut_given{} = []() noexcept {
+                bsl::saturating_integral<T> mut_val{min};
+                bsl::ut_when{} = [&]() noexcept {
+                    --mut_val;
+                    mut_val -= one;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_val == min);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mul"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::saturating_integral<T> const val{fortytwo};
+                bsl::saturating_integral<T> const maxval{max};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val * two == static_cast<T>(84));
+                    bsl::ut_check(two * val == static_cast<T>(84));
+                    bsl::ut_check(maxval * two == max);
+                    bsl::ut_check(maxval * maxval == max);
+                    bsl::ut_check(maxval * zero == zero);
+                    if constexpr (bsl::is_signed<T>::value) {
+                        bsl::saturating_integral<T> const minval{min};
+                        bsl::ut_check(maxval * static_cast<T>(-2) == min);
+                        bsl::ut_check(minval * two == min);
+                        bsl::ut_check(minval * static_cast<T>(-1) == max);
+                        bsl::ut_check(minval * minval == max);
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"div and mod"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::saturating_integral<T> const val{fortytwo};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val / two == static_cast<T>(21));
+                    bsl::ut_check(val % static_cast<T>(5) == two);
+                    bsl::ut_check(
+                        fortytwo / bsl::saturating_integral<T>{two} == static_cast<T>(21));
+                    if constexpr (bsl::is_signed<T>::value) {
+                        bsl::saturating_integral<T> const minval{min};
+                        bsl::ut_check(minval / static_cast<T>(-1) == max);
+                        bsl::ut_check(minval % static_cast<T>(-1) == zero);
+                        bsl::ut_check(val / static_cast<T>(-2) == static_cast<T>(-21));
+                    }
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::saturating_integral<T> mut_val{fortytwo};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_val / zero == zero);
+                    bsl::ut_check(mut_val % zero == zero);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"shift"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                if constexpr (bsl::is_unsigned<T>::value) {
+                    constexpr T digits{static_cast<T>(bsl::numeric_limits<T>::digits)};
+                    bsl::saturating_integral<T> const val{fortytwo};
+                    bsl::saturating_integral<T> const maxval{max};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(val << one == static_cast<T>(84));
+                        bsl::ut_check(val >> one == static_cast<T>(21));
+                        bsl::ut_check(maxval << one == max);
+                        bsl::ut_check(val << digits == max);
+                        bsl::ut_check(val >> digits == zero);
+                        bsl::ut_check((maxval >> one) << one == static_cast<T>(max - one));
+                        bsl::ut_check(bsl::saturating_integral<T>{zero} << digits == zero);
+                    };
+                }
+            };
+        };
+
+        bsl::ut_scenario{"bitwise"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                if constexpr (bsl::is_unsigned<T>::value) {
+                    bsl::saturating_integral<T> const val{fortytwo};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check((val & two) == two);
+                        bsl::ut_check((val | one) == static_cast<T>(43));
+                        bsl::ut_check((val ^ val) == zero);
+                        bsl::ut_check(~val == static_cast<T>(max - fortytwo));
+                    };
+                }
+            };
+        };
+
+        bsl::ut_scenario{"members"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::saturating_integral<T> mut_val{};
+                bsl::saturating_integral<T> const val{fortytwo};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_val = one;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_val.get() == one);
+                        bsl::ut_check(*mut_val.data() == one);
+                        bsl::ut_check(*val.data() == fortytwo);
+                        bsl::ut_check(mut_val.is_pos());
+                        bsl::ut_check(!mut_val.is_zero());
+                        bsl::ut_check(mut_val.max(val) == fortytwo);
+                        bsl::ut_check(mut_val.min(val) == one);
+                        bsl::ut_check(bsl::saturating_integral<T>::max() == max);
+                        bsl::ut_check(bsl::saturating_integral<T>::min() == min);
+                        bsl::ut_check(bsl::make_saturating(static_cast<T>(42)) == val);
+                        bsl::ut_check(val != mut_val);
+                        bsl::ut_check(mut_val < val);
+                        bsl::ut_check(val > mut_val);
+                        bsl::ut_check(mut_val <= one);
+                        bsl::ut_check(fortytwo >= val);
+                        if constexpr (bsl::is_signed<T>::value) {
+                            bsl::ut_check(!mut_val.is_neg());
+                            bsl::ut_check((-val).is_neg());
+                        }
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"safe_integral interop"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bsl::safe_integral<T> const safe{fortytwo};
+                bsl::saturating_integral<T> const val{safe};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(val == fortytwo);
+                    bsl::ut_check(bsl::convert<T>(val) == safe);
+                    bsl::ut_check(bsl::convert<bsl::intmax>(val).is_pos());
+                };
+            };
+
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::saturating_integral<T> const val{max};
+                bsl::ut_then{} = [&]() noexcept {
+                    if constexpr (sizeof(T) > sizeof(bsl::uint8)) {
+                        bsl::ut_check(bsl::convert<bsl::uint8>(val).invalid());
+                    }
+                    bsl::ut_check(
+                        bsl::saturating_integral<T>{bsl::safe_integral<T>::failure()} == zero);
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    static_assert(bsl::tests_saturating<bsl::uint8>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::uint16>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::uint32>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::uint64>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::uintmax>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::int8>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::int16>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::int32>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::int64>() == bsl::ut_success());
+    static_assert(bsl::tests_saturating<bsl::intmax>() == bsl::ut_success());
+
+    bsl::discard(bsl::tests_saturating<bsl::uint8>());
+    bsl::discard(bsl::tests_saturating<bsl::uint16>());
+    bsl::discard(bsl::tests_saturating<bsl::uint32>());
+    bsl::discard(bsl::tests_saturating<bsl::uint64>());
+    bsl::discard(bsl::tests_saturating<bsl::uintmax>());
+    bsl::discard(bsl::tests_saturating<bsl::int8>());
+    bsl::discard(bsl::tests_saturating<bsl::int16>());
+    bsl::discard(bsl::tests_saturating<bsl::int32>());
+    bsl::discard(bsl::tests_saturating<bsl::int64>());
+    bsl::discard(bsl::tests_saturating<bsl::intmax>());
+
+    bsl::ut_scenario{"output"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::array<bsl::char_type, TEST_SIZE> mut_buf{};
+            bsl::saturating_uint8 const val1{static_cast<bsl::uint8>(42)};
+            bsl::saturating_int32 const val2{-42};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::discard(bsl::format_to(mut_buf, [&](auto const o) noexcept {
+                    o << val1 << ' ' << val2 << ' ' << bsl::fmt{"#06x", val1};
+                }));
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(buf_is(mut_buf.data(), "42 -42 0x002A"));
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,288 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/char_type.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstring.hpp>
+#include <bsl/format_to.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/trace.hpp>
+#include <bsl/trace_buffer.hpp>
+#include <bsl/trace_decode.hpp>
+#include <bsl/trace_fmt.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the trace buffers used for testing
+    constexpr bsl::uintmax TRACE_SIZE{static_cast<bsl::uintmax>(128)};
+    /// @brief defines the size of the small trace buffers used for testing
+    constexpr bsl::uintmax SMALL_SIZE{static_cast<bsl::uintmax>(16)};
+    /// @brief defines the size of the text buffers used for testing
+    constexpr bsl::uintmax TEXT_SIZE{static_cast<bsl::uintmax>(128)};
+
+    /// @brief defines a format string with integral arguments
+    constexpr bsl::trace_fmt FMT_INTEGRALS{"u8 {} i16 {} u32 {#x} i64 {>5}"};
+    /// @brief defines a format string with non-integral arguments
+    constexpr bsl::trace_fmt FMT_OTHERS{"bool {} ptr {} str [{<5}]"};
+    /// @brief defines a format string with no arguments
+    constexpr bsl::trace_fmt FMT_NONE{"hello"};
+    /// @brief defines a format string with a '{' fill
+    constexpr bsl::trace_fmt FMT_FILL{"[{{<5}]"};
+
+    /// @brief defines the catalog used to decode the records
+    constexpr bsl::array<bsl::trace_fmt, static_cast<bsl::uintmax>(4)> CATALOG{
+        FMT_INTEGRALS, FMT_OTHERS, FMT_NONE, FMT_FILL};
+
+    /// <!-- description -->
+    ///   @brief Decodes the provided buffer into mut_text and returns
+    ///     true if the result matches the provided string.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param buf the records to decode
+    ///   @param size the total number of bytes in buf
+    ///   @param str the string to compare with
+    ///   @return Returns true if the decoded text matches the provided
+    ///     string, false otherwise.
+    ///
+    [[nodiscard]] auto
+    decodes_to(
+        bsl::uint8 const *const buf,
+        bsl::safe_uintmax const &size,
+        bsl::cstr_type const str) noexcept -> bool
+    {
+        bsl::array<bsl::char_type, TEXT_SIZE> mut_text{};
+        bsl::discard(bsl::format_to(mut_text, [buf, &size](auto const o) noexcept {
+            bsl::trace_decode(o, buf, size, CATALOG);
+        }));
+
+        bsl::array<bsl::char_type, TEXT_SIZE> const &text{mut_text};
+        return bsl::string_view{text.data()} == str;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"trace_fmt"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                static_assert(FMT_INTEGRALS.num_args() == 4_umax);
+                static_assert(FMT_OTHERS.num_args() == 3_umax);
+                static_assert(FMT_NONE.num_args() == 0_umax);
+                static_assert(FMT_FILL.num_args() == 1_umax);
+                static_assert(FMT_NONE.length() == 5_umax);
+                static_assert(FMT_INTEGRALS.id() != FMT_OTHERS.id());
+                static_assert(FMT_INTEGRALS.id() != FMT_NONE.id());
+            };
+        };
+    };
+
+    bsl::ut_scenario{"record and decode integrals"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_INTEGRALS, 42_u8, -7_i16, 0x2A_u32, -1_i64);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_buf.size() == 26_umax);
+                    bsl::ut_check(decodes_to(
+                        mut_buf.data(), mut_buf.size(), "u8 42 i16 -7 u32 0x2A i64    -1\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(
+                    mut_buf,
+                    FMT_INTEGRALS,
+                    static_cast<bsl::uint8>(1),
+                    bsl::safe_int16::failure(),
+                    static_cast<bsl::uint32>(2),
+                    static_cast<bsl::int64>(3));
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(decodes_to(
+                        mut_buf.data(), mut_buf.size(), "u8 1 i16 [error] u32 0x2 i64     3\n"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"record and decode other types"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_OTHERS, true, nullptr, bsl::string_view{"abc"});
+                bsl::trace(mut_buf, FMT_NONE);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(decodes_to(
+                        mut_buf.data(),
+                        mut_buf.size(),
+                        "bool true ptr nullptr str [abc  ]\nhello\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                // A fake pointer is needed so that the output is known.
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                auto const *const ptr{reinterpret_cast<void const *>(0x1234U)};
+                bsl::trace(mut_buf, FMT_OTHERS, false, ptr, bsl::string_view{});
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(decodes_to(
+                        mut_buf.data(),
+                        mut_buf.size(),
+                        "bool false ptr 0x0000000000001234 str [     ]\n"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"a '{' fill is not a placeholder"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_FILL, 42_u32);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_buf.size() == 12_umax);
+                    bsl::ut_check(decodes_to(mut_buf.data(), mut_buf.size(), "[42{{{]\n"));
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"full buffer"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<SMALL_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_NONE);
+                bsl::trace(mut_buf, FMT_NONE);
+                bsl::trace(mut_buf, FMT_NONE);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_buf.size() == 14_umax);
+                    bsl::ut_check(mut_buf.dropped() == 1_umax);
+                    bsl::ut_check(decodes_to(mut_buf.data(), mut_buf.size(), "hello\nhello\n"));
+                };
+
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_buf.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_buf.size() == 0_umax);
+                        bsl::ut_check(mut_buf.dropped() == 0_umax);
+                    };
+                };
+            };
+        };
+    };
+
+    bsl::ut_scenario{"decode errors"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            constexpr bsl::trace_fmt unknown{"not in the catalog"};
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, unknown);
+                bsl::trace(mut_buf, FMT_NONE);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::array<bsl::char_type, TEXT_SIZE> mut_text{};
+                    bsl::discard(bsl::format_to(mut_text, [&mut_buf](auto const o) noexcept {
+                        bsl::trace_decode(o, mut_buf.data(), mut_buf.size(), CATALOG);
+                    }));
+
+                    bsl::array<bsl::char_type, TEXT_SIZE> const &text{mut_text};
+                    bsl::string_view const str{text.data()};
+                    bsl::ut_check(str.starts_with("[unknown trace 0x"));
+                    bsl::ut_check(str.ends_with("]\nhello\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_NONE);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(decodes_to(mut_buf.data(), 3_umax, "[corrupt trace]\n"));
+                    bsl::ut_check(decodes_to(mut_buf.data(), 6_umax, "[corrupt trace]\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_OTHERS, true, nullptr, bsl::string_view{"abc"});
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(decodes_to(mut_buf.data(), 12_umax, "[corrupt trace]\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::array<bsl::uint8, TRACE_SIZE> mut_rec{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_INTEGRALS, 42_u8, -7_i16, 0x2A_u32, -1_i64);
+                bsl::discard(bsl::builtin_memcpy(mut_rec.data(), mut_buf.data(), mut_buf.size()));
+                *mut_rec.at_if(6_umax) = static_cast<bsl::uint8>(5);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(decodes_to(mut_rec.data(), mut_buf.size(), "[corrupt trace]\n"));
+                };
+            };
+        };
+
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(decodes_to(nullptr, 1_umax, ""));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"argument mismatch"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::ut_when{} = [&]() noexcept {
+                bsl::trace(mut_buf, FMT_NONE, 42_u32);
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_buf.size() == 0_umax);
+                };
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,89 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/trace.hpp>
+#include <bsl/trace_buffer.hpp>
+#include <bsl/trace_decode.hpp>
+#include <bsl/trace_fmt.hpp>
+#include <bsl/ut.hpp>
+
+namespace
+{
+    /// @brief defines the size of the trace buffers used for testing
+    constexpr bsl::uintmax TRACE_SIZE{static_cast<bsl::uintmax>(64)};
+    /// @brief defines the format string used for testing
+    constexpr bsl::trace_fmt FMT{"{} {}"};
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> mut_buf{};
+            bsl::trace_buffer<TRACE_SIZE> const buf{};
+            constexpr bsl::array<bsl::trace_fmt, static_cast<bsl::uintmax>(1)> catalog{FMT};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(noexcept(bsl::trace_buffer<TRACE_SIZE>{}));
+                static_assert(noexcept(mut_buf.reserve(1_umax)));
+                static_assert(noexcept(mut_buf.clear()));
+                static_assert(noexcept(buf.data()));
+                static_assert(noexcept(buf.size()));
+                static_assert(noexcept(buf.dropped()));
+                static_assert(noexcept(FMT.str()));
+                static_assert(noexcept(FMT.length()));
+                static_assert(noexcept(FMT.id()));
+                static_assert(noexcept(FMT.num_args()));
+                static_assert(noexcept(bsl::trace(mut_buf, FMT, 1_u32, true)));
+                static_assert(
+                    noexcept(bsl::trace_decode(bsl::print(), buf.data(), buf.size(), catalog)));
+            };
+        };
+    };
+
+    bsl::ut_scenario{"verify constness"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            bsl::trace_buffer<TRACE_SIZE> const buf{};
+            bsl::ut_then{} = [&]() noexcept {
+                static_assert(bsl::trace_buffer<TRACE_SIZE>{}.size() == 0_umax);
+                bsl::ut_check(buf.size() == 0_umax);
+                bsl::ut_check(buf.dropped() == 0_umax);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}